@@ -18,6 +18,9 @@
 #include <string>
 #include <vector>
 #include <algorithm>
+#include <boost/cstdint.hpp>
+#include <boost/move/utility.hpp>
+#include <boost/function.hpp>
 #include <boost/quick_check/quick_check_fwd.hpp>
 #include <boost/type_traits/remove_const.hpp>
 #include <boost/type_traits/remove_reference.hpp>
@@ -35,47 +38,172 @@ namespace quick_check
         struct classify_
         {};
 
+        // One bit per classify() clause of a property, in the order the
+        // clauses appear.
+        typedef boost::uint64_t class_mask;
+
+        // The names of the classes in mask, sorted. Clauses that share a
+        // name are one class.
+        inline std::vector<std::string>
+        class_names(std::vector<std::string> const &names, class_mask mask)
+        {
+            std::vector<std::string> res;
+            for(std::size_t i = 0; mask != 0; ++i, mask >>= 1)
+                if(mask & 1u)
+                    res.push_back(names[i]);
+            std::sort(res.begin(), res.end());
+            res.erase(std::unique(res.begin(), res.end()), res.end());
+            return res;
+        }
+
+        // Sum the counts of adjacent (key, count) pairs with equivalent keys
+        // in a range sorted by key, in place, and return the end of the
+        // merged range.
+        template<typename Iter>
+        Iter merge_adjacent(Iter begin, Iter end)
+        {
+            if(begin == end)
+                return end;
+            Iter out = begin;
+            for(++begin; begin != end; ++begin)
+            {
+                if(!(out->first < begin->first))
+                    out->second += begin->second;
+                else if(++out != begin)
+                    *out = boost::move(*begin);
+            }
+            return ++out;
+        }
+
         struct unclassified_args
         {
             typedef std::vector<std::string> result_type;
 
+            static std::size_t const size = 0;
+
             template<typename Args>
             result_type operator()(Args &) const
             {
                 return result_type();
             }
+
+            template<typename Args>
+            class_mask mask(Args &) const
+            {
+                return 0u;
+            }
+
+            void names(std::vector<std::string> &) const
+            {}
         };
 
+        // The classifier of a property with one or more classify() clauses.
+        // The algorithms classify each test case with mask(), which is free
+        // of allocations, and turn the masks into names only when they
+        // report them. The bit of each clause is known at compile time.
         template<typename Cond, typename Rest = unclassified_args>
         struct classify_args
         {
             typedef std::vector<std::string> result_type;
 
+            static std::size_t const size = Rest::size + 1;
+
+            static_assert(size <= 64, "A property may have at most 64 classify() clauses");
+
             classify_args(Cond const &cond, std::string const &name, Rest const &rest = Rest())
               : cond_(cond)
               , name_(name)
               , rest_(rest)
             {}
 
+            // The sorted names of the classes of args
             template<typename Args>
             result_type operator()(Args &args) const
             {
-                result_type res = this->rest_(args);
+                std::vector<std::string> all;
+                this->names(all);
+                return detail::class_names(all, this->mask(args));
+            }
+
+            template<typename Args>
+            class_mask mask(Args &args) const
+            {
+                class_mask const res = this->rest_.mask(args);
                 if(static_cast<bool>(fusion::invoke_function_object(this->cond_, args)))
-                {
-                    // Keep the vector sorted as we build it.
-                    auto it = std::lower_bound(res.begin(), res.end(), this->name_);
-                    res.insert(it, this->name_);
-                }
+                    return res | class_mask(1u) << Rest::size;
                 return res;
             }
 
+            // Append the name of each class, in bit order, to out.
+            void names(std::vector<std::string> &out) const
+            {
+                this->rest_.names(out);
+                out.push_back(this->name_);
+            }
+
         private:
             Cond cond_;
             std::string name_;
             Rest rest_;
         };
 
+        // A type-erased classifier, for property<>
+        template<typename Args>
+        struct any_classifier
+        {
+            typedef std::vector<std::string> result_type;
+
+            any_classifier()
+              : mask_(mask_fun<unclassified_args>(unclassified_args()))
+              , names_()
+            {}
+
+            template<typename Classify>
+            any_classifier(Classify const &classify)
+              : mask_(mask_fun<Classify>(classify))
+              , names_()
+            {
+                classify.names(this->names_);
+            }
+
+            result_type operator()(Args const &args) const
+            {
+                return detail::class_names(this->names_, this->mask_(args));
+            }
+
+            class_mask mask(Args const &args) const
+            {
+                return this->mask_(args);
+            }
+
+            void names(std::vector<std::string> &out) const
+            {
+                out.insert(out.end(), this->names_.begin(), this->names_.end());
+            }
+
+        private:
+            template<typename Classify>
+            struct mask_fun
+            {
+                typedef class_mask result_type;
+
+                explicit mask_fun(Classify const &classify)
+                  : classify_(classify)
+                {}
+
+                class_mask operator()(Args const &args) const
+                {
+                    return this->classify_.mask(args);
+                }
+
+            private:
+                Classify classify_;
+            };
+
+            boost::function<class_mask(Args const &)> mask_;
+            std::vector<std::string> names_;
+        };
+
         struct make_classify_args : proto::callable
         {
             template<typename Sig>
@@ -120,10 +248,22 @@ namespace quick_check
             >
         {};
 
+        // The classifier of a property expression, by value: for one
+        // without classifiers, GetClassifiers returns a reference to the
+        // unclassified_args it is passed.
+        template<typename Expr>
+        struct expr_classifier
+          : boost::remove_const<
+                typename boost::remove_reference<
+                    typename boost::result_of<GetClassifiers(Expr const &, unclassified_args const &)>::type
+                >::type
+            >
+        {};
+
         template<typename Expr>
         typename boost::lazy_enable_if<
             proto::is_expr<Expr>
-          , boost::result_of<GetClassifiers(Expr const &, unclassified_args const &)>
+          , expr_classifier<Expr>
         >::type
         get_classifier(Expr const & prop)
         {
@@ -150,6 +290,13 @@ namespace quick_check
             return prop.classifier();
         }
 #endif
+
+        template<typename Args, typename Group>
+        typename property_view<Args, Group>::classifier_type
+        get_classifier(property_view<Args, Group> const &prop)
+        {
+            return prop.classifier();
+        }
     }
 
     /// \brief Associate input parameters that satisfy a predicate with a
@@ -205,7 +352,8 @@ namespace quick_check
     /// As in the above example, you may specify multiple classifiers.
     /// A given set of input parameters may satisfy more than one
     /// classification criterion; in that case, the class names of all
-    /// the matching classification criteria are displayed.
+    /// the matching classification criteria are displayed. A property may
+    /// have at most 64 classifiers.
     template<typename Expr>
     typename proto::result_of::make_expr<
         detail::classify_
@@ -17,6 +17,11 @@
 #include <boost/quick_check/quick_check_fwd.hpp>
 #include <boost/proto/make_expr.hpp>
 #include <boost/phoenix/core/actor.hpp>
+#include <boost/mpl/size_t.hpp>
+#include <boost/mpl/bitor.hpp>
+#include <boost/is_placeholder.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+#include <boost/type_traits/remove_reference.hpp>
 #include <boost/quick_check/detail/grammar.hpp>
 #include <boost/fusion/functional/invocation/invoke_function_object.hpp>
 
@@ -52,6 +57,61 @@ namespace quick_check
             Fun fun_;
         };
 
+        template<typename Placeholder>
+        struct placeholder_bit
+          : mpl::size_t<
+                std::size_t(1) << (
+                    boost::is_placeholder<
+                        typename boost::remove_cv<
+                            typename boost::remove_reference<Placeholder>::type
+                        >::type
+                    >::value - 1
+                )
+            >
+        {};
+
+        // A mask of the placeholders used in a Phoenix expression, with bit
+        // I-1 set for _I.
+        struct PlaceholderMask
+          : proto::or_<
+                proto::when<
+                    proto::and_<
+                        proto::terminal<proto::_>
+                      , proto::if_<boost::is_placeholder<proto::_value>()>
+                    >
+                  , placeholder_bit<proto::_value>()
+                >
+              , proto::when<
+                    proto::terminal<proto::_>
+                  , mpl::size_t<0>()
+                >
+              , proto::otherwise<
+                    proto::fold<
+                        proto::_
+                      , mpl::size_t<0>()
+                      , mpl::bitor_<PlaceholderMask, proto::_state>()
+                    >
+                >
+            >
+        {};
+
+        // The arguments whose values a condition depends on, as a mask with
+        // bit I-1 set for _I. All of them, unless the condition is known.
+        template<typename Condition>
+        struct condition_mask
+          : mpl::size_t<~std::size_t(0)>
+        {};
+
+        template<>
+        struct condition_mask<unconditional>
+          : mpl::size_t<0>
+        {};
+
+        template<typename Fun>
+        struct condition_mask<condition_args<Fun> >
+          : mpl::size_t<boost::result_of<PlaceholderMask(Fun const &)>::type::value>
+        {};
+
         struct GetCondition
           : proto::or_<
                 proto::when<
@@ -94,6 +154,13 @@ namespace quick_check
             return prop.condition();
         }
 #endif
+
+        template<typename Args, typename Group>
+        typename property_view<Args, Group>::condition_type
+        get_condition(property_view<Args, Group> const &prop)
+        {
+            return prop.condition();
+        }
     }
 }
 
@@ -15,7 +15,16 @@
 #ifndef QCHK_CONFIG_HPP_INCLUDED
 #define QCHK_CONFIG_HPP_INCLUDED
 
+#include <limits>
+#include <atomic>
+#include <chrono>
+#include <vector>
 #include <utility>
+#include <iterator>
+#include <algorithm>
+#include <boost/assert.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/optional.hpp>
 #include <boost/preprocessor/punctuation/comma_if.hpp>
 #include <boost/mpl/size_t.hpp>
 #include <boost/mpl/accumulate.hpp>
@@ -26,6 +35,7 @@
 #include <boost/mpl/identity.hpp>
 #include <boost/mpl/assert.hpp>
 #include <boost/mpl/quote.hpp>
+#include <boost/mpl/not.hpp>
 #include <boost/fusion/mpl.hpp>
 #include <boost/utility/enable_if.hpp>
 #include <boost/fusion/container/vector.hpp>
@@ -37,15 +47,29 @@
 #include <boost/fusion/sequence/intrinsic/has_key.hpp>
 #include <boost/fusion/sequence/intrinsic/value_at_key.hpp>
 #include <boost/fusion/algorithm/query/find_if.hpp>
+#include <boost/fusion/sequence/intrinsic/end.hpp>
 #include <boost/fusion/algorithm/transformation/join.hpp>
 #include <boost/fusion/algorithm/transformation/push_front.hpp>
 #include <boost/fusion/algorithm/transformation/transform.hpp>
 #include <boost/fusion/algorithm/transformation/filter_if.hpp>
 #include <boost/fusion/algorithm/iteration/accumulate.hpp>
+#include <boost/fusion/algorithm/iteration/for_each.hpp>
+#include <boost/fusion/sequence/intrinsic/at_c.hpp>
+#include <boost/fusion/sequence/intrinsic/value_at.hpp>
+#include <boost/move/utility.hpp>
 #include <boost/fusion/adapted/mpl.hpp>
 #include <boost/quick_check/quick_check_fwd.hpp>
 #include <boost/quick_check/generator.hpp>
+#include <boost/quick_check/qcheck_stats.hpp>
+#include <boost/quick_check/failure_sink.hpp>
+#include <boost/quick_check/size_schedule.hpp>
+#include <boost/quick_check/detail/enumerate.hpp>
 #include <boost/quick_check/detail/functional.hpp>
+#include <boost/quick_check/detail/random.hpp>
+#include <boost/quick_check/detail/shrink.hpp>
+#include <boost/quick_check/generator/basic_generator.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/is_default_constructible.hpp>
 #include <boost/type_traits/remove_reference.hpp>
 #include <boost/type_traits/remove_const.hpp>
 #include <boost/type_traits/add_const.hpp>
@@ -62,6 +86,18 @@ namespace quick_check
         struct test_count_ {};
         struct max_test_count_ {};
         struct sized_ {};
+        struct seed_ {};
+        struct max_failures_ {};
+        struct max_shrinks_ {};
+        struct max_shrink_time_ {};
+        struct stats_ {};
+        struct partial_redraw_ {};
+        struct rejection_monitor_ {};
+        struct failure_sink_ {};
+        struct size_schedule_ {};
+        struct time_budget_ {};
+        struct exhaustive_ {};
+        struct dedupe_ {};
 
         struct PhxPlaceholder
           : proto::and_<
@@ -169,6 +205,12 @@ namespace quick_check
             {
                 return fusion::at_key<Placeholder>(map)(rng);
             }
+
+            template<typename OutIter>
+            static OutIter call_n(Map &map, Rng &rng, OutIter out, std::size_t n)
+            {
+                return detail::generate_n_adl(fusion::at_key<Placeholder>(map), rng, out, n);
+            }
         };
 
         template<typename Map, typename Rng, typename Placeholder, int I>
@@ -179,6 +221,12 @@ namespace quick_check
             {
                 return my_value_at_key<Map, Rng, phoenix::argument<I> >::call(map, rng);
             }
+
+            template<typename OutIter>
+            static OutIter call_n(Map &map, Rng &rng, OutIter out, std::size_t n)
+            {
+                return my_value_at_key<Map, Rng, phoenix::argument<I> >::call_n(map, rng, out, n);
+            }
         };
 
         template<typename Map, typename Rng, typename Placeholder>
@@ -189,6 +237,12 @@ namespace quick_check
             {
                 return fusion::void_();
             }
+
+            template<typename OutIter>
+            static OutIter call_n(Map &, Rng &, OutIter out, std::size_t n)
+            {
+                return std::fill_n(out, n, fusion::void_());
+            }
         };
 
         template<typename T>
@@ -247,6 +301,588 @@ namespace quick_check
             Rng &rng_;
         };
 
+        template<typename Map
+               , typename Placeholder
+               , typename ValueAtKey = typename safe_value_at_key<Map, Placeholder>::type>
+        struct shrink_at_key
+        {
+            template<typename Value>
+            static void call(Map &map, Value const &value, std::vector<Value> &out)
+            {
+                detail::shrink_adl(fusion::at_key<Placeholder>(map), value, out);
+            }
+        };
+
+        template<typename Map, typename Placeholder, int I>
+        struct shrink_at_key<Map, Placeholder, phoenix::argument<I> >
+          : shrink_at_key<Map, phoenix::argument<I> >
+        {};
+
+        template<typename Map, typename Placeholder>
+        struct shrink_at_key<Map, Placeholder, fusion::void_>
+        {
+            template<typename Value>
+            static void call(Map &, Value const &, std::vector<Value> &)
+            {}
+        };
+
+        template<typename Map
+               , typename Rng
+               , typename Placeholder
+               , typename ValueAtKey = typename safe_value_at_key<Map, Placeholder>::type>
+        struct mutate_at_key
+        {
+            template<typename Value>
+            static void call(Map &map, Rng &rng, Value &value)
+            {
+                detail::mutate_adl(fusion::at_key<Placeholder>(map), rng, value);
+            }
+        };
+
+        template<typename Map, typename Rng, typename Placeholder, int I>
+        struct mutate_at_key<Map, Rng, Placeholder, phoenix::argument<I> >
+          : mutate_at_key<Map, Rng, phoenix::argument<I> >
+        {};
+
+        template<typename Map, typename Rng, typename Placeholder>
+        struct mutate_at_key<Map, Rng, Placeholder, fusion::void_>
+        {
+            template<typename Value>
+            static void call(Map &, Rng &, Value &)
+            {}
+        };
+
+        template<typename Map
+               , typename Placeholder
+               , typename ValueAtKey = typename safe_value_at_key<Map, Placeholder>::type>
+        struct shrink_each_at_key
+        {
+            template<typename Value, typename Fun>
+            static bool call(Map &map, Value const &value, Fun &fun)
+            {
+                return detail::shrink_each_adl(fusion::at_key<Placeholder>(map), value, fun);
+            }
+        };
+
+        template<typename Map, typename Placeholder, int I>
+        struct shrink_each_at_key<Map, Placeholder, phoenix::argument<I> >
+          : shrink_each_at_key<Map, phoenix::argument<I> >
+        {};
+
+        template<typename Map, typename Placeholder>
+        struct shrink_each_at_key<Map, Placeholder, fusion::void_>
+        {
+            template<typename Value, typename Fun>
+            static bool call(Map &, Value const &, Fun &)
+            {
+                return false;
+            }
+        };
+
+        template<typename Map
+               , typename Rng
+               , typename Placeholder
+               , typename ValueAtKey = typename safe_value_at_key<Map, Placeholder>::type>
+        struct generate_at_key
+        {
+            template<typename Value>
+            static void call(Map &map, Rng &rng, Value &value)
+            {
+                detail::generate_into_adl(fusion::at_key<Placeholder>(map), rng, value);
+            }
+        };
+
+        template<typename Map, typename Rng, typename Placeholder, int I>
+        struct generate_at_key<Map, Rng, Placeholder, phoenix::argument<I> >
+          : generate_at_key<Map, Rng, phoenix::argument<I> >
+        {};
+
+        template<typename Map, typename Rng, typename Placeholder>
+        struct generate_at_key<Map, Rng, Placeholder, fusion::void_>
+        {
+            template<typename Value>
+            static void call(Map &, Rng &, Value &)
+            {}
+        };
+
+        template<typename Map
+               , typename Placeholder
+               , typename ValueAtKey = typename safe_value_at_key<Map, Placeholder>::type>
+        struct enumerate_at_key
+        {
+            static std::size_t size(Map const &map)
+            {
+                return detail::domain_size_adl(fusion::at_key<Placeholder>(map));
+            }
+
+            template<typename Value>
+            static void call(Map &map, std::size_t index, Value &value)
+            {
+                detail::enumerate_adl(fusion::at_key<Placeholder>(map), index, value);
+            }
+        };
+
+        template<typename Map, typename Placeholder, int I>
+        struct enumerate_at_key<Map, Placeholder, phoenix::argument<I> >
+          : enumerate_at_key<Map, phoenix::argument<I> >
+        {};
+
+        template<typename Map, typename Placeholder>
+        struct enumerate_at_key<Map, Placeholder, fusion::void_>
+        {
+            static std::size_t size(Map const &)
+            {
+                return 1;
+            }
+
+            template<typename Value>
+            static void call(Map &, std::size_t, Value &)
+            {}
+        };
+
+        // Multiply together the domain sizes of the generators of the
+        // arguments.
+        template<typename Map>
+        struct domain_size_fun
+        {
+            typedef void result_type;
+
+            domain_size_fun(Map const &map, std::size_t &size)
+              : map_(map)
+              , size_(size)
+            {}
+
+            template<int I>
+            void operator()(phoenix::argument<I>) const
+            {
+                this->size_ = detail::domain_product(
+                    this->size_
+                  , detail::enumerate_at_key<Map, phoenix::argument<I> >::size(this->map_)
+                );
+            }
+
+        private:
+            domain_size_fun &operator=(domain_size_fun const &);
+            Map const &map_;
+            std::size_t &size_;
+        };
+
+        // Replace the first count values of the column of each argument with
+        // their values in the elements of the domain with indices first,
+        // first + stride, and so on. divisor is the product of the domain
+        // sizes of the arguments already done.
+        template<typename Map, typename Columns>
+        struct enumerate_column_fun
+        {
+            typedef void result_type;
+
+            enumerate_column_fun(Map &map, Columns &columns, std::size_t first,
+                                 std::size_t stride, std::size_t count, std::size_t &divisor)
+              : map_(map)
+              , columns_(columns)
+              , first_(first)
+              , stride_(stride)
+              , count_(count)
+              , divisor_(divisor)
+            {}
+
+            template<int I>
+            void operator()(phoenix::argument<I>) const
+            {
+                typedef detail::enumerate_at_key<Map, phoenix::argument<I> > enumerate_type;
+                std::size_t const size = enumerate_type::size(this->map_);
+                auto &column = fusion::at_c<I - 1>(this->columns_);
+                for(std::size_t i = 0; i < this->count_; ++i)
+                {
+                    std::size_t const index = this->first_ + i * this->stride_;
+                    typename std::decay<decltype(column)>::type::value_type value = column[i];
+                    enumerate_type::call(this->map_, index / this->divisor_ % size, value);
+                    column[i] = boost::move(value);
+                }
+                this->divisor_ *= size;
+            }
+
+        private:
+            enumerate_column_fun &operator=(enumerate_column_fun const &);
+            Map &map_;
+            Columns &columns_;
+            std::size_t first_;
+            std::size_t stride_;
+            std::size_t count_;
+            std::size_t &divisor_;
+        };
+
+        // Replace each argument with its value in the index-th element of the
+        // Cartesian product of the domains of their generators, with the
+        // first argument varying fastest.
+        template<typename Map, typename Args>
+        struct enumerate_fun
+        {
+            typedef void result_type;
+
+            enumerate_fun(Map &map, Args &args, std::size_t &index)
+              : map_(map)
+              , args_(args)
+              , index_(index)
+            {}
+
+            template<int I>
+            void operator()(phoenix::argument<I>) const
+            {
+                typedef detail::enumerate_at_key<Map, phoenix::argument<I> > enumerate_type;
+                std::size_t const size = enumerate_type::size(this->map_);
+                enumerate_type::call(this->map_, this->index_ % size, fusion::at_c<I - 1>(this->args_));
+                this->index_ /= size;
+            }
+
+        private:
+            enumerate_fun &operator=(enumerate_fun const &);
+            Map &map_;
+            Args &args_;
+            std::size_t &index_;
+        };
+
+        // Whether each of args can be default-constructed, so that a set of
+        // arguments can be enumerated without being generated first.
+        template<typename Args>
+        struct all_default_constructible
+          : boost::is_same<
+                typename fusion::result_of::find_if<
+                    Args const
+                  , mpl::not_<boost::is_default_constructible<mpl::_> >
+                >::type
+              , typename fusion::result_of::end<Args const>::type
+            >
+        {};
+
+        // For each argument in turn, ask the generator that produced it for
+        // simpler values, and append a copy of args with the argument
+        // replaced by each of them.
+        template<typename Map, typename Args>
+        struct shrink_fun
+        {
+            typedef void result_type;
+
+            shrink_fun(Map &map, Args const &args, std::vector<Args> &out)
+              : map_(map)
+              , args_(args)
+              , out_(out)
+            {}
+
+            template<int I>
+            void operator()(phoenix::argument<I>) const
+            {
+                typedef
+                    typename fusion::result_of::value_at_c<Args, I - 1>::type
+                value_type;
+                std::vector<value_type> values;
+                detail::shrink_at_key<Map, phoenix::argument<I> >::call(
+                    this->map_
+                  , fusion::at_c<I - 1>(this->args_)
+                  , values
+                );
+                for(value_type &value : values)
+                {
+                    this->out_.push_back(this->args_);
+                    fusion::at_c<I - 1>(this->out_.back()) = boost::move(value);
+                }
+            }
+
+        private:
+            shrink_fun &operator=(shrink_fun const &);
+            Map &map_;
+            Args const &args_;
+            std::vector<Args> &out_;
+        };
+
+        // Offer fun each candidate of shrink_each_fun's argument I, swapped
+        // into the arguments it was shrunk from.
+        template<int I, typename Args, typename Fun>
+        struct swap_candidate
+        {
+            swap_candidate(Args &args, Fun &fun)
+              : args_(args)
+              , fun_(fun)
+            {}
+
+            template<typename Value>
+            bool operator()(Value &candidate) const
+            {
+                using std::swap;
+                swap(fusion::at_c<I - 1>(this->args_), candidate);
+                shrink_step const step = this->fun_(this->args_);
+                if(step != shrink_keep)
+                    swap(fusion::at_c<I - 1>(this->args_), candidate);
+                return step != shrink_next;
+            }
+
+        private:
+            swap_candidate &operator=(swap_candidate const &);
+            Args &args_;
+            Fun &fun_;
+        };
+
+        // Offer fun the candidates of each argument in turn, until it keeps
+        // one or tells it to stop.
+        template<typename Map, typename Args, typename Fun>
+        struct shrink_each_fun
+        {
+            typedef void result_type;
+
+            shrink_each_fun(Map &map, Args &args, Fun &fun, bool &stopped)
+              : map_(map)
+              , args_(args)
+              , fun_(fun)
+              , stopped_(stopped)
+            {}
+
+            template<int I>
+            void operator()(phoenix::argument<I>) const
+            {
+                typedef
+                    typename fusion::result_of::value_at_c<Args, I - 1>::type
+                value_type;
+                if(this->stopped_)
+                    return;
+                // The candidates are made from a copy, since they are swapped
+                // into the arguments.
+                value_type const value(fusion::at_c<I - 1>(this->args_));
+                swap_candidate<I, Args, Fun> swapper(this->args_, this->fun_);
+                this->stopped_ = detail::shrink_each_at_key<Map, phoenix::argument<I> >::call(
+                    this->map_
+                  , value
+                  , swapper
+                );
+            }
+
+        private:
+            shrink_each_fun &operator=(shrink_each_fun const &);
+            Map &map_;
+            Args &args_;
+            Fun &fun_;
+            bool &stopped_;
+        };
+
+        // Fill the column of each argument with count values drawn from its
+        // generator, one column after the other.
+        template<typename Map, typename Rng, typename Columns>
+        struct column_fun
+        {
+            typedef void result_type;
+
+            column_fun(Map &map, Rng &rng, Columns &columns, std::size_t count)
+              : map_(map)
+              , rng_(rng)
+              , columns_(columns)
+              , count_(count)
+            {}
+
+            template<int I>
+            void operator()(phoenix::argument<I>) const
+            {
+                auto &column = fusion::at_c<I - 1>(this->columns_);
+                column.clear();
+                column.reserve(this->count_);
+                detail::my_value_at_key<Map, Rng, phoenix::argument<I> >::call_n(
+                    this->map_
+                  , this->rng_
+                  , std::back_inserter(column)
+                  , this->count_
+                );
+            }
+
+        private:
+            column_fun &operator=(column_fun const &);
+            Map &map_;
+            Rng &rng_;
+            Columns &columns_;
+            std::size_t count_;
+        };
+
+        // Append each argument of a set of arguments to its column.
+        template<typename Args, typename Columns>
+        struct append_row_fun
+        {
+            typedef void result_type;
+
+            append_row_fun(Args &args, Columns &columns)
+              : args_(args)
+              , columns_(columns)
+            {}
+
+            template<int I>
+            void operator()(phoenix::argument<I>) const
+            {
+                fusion::at_c<I - 1>(this->columns_).push_back(
+                    boost::move(fusion::at_c<I - 1>(this->args_))
+                );
+            }
+
+        private:
+            append_row_fun &operator=(append_row_fun const &);
+            Args &args_;
+            Columns &columns_;
+        };
+
+        // Replace the arguments whose bits are set in mask with new values
+        // drawn from their generators.
+        template<typename Map, typename Rng, typename Args>
+        struct redraw_fun
+        {
+            typedef void result_type;
+
+            redraw_fun(Map &map, Rng &rng, Args &args, std::size_t mask)
+              : map_(map)
+              , rng_(rng)
+              , args_(args)
+              , mask_(mask)
+            {}
+
+            template<int I>
+            void operator()(phoenix::argument<I>) const
+            {
+                if(this->mask_ >> (I - 1) & 1u)
+                    fusion::at_c<I - 1>(this->args_) =
+                        detail::my_value_at_key<Map, Rng, phoenix::argument<I> >::call(
+                            this->map_
+                          , this->rng_
+                        );
+            }
+
+        private:
+            redraw_fun &operator=(redraw_fun const &);
+            Map &map_;
+            Rng &rng_;
+            Args &args_;
+            std::size_t mask_;
+        };
+
+        // Generate every argument in place, reusing its storage.
+        template<typename Map, typename Rng, typename Args>
+        struct generate_into_fun
+        {
+            typedef void result_type;
+
+            generate_into_fun(Map &map, Rng &rng, Args &args)
+              : map_(map)
+              , rng_(rng)
+              , args_(args)
+            {}
+
+            template<int I>
+            void operator()(phoenix::argument<I>) const
+            {
+                detail::generate_at_key<Map, Rng, phoenix::argument<I> >::call(
+                    this->map_
+                  , this->rng_
+                  , fusion::at_c<I - 1>(this->args_)
+                );
+            }
+
+        private:
+            generate_into_fun &operator=(generate_into_fun const &);
+            Map &map_;
+            Rng &rng_;
+            Args &args_;
+        };
+
+        // Replace the arguments whose bits are set in mask with variations
+        // made by their generators.
+        template<typename Map, typename Rng, typename Args>
+        struct mutate_fun
+        {
+            typedef void result_type;
+
+            mutate_fun(Map &map, Rng &rng, Args &args, std::size_t mask)
+              : map_(map)
+              , rng_(rng)
+              , args_(args)
+              , mask_(mask)
+            {}
+
+            template<int I>
+            void operator()(phoenix::argument<I>) const
+            {
+                if(this->mask_ >> (I - 1) & 1u)
+                    detail::mutate_at_key<Map, Rng, phoenix::argument<I> >::call(
+                        this->map_
+                      , this->rng_
+                      , fusion::at_c<I - 1>(this->args_)
+                    );
+            }
+
+        private:
+            mutate_fun &operator=(mutate_fun const &);
+            Map &map_;
+            Rng &rng_;
+            Args &args_;
+            std::size_t mask_;
+        };
+
+        struct clear_column
+        {
+            typedef void result_type;
+
+            template<typename Column>
+            void operator()(Column &column) const
+            {
+                column.clear();
+            }
+        };
+
+        // A SeedSeq whose output is a pure function of a base seed and the
+        // index of a test case. Used to reseed the random number generator
+        // before generating each case of a seeded config.
+        struct case_seed_seq
+        {
+            typedef boost::uint32_t result_type;
+
+            case_seed_seq(boost::uint64_t seed, boost::uint64_t index)
+              : state_(detail::mix64(seed ^ detail::mix64(index + 0x9E3779B97F4A7C15ull)))
+            {}
+
+            template<typename Iter>
+            void generate(Iter first, Iter last)
+            {
+                for(; first != last; ++first)
+                {
+                    this->state_ += 0x9E3779B97F4A7C15ull;
+                    *first = static_cast<boost::uint32_t>(detail::mix64(this->state_) >> 32);
+                }
+            }
+
+        private:
+            boost::uint64_t state_;
+        };
+
+        template<typename Rng>
+        auto reseed_rng(Rng &rng, case_seed_seq &seq, int)
+        QCHK_RETURN(
+            rng.seed(seq)
+        )
+
+        // Only reached by configs that are not seeded: make_config() rejects
+        // _seed for a random number generator that can_reseed says no to.
+        template<typename Rng>
+        void reseed_rng(Rng &, case_seed_seq &, long)
+        {
+            BOOST_ASSERT_MSG(false, "_seed requires a random number generator that "
+                                    "can be seeded from a SeedSeq");
+        }
+
+        template<typename Rng, typename Enable = void>
+        struct can_reseed
+          : mpl::false_
+        {};
+
+        template<typename Rng>
+        struct can_reseed<
+            Rng
+          , decltype(void(boost::declval<Rng &>().seed(boost::declval<case_seed_seq &>())))
+        >
+          : mpl::true_
+        {};
+
         template<typename Key, typename Callable = proto::callable>
         struct KeyValue
           : proto::when<
@@ -262,6 +898,18 @@ namespace quick_check
         typedef KeyValue<test_count_> TestCountValue;
         typedef KeyValue<max_test_count_> MaxTestCountValue;
         typedef KeyValue<sized_> SizedValue;
+        typedef KeyValue<seed_> SeedValue;
+        typedef KeyValue<max_failures_> MaxFailuresValue;
+        typedef KeyValue<max_shrinks_> MaxShrinksValue;
+        typedef KeyValue<max_shrink_time_> MaxShrinkTimeValue;
+        typedef KeyValue<stats_> StatsValue;
+        typedef KeyValue<partial_redraw_> PartialRedrawValue;
+        typedef KeyValue<rejection_monitor_> RejectionMonitorValue;
+        typedef KeyValue<failure_sink_> FailureSinkValue;
+        typedef KeyValue<size_schedule_> SizeScheduleValue;
+        typedef KeyValue<time_budget_> TimeBudgetValue;
+        typedef KeyValue<exhaustive_> ExhaustiveValue;
+        typedef KeyValue<dedupe_> DedupeValue;
 
         template<typename Expr>
         struct is_rng_collection
@@ -297,15 +945,27 @@ namespace quick_check
         }
     }
 
+    /// Values for use with \c quick_check::_rejection_monitor, which say what
+    /// \c quick_check::qcheck() does when its property's condition rejects so
+    /// many test cases that \c _test_count tests cannot be run within
+    /// \c _max_test_count generated ones.
+    enum rejection_monitor
+    {
+        ignore_rejections   ///< Carry on regardless. This is the default.
+      , warn_on_rejections  ///< Write a warning to \c std::cerr, once, and carry on.
+      , stop_on_rejections  ///< Stop testing, and report that the input was exhausted.
+    };
+
     /// \brief A structure that holds all the test configuration information
     /// for use with the \c quick_check::qcheck() algorithm.
     ///
     /// \tparam Map \em unspecified
     /// \tparam Rng \em unspecified
+    /// \tparam Stats Either \c quick_check::no_stats or \c quick_check::collect_stats.
     ///
     /// You will typically not create objects of type \c config\<\> directly; rather,
     /// you will use the \c quick_check::make_config() helper to do it for you.
-    template<typename Map, typename Rng>
+    template<typename Map, typename Rng, typename Stats>
     struct config
     {
     private:
@@ -334,6 +994,22 @@ namespace quick_check
             >::type
         result_type;
 
+        /// The type filled in by \c quick_check::config::generate(). A
+        /// Fusion sequence holding, for each argument in \c result_type, a
+        /// \c std::vector of values of that argument's type.
+        typedef
+            typename fusion::result_of::as_vector<
+                typename mpl::transform<
+                    result_type
+                  , std::vector<mpl::_1>
+                >::type
+            >::type
+        columns_type;
+
+        /// The policy that says whether \c quick_check::qcheck() and friends
+        /// collect \c quick_check::qcheck_stats, as specified with \c _stats.
+        typedef Stats stats_policy;
+
         /// Construct a \c config object
         ///
         /// \param map \em unspecified
@@ -341,20 +1017,75 @@ namespace quick_check
         /// \param test_count The maximum number of tests to run.
         /// \param max_test_count The maximum number of inputs to generate.
         /// \param sized Used to control the size of any generated sequences.
+        /// \param seed If set, the base seed from which each test case's
+        ///             random number generator is seeded.
+        /// \param max_failures The number of failures after which to stop testing.
+        /// \param max_shrinks The maximum number of evaluations to spend
+        ///                    shrinking a failing input.
+        /// \param max_shrink_time The maximum time to spend shrinking a
+        ///                        failing input.
+        /// \param partial_redraw Whether to redraw only the arguments that the
+        ///                       condition uses after it rejects a test case.
+        /// \param rejection_monitor What to do when the condition rejects too
+        ///                          many test cases.
+        /// \param failure_sink Which failures to keep, and where to send them.
+        /// \param size_schedule The size to generate each test case with, if
+        ///                      it isn't \c sized throughout.
+        /// \param time_budget How long to keep testing once \c test_count
+        ///                    tests have been run.
+        /// \param exhaustive Whether to enumerate the values of the arguments
+        ///                   rather than sample them, if there are no more
+        ///                   than \c test_count combinations of them.
+        /// \param dedupe Whether to skip the test cases whose arguments have
+        ///               already been tested.
         config(
             Map const &map
           , Rng const &rng
           , std::size_t test_count
           , std::size_t max_test_count
           , std::size_t sized
+          , boost::optional<boost::uint64_t> const &seed = boost::none
+          , std::size_t max_failures = (std::numeric_limits<std::size_t>::max)()
+          , std::size_t max_shrinks = 1000u
+          , std::chrono::steady_clock::duration max_shrink_time =
+                std::chrono::steady_clock::duration::max()
+          , bool partial_redraw = false
+          , quick_check::rejection_monitor rejection_monitor = ignore_rejections
+          , quick_check::failure_sink const &failure_sink = quick_check::failure_sink()
+          , quick_check::size_schedule const &size_schedule = quick_check::size_schedule()
+          , std::chrono::steady_clock::duration time_budget =
+                std::chrono::steady_clock::duration::zero()
+          , bool exhaustive = false
+          , bool dedupe = false
         )
           : map_(map)
           , rng_(rng)
           , test_count_(test_count)
           , max_test_count_(std::max(test_count, max_test_count))
           , sized_(sized)
+          , max_failures_((std::max)(max_failures, std::size_t(1)))
+          , max_shrinks_(max_shrinks)
+          , max_shrink_time_(max_shrink_time)
+          , seed_(seed)
+          , next_case_(0)
+          , case_stride_(1)
+          , partial_redraw_(partial_redraw)
+          , rejection_monitor_(rejection_monitor)
+          , failure_sink_(failure_sink)
+          , size_schedule_(size_schedule.over(test_count))
+          , time_budget_(time_budget)
+          , exhaustive_(exhaustive)
+          , enumerated_(0)
+          , dedupe_(dedupe)
+          , shared_failures_(0)
         {
             this->resized(sized);
+            // The domain is measured once, rather than for each test case.
+            if(this->exhaustive_)
+            {
+                std::size_t const size = this->domain_size();
+                this->enumerated_ = size <= test_count ? size : 0;
+            }
         }
 
         /// Returns the value of \c test_count passed to the constructor
@@ -369,12 +1100,123 @@ namespace quick_check
             return this->max_test_count_;
         }
 
-        /// Returns the value of \c sized passed to the constructor
+        /// Returns the value of \c sized passed to the constructor, or the
+        /// size of the last test case generated, if there is a size schedule
         std::size_t sized() const
         {
             return this->sized_;
         }
 
+        /// Returns the value of \c max_failures passed to the constructor, or
+        /// 1 if it was 0
+        std::size_t max_failures() const
+        {
+            return this->max_failures_;
+        }
+
+        /// Returns the value of \c max_shrinks passed to the constructor
+        std::size_t max_shrinks() const
+        {
+            return this->max_shrinks_;
+        }
+
+        /// Returns the value of \c max_shrink_time passed to the constructor
+        std::chrono::steady_clock::duration max_shrink_time() const
+        {
+            return this->max_shrink_time_;
+        }
+
+        /// Returns the value of \c partial_redraw passed to the constructor
+        bool partial_redraw() const
+        {
+            return this->partial_redraw_;
+        }
+
+        /// Returns the value of \c rejection_monitor passed to the constructor
+        quick_check::rejection_monitor rejection_monitor() const
+        {
+            return this->rejection_monitor_;
+        }
+
+        /// Returns the value of \c failure_sink passed to the constructor
+        quick_check::failure_sink const &failure_sink() const
+        {
+            return this->failure_sink_;
+        }
+
+        /// Returns the value of \c size_schedule passed to the constructor. If
+        /// its length was 0, it is \c test_count.
+        quick_check::size_schedule const &size_schedule() const
+        {
+            return this->size_schedule_;
+        }
+
+        /// Returns the value of \c time_budget passed to the constructor
+        std::chrono::steady_clock::duration time_budget() const
+        {
+            return this->time_budget_;
+        }
+
+        /// Returns the value of \c exhaustive passed to the constructor
+        bool exhaustive() const
+        {
+            return this->exhaustive_;
+        }
+
+        /// Returns the number of distinct sets of input parameters, which is
+        /// the product of what the \c domain_size() customization point
+        /// returns for the generator of each argument, or 0 if any of them
+        /// returns 0 or the product doesn't fit in a \c std::size_t.
+        ///
+        /// \sa \c quick_check::domain_size
+        std::size_t domain_size() const
+        {
+            std::size_t size = 1;
+            fusion::for_each(indices_type(), detail::domain_size_fun<Map>(this->map_, size));
+            return size;
+        }
+
+        /// Returns \c this->domain_size() if \c this->exhaustive() and the
+        /// domain is no larger than \c test_count, and 0 otherwise. The test
+        /// cases with indices below it are enumerated rather than sampled: the
+        /// one with index \c i is the \c i-th element of the Cartesian
+        /// product of the domains of the arguments, with the first argument
+        /// varying fastest.
+        ///
+        /// \sa \c quick_check::_exhaustive
+        std::size_t enumerated() const
+        {
+            return this->enumerated_;
+        }
+
+        /// Returns the value of \c dedupe passed to the constructor
+        bool dedupe() const
+        {
+            return this->dedupe_;
+        }
+
+        /// Returns true if a base seed was specified with \c _seed
+        bool seeded() const
+        {
+            return !!this->seed_;
+        }
+
+        /// Returns the base seed specified with \c _seed
+        ///
+        /// \pre <tt>this->seeded()</tt>
+        boost::uint64_t seed() const
+        {
+            BOOST_ASSERT(this->seeded());
+            return this->seed_.get();
+        }
+
+        /// Returns the index of the test case that the next call to
+        /// \c operator()() will generate.
+        std::size_t next_case() const
+        {
+            return this->next_case_;
+        }
+
         /// Sets the sized property of any internally stored generators
         void resized(std::size_t sized)
         {
@@ -388,29 +1230,291 @@ namespace quick_check
 
         /// Generates a new, random set of input parameters for use
         /// when evaluating a property.
+        ///
+        /// If \c this->seeded(), the parameters are a pure function of
+        /// \c this->seed() and \c this->next_case(), provided the generators
+        /// themselves keep no state between invocations.
         result_type operator()()
         {
-            return fusion::as_vector(
+            std::size_t const index = this->next_case_;
+            this->next_case_ += this->case_stride_;
+            return (*this)(index);
+        }
+
+        /// Regenerates the set of input parameters for the test case with
+        /// index \c case_index, as reported by \c qcheck_args::case_index().
+        /// The cost is independent of \c case_index.
+        ///
+        /// If <tt>!this->seeded()</tt>, this is equivalent to <tt>(*this)()</tt>,
+        /// unless \c case_index is below \c this->enumerated().
+        result_type operator()(std::size_t case_index)
+        {
+            this->schedule_size_(case_index);
+            if(case_index < this->enumerated_)
+                return this->enumerated_case_(
+                    case_index
+                  , typename detail::all_default_constructible<result_type>::type()
+                );
+            if(this->seed_)
+            {
+                detail::case_seed_seq seq(this->seed_.get(), case_index);
+                detail::reseed_rng(this->rng_, seq, 1);
+            }
+            result_type args = fusion::as_vector(
                 fusion::transform(
                     indices_type()
                   , detail::index_fun<Map, Rng>(this->map_, this->rng_)
                 )
             );
+            return args;
+        }
+
+        /// Generates a new set of input parameters into \c args, like
+        /// <tt>args = (*this)()</tt> but in place: each argument is
+        /// overwritten by the \c generate_into() customization point of its
+        /// generator, which may reuse its storage, so that a test run that
+        /// keeps one set of arguments allocates nothing once the containers
+        /// among them have grown to size.
+        ///
+        /// If \c this->seeded(), this is <tt>args = (*this)()</tt>, so that
+        /// the test case can be regenerated from its index. Otherwise, the
+        /// arguments are drawn one after the other, in order, so they have the
+        /// same distribution as those <tt>(*this)()</tt> generates, but not
+        /// necessarily the same values.
+        ///
+        /// \sa \c quick_check::generate_into
+        void operator()(result_type &args)
+        {
+            if(this->seed_)
+            {
+                args = (*this)();
+                return;
+            }
+            std::size_t const case_index = this->next_case_;
+            this->next_case_ += this->case_stride_;
+            this->schedule_size_(case_index);
+            if(case_index < this->enumerated_)
+            {
+                this->enumerate_(args, case_index);
+                return;
+            }
+            fusion::for_each(
+                indices_type()
+              , detail::generate_into_fun<Map, Rng, result_type>(this->map_, this->rng_, args)
+            );
+        }
+
+        /// Replaces the arguments in \c args that the bits of \c mask select
+        /// with new values drawn from their generators, leaving the others
+        /// alone. Bit \c i selects the placeholder <tt>_(i+1)</tt>. Like
+        /// \c operator()(), this counts as generating the test case with index
+        /// \c this->next_case().
+        ///
+        /// \pre <tt>!this->seeded()</tt>
+        void redraw(result_type &args, std::size_t mask)
+        {
+            BOOST_ASSERT_MSG(!this->seed_, "A seeded config cannot redraw some of the arguments "
+                                           "of a test case");
+            this->schedule_size_(this->next_case_);
+            this->next_case_ += this->case_stride_;
+            fusion::for_each(
+                indices_type()
+              , detail::redraw_fun<Map, Rng, result_type>(this->map_, this->rng_, args, mask)
+            );
+        }
+
+        /// Replaces the arguments in \c args that the bits of \c mask select
+        /// with variations of their values, made by the \c mutate()
+        /// customization point of their generators. Bit \c i selects the
+        /// placeholder <tt>_(i+1)</tt>. Like \c operator()(), this counts as
+        /// generating the test case with index \c this->next_case().
+        ///
+        /// If \c this->seeded(), the variations are a pure function of
+        /// \c args, \c mask, \c this->seed() and \c this->next_case().
+        ///
+        /// \sa \c quick_check::mutate
+        void mutate(result_type &args, std::size_t mask)
+        {
+            std::size_t const index = this->next_case_;
+            this->next_case_ += this->case_stride_;
+            this->schedule_size_(index);
+            if(this->seed_)
+            {
+                detail::case_seed_seq seq(this->seed_.get(), index);
+                detail::reseed_rng(this->rng_, seq, 1);
+            }
+            fusion::for_each(
+                indices_type()
+              , detail::mutate_fun<Map, Rng, result_type>(this->map_, this->rng_, args, mask)
+            );
+        }
+
+        /// Generates a block of \c count sets of input parameters, the \c i-th
+        /// of which is made up of the \c i-th element of each column of
+        /// \c columns. Any values already in \c columns are discarded. The
+        /// block holds the test cases from \c this->next_case() onwards.
+        ///
+        /// If \c this->seeded(), the block holds the same values as \c count
+        /// calls to \c operator()(). Otherwise, each column is filled in turn
+        /// with a single call to the \c generate_n() customization point of
+        /// its generator, so the values differ from those \c operator()()
+        /// would have generated.
+        ///
+        /// \sa \c quick_check::generate_n
+        void generate(columns_type &columns, std::size_t count)
+        {
+            if(this->seed_)
+            {
+                fusion::for_each(columns, detail::clear_column());
+                for(std::size_t i = 0; i < count; ++i)
+                {
+                    result_type args = (*this)();
+                    fusion::for_each(
+                        indices_type()
+                      , detail::append_row_fun<result_type, columns_type>(args, columns)
+                    );
+                }
+            }
+            else
+            {
+                this->schedule_size_(this->next_case_);
+                fusion::for_each(
+                    indices_type()
+                  , detail::column_fun<Map, Rng, columns_type>(this->map_, this->rng_, columns, count)
+                );
+                if(this->exhaustive_)
+                    this->enumerate_rows_(columns, count);
+                this->next_case_ += count * this->case_stride_;
+            }
+        }
+
+        /// Appends to \c candidates copies of \c args in which one argument has
+        /// been replaced with a simpler value, as reported by the \c shrink()
+        /// customization point of the generator that produced it.
+        ///
+        /// \sa \c quick_check::shrink
+        void shrink(result_type const &args, std::vector<result_type> &candidates)
+        {
+            fusion::for_each(
+                indices_type()
+              , detail::shrink_fun<Map, result_type>(this->map_, args, candidates)
+            );
+        }
+
+        /// Offers \c fun the same candidates as \c shrink(), in the same
+        /// order, but one at a time, as they are made by the
+        /// \c shrink_each() customization point of each generator. Each
+        /// candidate is swapped into \c args for the call <tt>fun(args)</tt>,
+        /// which returns a \c detail::shrink_step. Unless it is \c shrink_keep, the
+        /// argument is swapped back. Unless it is \c shrink_next, no more
+        /// candidates are made.
+        ///
+        /// \return false if \c fun was offered every candidate and returned
+        /// \c shrink_next for all of them, and true otherwise.
+        ///
+        /// \sa \c quick_check::shrink_each
+        template<typename Fun>
+        bool shrink_each(result_type &args, Fun &fun)
+        {
+            bool stopped = false;
+            fusion::for_each(
+                indices_type()
+              , detail::shrink_each_fun<Map, result_type, Fun>(this->map_, args, fun, stopped)
+            );
+            return stopped;
         }
 
     private:
+        friend struct detail::qcheck_access;
+
+        // Replace args with the case_index-th element of the domain.
+        void enumerate_(result_type &args, std::size_t case_index)
+        {
+            fusion::for_each(
+                indices_type()
+              , detail::enumerate_fun<Map, result_type>(this->map_, args, case_index)
+            );
+        }
+
+        // The test case case_index of the enumerated domain, made without
+        // drawing from the random number generator if the arguments can be
+        // default-constructed.
+        result_type enumerated_case_(std::size_t case_index, boost::true_type)
+        {
+            result_type args;
+            this->enumerate_(args, case_index);
+            return args;
+        }
+
+        result_type enumerated_case_(std::size_t case_index, boost::false_type)
+        {
+            result_type args = fusion::as_vector(
+                fusion::transform(
+                    indices_type()
+                  , detail::index_fun<Map, Rng>(this->map_, this->rng_)
+                )
+            );
+            this->enumerate_(args, case_index);
+            return args;
+        }
+
+        // Replace the rows of a block starting at this->next_case() that
+        // fall within the enumerated domain with their elements of it.
+        void enumerate_rows_(columns_type &columns, std::size_t count)
+        {
+            std::size_t const enumerated = this->enumerated();
+            if(this->next_case_ >= enumerated)
+                return;
+            count = (std::min)(count, (enumerated - this->next_case_ - 1) / this->case_stride_ + 1);
+            std::size_t divisor = 1;
+            fusion::for_each(
+                indices_type()
+              , detail::enumerate_column_fun<Map, columns_type>(
+                    this->map_, columns, this->next_case_, this->case_stride_, count, divisor)
+            );
+        }
+
+        // Give the generators the size the schedule says the test case with
+        // index case_index should have, if there is a schedule.
+        void schedule_size_(std::size_t case_index)
+        {
+            if(!this->size_schedule_.scheduled())
+                return;
+            std::size_t const size = this->size_schedule_(case_index);
+            if(size != this->sized_)
+                this->resized(size);
+        }
+
         Map map_; // A map from phx placeholders to generators or other phx placeholders
         Rng rng_;
         std::size_t test_count_;
         std::size_t max_test_count_;
         std::size_t sized_;
+        std::size_t max_failures_;
+        std::size_t max_shrinks_;
+        std::chrono::steady_clock::duration max_shrink_time_;
+        boost::optional<boost::uint64_t> seed_;
+        std::size_t next_case_;
+        std::size_t case_stride_;
+        bool partial_redraw_;
+        quick_check::rejection_monitor rejection_monitor_;
+        quick_check::failure_sink failure_sink_;
+        quick_check::size_schedule size_schedule_;
+        std::chrono::steady_clock::duration time_budget_;
+        bool exhaustive_;
+        std::size_t enumerated_; // The number of test cases enumerated, or 0 if it samples
+        bool dedupe_;
+        std::atomic<std::size_t> *shared_failures_; // The failures of all the shards of a run
     };
 
     /// A placeholder for use with \c quick_check::make_config() for specifying
     /// a custom random number generator to use.
     ///
     /// If \c _rng is not specified, it defaults to a default-constructed object
-    /// of type \c boost::random::mt11213b.
+    /// of type \c boost::random::mt11213b. The faster engines
+    /// \c quick_check::xoshiro256ss, \c quick_check::pcg64 and
+    /// \c quick_check::philox4x32 are much cheaper to reseed, which matters
+    /// when \c _seed is specified, and generators draw from them in blocks.
     ///
     /// \b Example:
     ///
@@ -479,6 +1583,312 @@ namespace quick_check
     */
     proto::terminal<detail::sized_>::type const _sized = {};
 
+    /// A placeholder for use with \c quick_check::make_config() for specifying
+    /// the number of failures after which \c quick_check::qcheck() stops.
+    ///
+    /// By default, \c qcheck() runs all the tests even after the property has
+    /// been falsified. If \c _max_failures is specified, \c qcheck() returns
+    /// as soon as that many failures have been recorded, and the returned
+    /// results report that they were stopped early. A value of 0 is treated
+    /// as 1. \c qcheck_parallel() counts the failures of all its threads
+    /// together.
+    ///
+    /// \b Example:
+    ///
+    /*! \code
+        // Stop at the first counter-example.
+        auto conf = make_config(_1 = uniform<int>(), _max_failures = 1u);
+        \endcode
+    */
+    proto::terminal<detail::max_failures_>::type const _max_failures = {};
+
+    /// A placeholder for use with \c quick_check::make_config() for specifying
+    /// the maximum number of evaluations \c quick_check::qcheck() spends
+    /// shrinking a failing input.
+    ///
+    /// When \c qcheck() finds a failure, it repeatedly replaces the failing
+    /// arguments with simpler ones that also make the property fail, using
+    /// the \c quick_check::shrink() customization point of each argument's
+    /// generator. Each candidate that is tried costs one evaluation of the
+    /// condition and the property. Candidates that have already been tried
+    /// are skipped without being evaluated, provided the argument types can be
+    /// hashed.
+    ///
+    /// If \c _max_shrinks is not specified, it defaults to 1000u. A value of 0
+    /// disables shrinking.
+    ///
+    /// \b Example:
+    ///
+    /*! \code
+        // Spend no more than 100 evaluations shrinking.
+        auto conf = make_config(_1 = vector(normal<double>()), _max_shrinks = 100u);
+        \endcode
+    */
+    proto::terminal<detail::max_shrinks_>::type const _max_shrinks = {};
+
+    /// A placeholder for use with \c quick_check::make_config() for specifying
+    /// the maximum wall-clock time \c quick_check::qcheck() spends shrinking a
+    /// failing input.
+    ///
+    /// If \c _max_shrink_time is not specified, shrinking is bounded only by
+    /// \c _max_shrinks.
+    ///
+    /// \b Example:
+    ///
+    /*! \code
+        // Spend no more than a second shrinking.
+        auto conf = make_config(_1 = vector(normal<double>()),
+                                _max_shrink_time = std::chrono::seconds(1));
+        \endcode
+    */
+    proto::terminal<detail::max_shrink_time_>::type const _max_shrink_time = {};
+
+    /// A placeholder for use with \c quick_check::make_config() for specifying
+    /// a base seed for counter-based generation of test cases.
+    ///
+    /// By default, the random number generator is advanced sequentially, so
+    /// test case \em N can only be reproduced by first generating cases 0
+    /// through \em N-1. If \c _seed is specified, the random number generator
+    /// is reseeded before each test case from a pure function of the base
+    /// seed and the index of the test case. Any case can then be regenerated
+    /// on its own with \c config::operator()(std::size_t), and
+    /// \c quick_check::qcheck_parallel() tests exactly the same cases as
+    /// \c quick_check::qcheck() does for properties without a condition.
+    ///
+    /// \pre The random number generator can be seeded from a SeedSeq, as all
+    /// the Boost.Random engines can, and the generators keep no state between
+    /// invocations, as is the case for all the built-in generators. The first
+    /// condition is checked when \c make_config() is compiled.
+    ///
+    /// \b Example:
+    ///
+    /*! \code
+        auto conf = make_config(_1 = uniform<int>(), _seed = 42u);
+        auto res = qcheck(prop, conf);
+        if(!res)
+        {
+            // Regenerate the input that caused the first failure
+            auto args = conf(res.failures()[0].case_index());
+        }
+        \endcode
+    */
+    proto::terminal<detail::seed_>::type const _seed = {};
+
+    /// A placeholder for use with \c quick_check::make_config() for turning on
+    /// the collection of \c quick_check::qcheck_stats.
+    ///
+    /// The value of \c _stats is a policy: either \c quick_check::no_stats,
+    /// which is the default, or \c quick_check::collect_stats. The policy is
+    /// part of the type of the config, so when statistics are not collected,
+    /// the \c qcheck() algorithms compile to the same code as if there were no
+    /// such feature. When they are, \c qcheck() times each phase of each test
+    /// case separately, which evaluates the property's condition, classifiers,
+    /// grouper and the property itself in separate calls, and reads the clock
+    /// several times per test case.
+    ///
+    /// \b Example:
+    ///
+    /*! \code
+        auto conf = make_config(_1 = uniform<int>(), _stats = collect_stats());
+        auto res = qcheck(_1 % 2 == 0 >>= (_1 / 2 * 2 == _1), conf);
+        res.print_summary();
+        res.print_stats();
+        \endcode
+    */
+    proto::terminal<detail::stats_>::type const _stats = {};
+
+    /// A placeholder for use with \c quick_check::make_config() for redrawing
+    /// only some of the arguments of a test case that the property's condition
+    /// rejects.
+    ///
+    /// By default, \c qcheck() generates a whole new set of arguments after
+    /// each rejection. If <tt>_partial_redraw = true</tt> and the condition
+    /// is a property expression that uses only some of the placeholders, like
+    /// <tt>_1 % 10 == 9</tt> in <tt>_1 % 10 == 9 >>= f(_1, _2)</tt>, only the
+    /// arguments it uses are redrawn until it accepts them. The arguments it
+    /// does not use are independent of whether it accepts, so the test cases
+    /// have the same distribution either way, but they cost less to generate.
+    ///
+    /// The condition of a \c property\<\> is opaque, so all the arguments
+    /// are redrawn. So are they if \c _seed is specified, so that each test
+    /// case can be regenerated from its index.
+    ///
+    /// \b Example:
+    ///
+    /*! \code
+        auto conf = make_config(_1 = uniform<int>(), _2 = vector(normal<double>()),
+                                _partial_redraw = true);
+        \endcode
+    */
+    proto::terminal<detail::partial_redraw_>::type const _partial_redraw = {};
+
+    /// A placeholder for use with \c quick_check::make_config() for watching
+    /// the rate at which a property's condition accepts test cases.
+    ///
+    /// Its value is one of the \c quick_check::rejection_monitor enumerators.
+    /// If it is not \c ignore_rejections, \c qcheck() estimates from time to
+    /// time how many tests it can run within \c _max_test_count generated test
+    /// cases at the rate at which the condition has accepted them so far. If
+    /// the estimate falls short of \c _test_count, it either warns on
+    /// \c std::cerr, or stops testing, rather than spending the rest of the
+    /// budget on an outcome that is already known.
+    ///
+    /// \b Example:
+    ///
+    /*! \code
+        auto conf = make_config(_1 = uniform<int>(), _rejection_monitor = stop_on_rejections);
+        auto res = qcheck(_1 % 100 == 0 >>= (_1 / 100 * 100 == _1), conf);
+        assert(res.exhausted());
+        \endcode
+    */
+    proto::terminal<detail::rejection_monitor_>::type const _rejection_monitor = {};
+
+    /// A placeholder for use with \c quick_check::make_config() for bounding
+    /// the memory taken by the failures that \c qcheck() records.
+    ///
+    /// Its value is a \c quick_check::failure_sink, which says which
+    /// failures are kept in \c qcheck_results::failures(), and whether they
+    /// are also passed on to a callback as they are found. By default, every
+    /// failure is kept. \c qcheck_results::failure_count() counts them all
+    /// either way.
+    ///
+    /// \b Example:
+    ///
+    /*! \code
+        // Keep a sample of 10 failures, and write them all to std::cerr
+        auto conf = make_config(_1 = uniform<int>(),
+                                _failure_sink = stream_failures(std::cerr, sample_failures(10)));
+        \endcode
+    */
+    proto::terminal<detail::failure_sink_>::type const _failure_sink = {};
+
+    /// A placeholder for use with \c quick_check::make_config() for varying
+    /// the size of the generated sequences from one test case to the next.
+    ///
+    /// Its value is a \c quick_check::size_schedule, which gives the size
+    /// of each test case as a function of its index. The generators are
+    /// resized with it before each test case is generated, overriding
+    /// \c _sized and the \c sized argument of \c qcheck(). By default, the
+    /// size is \c _sized throughout. Without a seed, \c qcheck_batched()
+    /// gives each block the size of its first test case.
+    ///
+    /// \b Example:
+    ///
+    /*! \code
+        // Vectors of up to 1 element at first, and of up to 1000 at the end
+        auto conf = make_config(_1 = vector(uniform<int>()),
+                                _test_count = 1000u,
+                                _size_schedule = geometric_sizes(1, 1000));
+        \endcode
+    */
+    proto::terminal<detail::size_schedule_>::type const _size_schedule = {};
+
+    /// A placeholder for use with \c quick_check::make_config() for specifying
+    /// how long \c quick_check::qcheck() should keep testing.
+    ///
+    /// With a time budget, \c _test_count is a minimum: once that many tests
+    /// have been run, \c qcheck() goes on running more until the budget has
+    /// been spent, so that the same test saturates a fast machine and still
+    /// finishes on time on a slow one. Rather than reading the clock after
+    /// every test case, \c qcheck() measures how many test cases it runs per
+    /// second, and reads it about a hundred times over the budget.
+    /// \c _max_test_count still bounds the number of inputs generated before
+    /// \c _test_count tests have been run; after that, only the budget does.
+    /// The number of tests actually run is returned by
+    /// \c qcheck_results::test_count(). Each shard of
+    /// \c qcheck_parallel() has the whole budget, since they run at the same
+    /// time. Shrinking is not part of the budget; see \c _max_shrink_time.
+    ///
+    /// If \c _time_budget is not specified, it defaults to 0, and exactly
+    /// \c _test_count tests are run.
+    ///
+    /// \b Example:
+    ///
+    /*! \code
+        // Run at least 1000 tests, and as many more as fit in 10 seconds.
+        auto conf = make_config(_1 = vector(uniform<int>()),
+                                _test_count = 1000u,
+                                _time_budget = std::chrono::seconds(10));
+        auto res = qcheck(prop, conf);
+        std::cout << res.test_count() << " tests run\n";
+        \endcode
+    */
+    proto::terminal<detail::time_budget_>::type const _time_budget = {};
+
+    /// A placeholder for use with \c quick_check::make_config() for
+    /// enumerating the arguments of the test cases rather than sampling them.
+    ///
+    /// When each argument has only a few possible values, like those of
+    /// <tt>uniform\<int\>(1, 6)</tt> or \c digit(), sampling them at random
+    /// wastes most test cases on duplicates, and may still miss some
+    /// combinations. With <tt>_exhaustive = true</tt>, if the generators
+    /// report the size of their domains through the \c domain_size()
+    /// customization point, and the Cartesian product of the domains has no
+    /// more than \c _test_count elements, \c qcheck() tests each of them
+    /// exactly once, in order, and stops. Otherwise, the arguments are
+    /// sampled at random as usual. The integral \c uniform\<\> generators,
+    /// the character classes, \c constant() and \c zip() of them can be
+    /// enumerated.
+    ///
+    /// The enumerated test cases are those with indices below
+    /// \c config::enumerated(), so they can be regenerated with
+    /// \c config::operator()(std::size_t), and \c qcheck_parallel() and
+    /// \c qcheck_batched() test the same ones.
+    ///
+    /// If \c _exhaustive is not specified, it defaults to false.
+    ///
+    /// \b Example:
+    ///
+    /*! \code
+        // Test all 60 combinations of a die and a digit.
+        auto conf = make_config(_1 = uniform<int>(1, 6), _2 = digit(),
+                                _exhaustive = true);
+        \endcode
+    */
+    ///
+    /// \sa \c quick_check::domain_size, \c quick_check::enumerate
+    proto::terminal<detail::exhaustive_>::type const _exhaustive = {};
+
+    /// A placeholder for use with \c quick_check::make_config() for skipping
+    /// the test cases whose arguments have already been tested.
+    ///
+    /// When the arguments have few possible values, many of the test cases
+    /// that \c qcheck() generates repeat earlier ones, and evaluating the
+    /// property on them again teaches nothing. With <tt>_dedupe = true</tt>,
+    /// \c qcheck() hashes each set of arguments it tests into a Bloom
+    /// filter sized for \c _test_count of them, and skips those it has seen
+    /// before without evaluating them or counting them as tests. Arguments
+    /// that the condition rejects are not remembered, and may come up again. They still
+    /// count towards \c _max_test_count, so a domain smaller than
+    /// \c _test_count leaves the results exhausted once it has been covered.
+    /// The number of test cases skipped is returned by
+    /// \c qcheck_results::duplicate_count().
+    ///
+    /// The filter takes about 10 bits per test case. It has no false
+    /// negatives, and takes about one new set of arguments in a hundred for
+    /// a duplicate. Once more than \c _test_count have been tested, as with
+    /// \c _time_budget, it grows, and takes no more than two in a hundred
+    /// for duplicates. Arguments of types that cannot
+    /// be hashed, like user-defined ones, are never skipped.
+    /// \c qcheck_guided() skips duplicates too, and each shard of
+    /// \c qcheck_parallel() skips its own; \c qcheck_batched() ignores
+    /// \c _dedupe. Enumerated domains have no duplicates to skip (see
+    /// \c quick_check::_exhaustive).
+    ///
+    /// If \c _dedupe is not specified, it defaults to false.
+    ///
+    /// \b Example:
+    ///
+    /*! \code
+        // Skip the throws of two dice that have already been tested.
+        auto conf = make_config(_1 = uniform<int>(1, 6), _2 = uniform<int>(1, 6),
+                                _dedupe = true);
+        auto res = qcheck(prop, conf);
+        std::cout << res.duplicate_count() << " duplicates skipped\n";
+        \endcode
+    */
+    proto::terminal<detail::dedupe_>::type const _dedupe = {};
+
     namespace detail
     {
         template<typename Grammar, typename Args>
@@ -487,16 +1897,59 @@ namespace quick_check
             Grammar()(*fusion::find_if<proto::matches<mpl::_, Grammar> >(args))
         )
 
-        template<typename Map, typename Rng>
-        config<Map, Rng> make_config_impl(
+        template<typename Map, typename Rng, typename Stats = no_stats>
+        config<Map, Rng, Stats> make_config_impl(
             Map const &map
           , Rng const &rng
           , std::size_t test_count
           , std::size_t max_test_count
           , std::size_t sized
+          , boost::optional<boost::uint64_t> const &seed = boost::none
+          , std::size_t max_failures = (std::numeric_limits<std::size_t>::max)()
+          , std::size_t max_shrinks = 1000u
+          , std::chrono::steady_clock::duration max_shrink_time =
+                std::chrono::steady_clock::duration::max()
+          , Stats const & = Stats()
+          , bool partial_redraw = false
+          , quick_check::rejection_monitor rejection_monitor = ignore_rejections
+          , quick_check::failure_sink const &failure_sink = quick_check::failure_sink()
+          , quick_check::size_schedule const &size_schedule = quick_check::size_schedule()
+          , std::chrono::steady_clock::duration time_budget =
+                std::chrono::steady_clock::duration::zero()
+          , bool exhaustive = false
+          , bool dedupe = false
         )
         {
-            return config<Map, Rng>(map, rng, test_count, max_test_count, sized);
+            return config<Map, Rng, Stats>(
+                map, rng, test_count, max_test_count, sized, seed, max_failures
+              , max_shrinks, max_shrink_time, partial_redraw, rejection_monitor, failure_sink
+              , size_schedule, time_budget, exhaustive, dedupe);
+        }
+
+        // Whether one of args matches Grammar
+        template<typename Grammar, typename Args>
+        struct has_arg
+          : mpl::not_<
+                boost::is_same<
+                    typename fusion::result_of::find_if<
+                        Args const
+                      , proto::matches<mpl::_, Grammar>
+                    >::type
+                  , typename fusion::result_of::end<Args const>::type
+                >
+            >
+        {};
+
+        // Passes rng through, but fails to compile if _seed was specified
+        // and rng cannot honour it.
+        template<typename Rng, typename Seeded>
+        Rng const &seedable_rng(Rng const &rng, Seeded)
+        {
+            static_assert(
+                !Seeded::value || can_reseed<Rng>::value
+              , "_seed requires a random number generator that can be seeded from a SeedSeq"
+            );
+            return rng;
         }
 
         template<typename Args, typename ArgsWithDefaults>
@@ -504,10 +1957,25 @@ namespace quick_check
         QCHK_RETURN(
             detail::make_config_impl(
                 detail::make_config_map(args)
-              , detail::fetch_arg<RngValue>(args_with_defaults)
+              , detail::seedable_rng(
+                    detail::fetch_arg<RngValue>(args_with_defaults)
+                  , typename has_arg<SeedValue, Args>::type()
+                )
               , detail::fetch_arg<TestCountValue>(args_with_defaults)
               , detail::fetch_arg<MaxTestCountValue>(args_with_defaults)
               , detail::fetch_arg<SizedValue>(args_with_defaults)
+              , detail::fetch_arg<SeedValue>(args_with_defaults)
+              , detail::fetch_arg<MaxFailuresValue>(args_with_defaults)
+              , detail::fetch_arg<MaxShrinksValue>(args_with_defaults)
+              , detail::fetch_arg<MaxShrinkTimeValue>(args_with_defaults)
+              , detail::fetch_arg<StatsValue>(args_with_defaults)
+              , detail::fetch_arg<PartialRedrawValue>(args_with_defaults)
+              , detail::fetch_arg<RejectionMonitorValue>(args_with_defaults)
+              , detail::fetch_arg<FailureSinkValue>(args_with_defaults)
+              , detail::fetch_arg<SizeScheduleValue>(args_with_defaults)
+              , detail::fetch_arg<TimeBudgetValue>(args_with_defaults)
+              , detail::fetch_arg<ExhaustiveValue>(args_with_defaults)
+              , detail::fetch_arg<DedupeValue>(args_with_defaults)
             )
         )
     }
@@ -528,6 +1996,18 @@ namespace quick_check
                       , _test_count = 100u
                       , _max_test_count = 1000u
                       , _sized = 50u
+                      , _seed = boost::optional<boost::uint64_t>()
+                      , _max_failures = (std::numeric_limits<std::size_t>::max)()
+                      , _max_shrinks = 1000u
+                      , _max_shrink_time = std::chrono::steady_clock::duration::max()
+                      , _stats = no_stats()
+                      , _partial_redraw = false
+                      , _rejection_monitor = ignore_rejections
+                      , _failure_sink = failure_sink()
+                      , _size_schedule = size_schedule()
+                      , _time_budget = std::chrono::steady_clock::duration::zero()
+                      , _exhaustive = false
+                      , _dedupe = false
                     )
                 )
             ) type;
@@ -582,6 +2062,18 @@ namespace quick_check
     /// \sa \c quick_check::_test_count
     /// \sa \c quick_check::_max_test_count
     /// \sa \c quick_check::_sized
+    /// \sa \c quick_check::_max_failures
+    /// \sa \c quick_check::_max_shrinks
+    /// \sa \c quick_check::_max_shrink_time
+    /// \sa \c quick_check::_seed
+    /// \sa \c quick_check::_stats
+    /// \sa \c quick_check::_partial_redraw
+    /// \sa \c quick_check::_rejection_monitor
+    /// \sa \c quick_check::_failure_sink
+    /// \sa \c quick_check::_size_schedule
+    /// \sa \c quick_check::_time_budget
+    /// \sa \c quick_check::_exhaustive
+    /// \sa \c quick_check::_dedupe
     template<typename ...As>
     typename detail::result_of_make_config<As...>::type
     make_config(As const &... as)
@@ -594,6 +2086,18 @@ namespace quick_check
               , _test_count = 100u
               , _max_test_count = 1000u
               , _sized = 50u
+              , _seed = boost::optional<boost::uint64_t>()
+              , _max_failures = (std::numeric_limits<std::size_t>::max)()
+              , _max_shrinks = 1000u
+              , _max_shrink_time = std::chrono::steady_clock::duration::max()
+              , _stats = no_stats()
+              , _partial_redraw = false
+              , _rejection_monitor = ignore_rejections
+              , _failure_sink = failure_sink()
+              , _size_schedule = size_schedule()
+              , _time_budget = std::chrono::steady_clock::duration::zero()
+              , _exhaustive = false
+              , _dedupe = false
             )
         );
     }
@@ -624,6 +2128,18 @@ namespace quick_check
               , _test_count = 100u                                                      \
               , _max_test_count = 1000u                                                 \
               , _sized = 50u                                                            \
+              , _seed = boost::optional<boost::uint64_t>()                              \
+              , _max_failures = (std::numeric_limits<std::size_t>::max)()               \
+              , _max_shrinks = 1000u                                                    \
+              , _max_shrink_time = std::chrono::steady_clock::duration::max()           \
+              , _stats = no_stats()                                                     \
+              , _partial_redraw = false                                                 \
+              , _rejection_monitor = ignore_rejections                                  \
+              , _failure_sink = failure_sink()                                          \
+              , _size_schedule = size_schedule()                                        \
+              , _time_budget = std::chrono::steady_clock::duration::zero()              \
+              , _exhaustive = false                                                     \
+              , _dedupe = false                                                         \
             )                                                                           \
         )                                                                               \
     )                                                                                   \
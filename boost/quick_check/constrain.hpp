@@ -0,0 +1,541 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file constrain.hpp
+/// \brief Definition of \c quick_check::constrain(), which narrows the generators
+///        of a config to the ranges of values that a property's condition accepts.
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QCHK_CONSTRAIN_HPP_INCLUDED
+#define QCHK_CONSTRAIN_HPP_INCLUDED
+
+#include <limits>
+#include <cstddef>
+#include <algorithm>
+#include <boost/cstdint.hpp>
+#include <boost/mpl/if.hpp>
+#include <boost/mpl/int.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/and.hpp>
+#include <boost/mpl/or.hpp>
+#include <boost/mpl/not.hpp>
+#include <boost/mpl/count_if.hpp>
+#include <boost/mpl/eval_if.hpp>
+#include <boost/mpl/identity.hpp>
+#include <boost/proto/proto.hpp>
+#include <boost/phoenix/core/argument.hpp>
+#include <boost/phoenix/stl/container.hpp>
+#include <boost/is_placeholder.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/is_signed.hpp>
+#include <boost/type_traits/is_unsigned.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_arithmetic.hpp>
+#include <boost/type_traits/is_floating_point.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+#include <boost/fusion/sequence/intrinsic/at_key.hpp>
+#include <boost/fusion/sequence/intrinsic/value_at.hpp>
+#include <boost/quick_check/quick_check_fwd.hpp>
+#include <boost/quick_check/config.hpp>
+#include <boost/quick_check/qcheck.hpp>
+#include <boost/quick_check/generator/basic_generator.hpp>
+
+QCHK_BOOST_NAMESPACE_BEGIN
+
+namespace quick_check
+{
+    namespace detail
+    {
+        // The comparisons of an argument with a constant that constrain()
+        // understands, written with the argument on the left.
+        enum comparison
+        {
+            less_than
+          , less_or_equal
+          , greater_than
+          , greater_or_equal
+          , equal
+        };
+
+        // c < x is x > c, and so on.
+        inline comparison flip(comparison op)
+        {
+            switch(op)
+            {
+            case less_than:         return greater_than;
+            case less_or_equal:     return greater_or_equal;
+            case greater_than:      return less_than;
+            case greater_or_equal:  return less_or_equal;
+            default:                return op;
+            }
+        }
+
+        // The kinds of operands of a comparison: the argument _I, the size
+        // of the argument _I, a constant, or anything else.
+        template<int I>
+        struct argument_operand
+        {};
+
+        template<int I>
+        struct size_operand
+        {};
+
+        struct constant_operand
+        {};
+
+        struct other_operand
+        {};
+
+        // phoenix::size(_I)
+        struct SizeOfPlaceholder
+          : proto::nary_expr<
+                phoenix::detail::tag::function_eval
+              , proto::terminal<phoenix::stl::size>
+              , PhxPlaceholder
+            >
+        {};
+
+        template<typename Expr>
+        struct placeholder_index
+          : boost::is_placeholder<
+                typename boost::remove_cv<
+                    typename boost::remove_reference<
+                        typename proto::result_of::value<Expr>::type
+                    >::type
+                >::type
+            >
+        {};
+
+        template<typename Expr>
+        struct constant_value
+          : boost::remove_cv<
+                typename boost::remove_reference<
+                    typename proto::result_of::value<Expr>::type
+                >::type
+            >
+        {};
+
+        template<typename Expr, long Arity = proto::arity_of<Expr>::value>
+        struct is_constant
+          : mpl::false_
+        {};
+
+        template<typename Expr>
+        struct is_constant<Expr, 0>
+          : mpl::and_<
+                mpl::not_<proto::matches<Expr, PhxPlaceholder> >
+              , boost::is_arithmetic<typename constant_value<Expr>::type>
+            >
+        {};
+
+        template<typename Expr>
+        struct argument_operand_of
+        {
+            typedef argument_operand<placeholder_index<Expr>::value> type;
+        };
+
+        template<typename Expr>
+        struct size_operand_of
+        {
+            typedef
+                size_operand<
+                    placeholder_index<
+                        typename proto::result_of::child_c<Expr, 1>::type
+                    >::value
+                >
+            type;
+        };
+
+        template<typename Expr>
+        struct operand_kind
+          : mpl::eval_if<
+                proto::matches<Expr, PhxPlaceholder>
+              , argument_operand_of<Expr>
+              , mpl::eval_if<
+                    proto::matches<Expr, SizeOfPlaceholder>
+                  , size_operand_of<Expr>
+                  , mpl::if_<
+                        is_constant<Expr>
+                      , constant_operand
+                      , other_operand
+                    >
+                >
+            >
+        {};
+
+        template<int I>
+        struct is_alias_of
+        {
+            template<typename Pair>
+            struct apply
+              : boost::is_same<typename Pair::second_type, phoenix::argument<I> >
+            {};
+        };
+
+        // The generator of _I can be narrowed if there is one, and no other
+        // placeholder draws from it too.
+        template<typename Map
+               , int I
+               , typename ValueAtKey = typename safe_value_at_key<Map, phoenix::argument<I> >::type>
+        struct is_constrainable
+          : mpl::bool_<mpl::count_if<Map, is_alias_of<I> >::value == 0>
+        {};
+
+        template<typename Map, int I, int J>
+        struct is_constrainable<Map, I, phoenix::argument<J> >
+          : mpl::false_
+        {};
+
+        template<typename Map, int I>
+        struct is_constrainable<Map, I, fusion::void_>
+          : mpl::false_
+        {};
+
+        // How to work out the range of values of type Value that satisfy a
+        // comparison with a constant of type Constant: exactly with signed
+        // or unsigned integers, from the constant as is with floating-point
+        // numbers, or not at all.
+        typedef mpl::int_<0> unsolvable;
+        typedef mpl::int_<1> signed_solvable;
+        typedef mpl::int_<2> unsigned_solvable;
+        typedef mpl::int_<3> floating_solvable;
+
+        template<typename Value, typename Constant>
+        struct integral_solvable
+          : mpl::if_<
+                boost::is_signed<decltype(Value() + Constant())>
+              , signed_solvable
+              , typename mpl::if_<boost::is_unsigned<Value>, unsigned_solvable, unsolvable>::type
+            >
+        {};
+
+        template<typename Value, typename Constant>
+        struct solvable
+          : mpl::eval_if<
+                mpl::or_<
+                    mpl::not_<boost::is_arithmetic<Value> >
+                  , mpl::not_<boost::is_arithmetic<Constant> >
+                  , boost::is_same<Value, bool>
+                  , boost::is_same<Constant, bool>
+                >
+              , mpl::identity<unsolvable>
+              , mpl::eval_if<
+                    boost::is_floating_point<Value>
+                  , mpl::identity<floating_solvable>
+                  , mpl::eval_if<
+                        boost::is_integral<Constant>
+                      , integral_solvable<Value, Constant>
+                      , mpl::identity<unsolvable>
+                    >
+                >
+            >
+        {};
+
+        template<typename Value, typename Constant>
+        bool solve_range(comparison, Constant, Value &, Value &, unsolvable)
+        {
+            return false;
+        }
+
+        // Integers are compared after the usual arithmetic conversions,
+        // which preserve the value of the argument in the cases that are
+        // solvable. Do the arithmetic in the widest type of the same
+        // signedness.
+        template<typename Wide, typename Value, typename Constant>
+        bool solve_integral_range(comparison op, Constant c, Value &lo, Value &hi)
+        {
+            typedef decltype(Value() + Constant()) common_type;
+            Wide const k = static_cast<Wide>(static_cast<common_type>(c));
+            Wide l = (std::numeric_limits<Value>::min)();
+            Wide h = (std::numeric_limits<Value>::max)();
+            switch(op)
+            {
+            case less_than:
+                if(k == (std::numeric_limits<Wide>::min)())
+                    return false;
+                h = (std::min)(h, static_cast<Wide>(k - 1));
+                break;
+            case less_or_equal:
+                h = (std::min)(h, k);
+                break;
+            case greater_than:
+                if(k == (std::numeric_limits<Wide>::max)())
+                    return false;
+                l = (std::max)(l, static_cast<Wide>(k + 1));
+                break;
+            case greater_or_equal:
+                l = (std::max)(l, k);
+                break;
+            case equal:
+                l = (std::max)(l, k);
+                h = (std::min)(h, k);
+                break;
+            }
+            if(h < l)
+                return false;
+            lo = static_cast<Value>(l);
+            hi = static_cast<Value>(h);
+            return true;
+        }
+
+        template<typename Value, typename Constant>
+        bool solve_range(comparison op, Constant c, Value &lo, Value &hi, signed_solvable)
+        {
+            return detail::solve_integral_range<boost::intmax_t>(op, c, lo, hi);
+        }
+
+        template<typename Value, typename Constant>
+        bool solve_range(comparison op, Constant c, Value &lo, Value &hi, unsigned_solvable)
+        {
+            return detail::solve_integral_range<boost::uintmax_t>(op, c, lo, hi);
+        }
+
+        // Strict and non-strict comparisons give the same range; the
+        // condition still rejects the bound itself where it must. Constants
+        // that are not exactly representable in Value are not solved.
+        template<typename Value, typename Constant>
+        bool solve_range(comparison op, Constant c, Value &lo, Value &hi, floating_solvable)
+        {
+            typedef decltype(Value() + Constant()) common_type;
+            Value const k = static_cast<Value>(static_cast<common_type>(c));
+            if(static_cast<common_type>(k) != static_cast<common_type>(c))
+                return false;
+            lo = std::numeric_limits<Value>::lowest();
+            hi = (std::numeric_limits<Value>::max)();
+            switch(op)
+            {
+            case less_than:
+            case less_or_equal:
+                hi = k;
+                return true;
+            case greater_than:
+            case greater_or_equal:
+                lo = k;
+                return true;
+            default:
+                return false;
+            }
+        }
+
+        // Walks a condition, narrowing the generators in the map of a config
+        // for every comparison of an argument, or of its size, with a
+        // constant that must hold for the condition to hold. Args is the
+        // config's result_type.
+        template<typename Map, typename Args>
+        struct constrain_fun
+        {
+            explicit constrain_fun(Map &map)
+              : map_(map)
+            {}
+
+            template<typename Expr>
+            void operator()(Expr const &expr) const
+            {
+                this->visit(expr, typename proto::tag_of<Expr>::type());
+            }
+
+        private:
+            constrain_fun &operator=(constrain_fun const &);
+
+            template<typename Expr, typename Tag>
+            void visit(Expr const &, Tag) const
+            {}
+
+            template<typename Expr>
+            void visit(Expr const &expr, proto::tag::logical_and) const
+            {
+                (*this)(proto::left(expr));
+                (*this)(proto::right(expr));
+            }
+
+            template<typename Expr>
+            void visit(Expr const &expr, proto::tag::less) const
+            {
+                this->compare(proto::left(expr), proto::right(expr), less_than);
+            }
+
+            template<typename Expr>
+            void visit(Expr const &expr, proto::tag::less_equal) const
+            {
+                this->compare(proto::left(expr), proto::right(expr), less_or_equal);
+            }
+
+            template<typename Expr>
+            void visit(Expr const &expr, proto::tag::greater) const
+            {
+                this->compare(proto::left(expr), proto::right(expr), greater_than);
+            }
+
+            template<typename Expr>
+            void visit(Expr const &expr, proto::tag::greater_equal) const
+            {
+                this->compare(proto::left(expr), proto::right(expr), greater_or_equal);
+            }
+
+            template<typename Expr>
+            void visit(Expr const &expr, proto::tag::equal_to) const
+            {
+                this->compare(proto::left(expr), proto::right(expr), equal);
+            }
+
+            template<typename Left, typename Right>
+            void compare(Left const &left, Right const &right, comparison op) const
+            {
+                this->compare(
+                    left
+                  , right
+                  , op
+                  , typename operand_kind<Left>::type()
+                  , typename operand_kind<Right>::type()
+                );
+            }
+
+            template<typename Left, typename Right, typename LeftKind, typename RightKind>
+            void compare(Left const &, Right const &, comparison, LeftKind, RightKind) const
+            {}
+
+            template<typename Left, typename Right, typename Kind>
+            void compare(Left const &, Right const &right, comparison op, Kind kind,
+                         constant_operand) const
+            {
+                this->bound(kind, op, proto::value(right));
+            }
+
+            template<typename Left, typename Right, typename Kind>
+            void compare(Left const &left, Right const &, comparison op, constant_operand,
+                         Kind kind) const
+            {
+                this->bound(kind, detail::flip(op), proto::value(left));
+            }
+
+            template<typename Left, typename Right>
+            void compare(Left const &, Right const &, comparison, constant_operand,
+                         constant_operand) const
+            {}
+
+            template<typename Kind, typename Constant>
+            void bound(Kind, comparison, Constant const &) const
+            {}
+
+            template<int I, typename Constant>
+            void bound(argument_operand<I> kind, comparison op, Constant const &c) const
+            {
+                this->bound(kind, op, c, is_constrainable<Map, I>());
+            }
+
+            template<int I, typename Constant>
+            void bound(size_operand<I> kind, comparison op, Constant const &c) const
+            {
+                this->bound(kind, op, c, is_constrainable<Map, I>());
+            }
+
+            template<typename Kind, typename Constant>
+            void bound(Kind, comparison, Constant const &, mpl::false_) const
+            {}
+
+            template<int I, typename Constant>
+            void bound(argument_operand<I>, comparison op, Constant const &c, mpl::true_) const
+            {
+                typedef
+                    typename boost::remove_cv<
+                        typename boost::remove_reference<
+                            typename fusion::result_of::value_at_c<Args, I - 1>::type
+                        >::type
+                    >::type
+                value_type;
+                value_type lo = value_type(), hi = value_type();
+                if(detail::solve_range(op, c, lo, hi, typename solvable<value_type, Constant>::type()))
+                    detail::narrow_adl(fusion::at_key<phoenix::argument<I> >(this->map_), lo, hi);
+            }
+
+            template<int I, typename Constant>
+            void bound(size_operand<I>, comparison op, Constant const &c, mpl::true_) const
+            {
+                std::size_t lo = 0, hi = 0;
+                if(detail::solve_range(op, c, lo, hi, typename solvable<std::size_t, Constant>::type()))
+                    detail::narrow_size_adl(fusion::at_key<phoenix::argument<I> >(this->map_), lo, hi);
+            }
+
+            Map &map_;
+        };
+
+        template<typename Property, typename Map, typename Args>
+        void constrain_condition(Property const &, Map &, Args *, mpl::false_)
+        {}
+
+        template<typename Property, typename Map, typename Args>
+        void constrain_condition(Property const &prop, Map &map, Args *, mpl::true_)
+        {
+            constrain_fun<Map, Args> const fun(map);
+            fun(proto::left(prop));
+        }
+
+        template<typename Property>
+        struct is_conditional
+          : mpl::and_<
+                proto::is_expr<Property>
+              , proto::matches<Property, proto::shift_right_assign<phoenix::meta_grammar, proto::_> >
+            >
+        {};
+    }
+
+    /// \brief Returns a copy of \c config whose generators produce only
+    ///        arguments that pass the simple tests of \c prop's condition.
+    ///
+    /// A condition that rejects most of the arguments generated for it wastes
+    /// time, and may exhaust \c config.max_test_count() before
+    /// \c config.test_count() tests have been run. \c constrain() looks for
+    /// the comparisons of an argument with a constant in \c prop's condition
+    /// that must be true for it to be true, like the ones in:
+    ///
+    /// \code
+    /// _1 > 0 && 1000 >= _1 && phoenix::size(_2) < 10 >>= ...
+    /// \endcode
+    ///
+    /// and narrows the generators of those arguments accordingly, with
+    /// \c quick_check::narrow() or \c quick_check::narrow_size(). Comparisons
+    /// under any other operator than <tt>&&</tt>, and the generators that
+    /// can't be narrowed, are left alone. The condition is still evaluated,
+    /// and rejects whatever \c constrain() didn't rule out.
+    ///
+    /// The generators of arguments that share their generator with
+    /// another, like <tt>_1 = _2 = uniform\<int\>()</tt>, are not narrowed,
+    /// nor are the generators of \c property<>, \c static_property<> or
+    /// \c property_ref<> objects, whose conditions are opaque. Comparisons of
+    /// integers are solved exactly, taking the usual arithmetic conversions
+    /// into account; comparisons of floating-point numbers narrow the range
+    /// to the constant only if it is exactly representable in the argument's
+    /// type.
+    ///
+    /// \note Calling \c config::resized(), as \c qcheck() does when it is
+    ///       passed a size, resets the range of the sizes of the sequences
+    ///       that a \c sequence_generator produces.
+    ///
+    /// \param prop The property whose condition is to be analyzed
+    /// \param config The config of which a narrowed copy is returned. It is
+    ///               not changed.
+    template<typename Property, typename Map, typename Rng, typename Stats>
+    config<Map, Rng, Stats> constrain(Property const &prop, config<Map, Rng, Stats> const &config)
+    {
+        quick_check::config<Map, Rng, Stats> result(config);
+        typedef typename quick_check::config<Map, Rng, Stats>::result_type args_type;
+        detail::constrain_condition(
+            prop
+          , detail::qcheck_access::generators(result)
+          , static_cast<args_type *>(0)
+          , detail::is_conditional<Property>()
+        );
+        return result;
+    }
+}
+
+QCHK_BOOST_NAMESPACE_END
+
+#endif
@@ -0,0 +1,771 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file corpus.hpp
+/// \brief Definition of \c quick_check::corpus\<\>, a file of failing test cases in a compact
+///        binary format, and of the \c quick_check::qcheck_replay() algorithm that re-evaluates
+///        them.
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QCHK_CORPUS_HPP_INCLUDED
+#define QCHK_CORPUS_HPP_INCLUDED
+
+#include <string>
+#include <vector>
+#include <cstring>
+#include <fstream>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+#include <boost/array.hpp>
+#include <boost/format.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/move/utility.hpp>
+#include <boost/utility/enable_if.hpp>
+#include <boost/type_traits/remove_const.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/fusion/container/vector/convert.hpp>
+#include <boost/fusion/algorithm/iteration/for_each.hpp>
+#include <boost/fusion/algorithm/transformation/transform.hpp>
+#include <boost/fusion/sequence/intrinsic/size.hpp>
+#include <boost/quick_check/quick_check_fwd.hpp>
+#include <boost/quick_check/qcheck.hpp>
+#include <boost/quick_check/qcheck_results.hpp>
+#include <boost/quick_check/detail/array.hpp>
+
+QCHK_BOOST_NAMESPACE_BEGIN
+
+namespace quick_check
+{
+    /// \brief The exception thrown when a corpus file can't be opened, or
+    ///        doesn't hold what it should.
+    struct corpus_error
+      : std::runtime_error
+    {
+        /// Constructor
+        ///
+        /// \param what A description of the problem.
+        explicit corpus_error(std::string const &what)
+          : std::runtime_error(what)
+        {}
+    };
+
+    /// \brief The destination of the bytes written by the \c encode()
+    ///        customization point.
+    ///
+    /// \sa \c quick_check::encode()
+    struct encoder
+    {
+        /// Append \c size bytes, starting at \c data.
+        void write(void const *data, std::size_t size)
+        {
+            this->bytes_.append(static_cast<char const *>(data), size);
+        }
+
+        /// Append the size of a sequence, as 8 bytes.
+        void write_size(std::size_t size)
+        {
+            boost::uint64_t const n = size;
+            this->write(&n, sizeof(n));
+        }
+
+        /// Returns the bytes written so far.
+        ///
+        /// \throw nothrow
+        std::string const &bytes() const
+        {
+            return this->bytes_;
+        }
+
+        /// Forget the bytes written so far, keeping the memory they used.
+        ///
+        /// \throw nothrow
+        void clear()
+        {
+            this->bytes_.clear();
+        }
+
+    private:
+        std::string bytes_;
+    };
+
+    /// \brief The source of the bytes read by the \c decode()
+    ///        customization point.
+    ///
+    /// \sa \c quick_check::decode()
+    struct decoder
+    {
+        /// Constructor
+        ///
+        /// \param first The first byte to read.
+        /// \param last One past the last byte to read.
+        decoder(char const *first, char const *last)
+          : first_(first)
+          , last_(last)
+        {}
+
+        /// Read \c size bytes into \c data.
+        ///
+        /// \throw corpus_error if fewer than \c size bytes are left.
+        void read(void *data, std::size_t size)
+        {
+            if(size > this->remaining())
+                throw corpus_error("Unexpected end of a corpus record.");
+            if(size != 0)
+                std::memcpy(data, this->first_, size);
+            this->first_ += size;
+        }
+
+        /// Read the size of a sequence written by \c encoder::write_size().
+        ///
+        /// \throw corpus_error if fewer than 8 bytes are left.
+        std::size_t read_size()
+        {
+            boost::uint64_t n = 0;
+            this->read(&n, sizeof(n));
+            return static_cast<std::size_t>(n);
+        }
+
+        /// Returns the number of bytes left to read.
+        ///
+        /// \throw nothrow
+        std::size_t remaining() const
+        {
+            return static_cast<std::size_t>(this->last_ - this->first_);
+        }
+
+    private:
+        char const *first_;
+        char const *last_;
+    };
+
+    namespace detail
+    {
+        template<typename T>
+        void encode_adl(encoder &out, T const &t);
+
+        template<typename T>
+        void decode_adl(decoder &in, T &t);
+
+        // Arithmetic and enumeration types are written as they are in
+        // memory.
+        template<typename T>
+        typename boost::enable_if_c<std::is_arithmetic<T>::value || std::is_enum<T>::value>::type
+        encode(encoder &out, T const &t)
+        {
+            out.write(&t, sizeof(t));
+        }
+
+        template<typename T>
+        typename boost::enable_if_c<std::is_arithmetic<T>::value || std::is_enum<T>::value>::type
+        decode(decoder &in, T &t)
+        {
+            in.read(&t, sizeof(t));
+        }
+
+        // Sequences are written as their size followed by their elements.
+        template<typename Seq>
+        auto encode(encoder &out, Seq const &seq)
+            -> decltype(seq.begin() == seq.end(), seq.size(), void())
+        {
+            out.write_size(seq.size());
+            for(auto const &val : seq)
+                detail::encode_adl(out, val);
+        }
+
+        template<typename Seq>
+        auto decode(decoder &in, Seq &seq)
+            -> decltype(seq.insert(seq.end(), std::declval<typename Seq::value_type>()), void())
+        {
+            std::size_t const size = in.read_size();
+            seq.clear();
+            for(std::size_t i = 0; i < size; ++i)
+            {
+                typename Seq::value_type val = typename Seq::value_type();
+                detail::decode_adl(in, val);
+                seq.insert(seq.end(), boost::move(val));
+            }
+        }
+
+        // The same format, written and read in one go for strings and
+        // vectors of numbers.
+        template<typename Char, typename Traits, typename Alloc>
+        void encode(encoder &out, std::basic_string<Char, Traits, Alloc> const &str)
+        {
+            out.write_size(str.size());
+            out.write(str.data(), str.size() * sizeof(Char));
+        }
+
+        template<typename Char, typename Traits, typename Alloc>
+        void decode(decoder &in, std::basic_string<Char, Traits, Alloc> &str)
+        {
+            std::size_t const size = in.read_size();
+            if(size > in.remaining() / sizeof(Char))
+                throw corpus_error("Unexpected end of a corpus record.");
+            str.resize(size);
+            in.read(&str[0], size * sizeof(Char));
+        }
+
+        template<typename T>
+        struct is_raw_element
+          : mpl::bool_<std::is_arithmetic<T>::value && !std::is_same<T, bool>::value>
+        {};
+
+        template<typename T, typename Alloc>
+        typename boost::enable_if<is_raw_element<T> >::type
+        encode(encoder &out, std::vector<T, Alloc> const &vec)
+        {
+            out.write_size(vec.size());
+            if(!vec.empty())
+                out.write(vec.data(), vec.size() * sizeof(T));
+        }
+
+        template<typename T, typename Alloc>
+        typename boost::enable_if<is_raw_element<T> >::type
+        decode(decoder &in, std::vector<T, Alloc> &vec)
+        {
+            std::size_t const size = in.read_size();
+            if(size > in.remaining() / sizeof(T))
+                throw corpus_error("Unexpected end of a corpus record.");
+            vec.resize(size);
+            if(size != 0)
+                in.read(vec.data(), size * sizeof(T));
+        }
+
+        // Fixed-size arrays, like the arguments generated for T[N], are
+        // written without their size.
+        template<typename T, std::size_t N>
+        void encode(encoder &out, boost::array<T, N> const &rg)
+        {
+            for(std::size_t i = 0; i < N; ++i)
+                detail::encode_adl(out, rg[i]);
+        }
+
+        template<typename T, std::size_t N>
+        void decode(decoder &in, boost::array<T, N> &rg)
+        {
+            for(std::size_t i = 0; i < N; ++i)
+                detail::decode_adl(in, rg[i]);
+        }
+
+        template<typename First, typename Second>
+        void encode(encoder &out, std::pair<First, Second> const &p)
+        {
+            detail::encode_adl(out, p.first);
+            detail::encode_adl(out, p.second);
+        }
+
+        template<typename First, typename Second>
+        void decode(decoder &in, std::pair<First, Second> &p)
+        {
+            detail::decode_adl(in, p.first);
+            detail::decode_adl(in, p.second);
+        }
+
+        template<typename T>
+        void encode_adl(encoder &out, T const &t)
+        {
+            using detail::encode;
+            encode(out, t);
+        }
+
+        template<typename T>
+        void decode_adl(decoder &in, T &t)
+        {
+            using detail::decode;
+            decode(in, t);
+        }
+
+        struct encode_fun
+        {
+            typedef void result_type;
+
+            explicit encode_fun(encoder &out)
+              : out_(out)
+            {}
+
+            template<typename T>
+            void operator()(T const &t) const
+            {
+                detail::encode_adl(this->out_, t);
+            }
+
+        private:
+            encoder &out_;
+        };
+
+        struct decode_fun
+        {
+            typedef void result_type;
+
+            explicit decode_fun(decoder &in)
+              : in_(in)
+            {}
+
+            template<typename T>
+            void operator()(T &t) const
+            {
+                detail::decode_adl(this->in_, t);
+            }
+
+        private:
+            decoder &in_;
+        };
+
+        // A corpus file starts with a header:
+        //
+        //      char magic[8]; uint32 version; uint32 byte_order; uint32 arity; uint32 reserved;
+        //
+        // followed by one record per set of arguments:
+        //
+        //      uint64 case_index; uint32 size; char payload[size];
+        //
+        // where the payload holds the encoded arguments, in order, and
+        // case_index is all ones for a shrunk failure. Numbers
+        // are in the byte order of the machine that wrote them, which
+        // byte_order records.
+        char const corpus_magic[8] = {'Q', 'C', 'H', 'K', 'C', 'R', 'P', 'S'};
+        boost::uint32_t const corpus_version = 1;
+        boost::uint32_t const corpus_byte_order = 0x01020304;
+        std::size_t const corpus_header_size = 24;
+        std::size_t const corpus_record_header_size = 12;
+
+        // The arguments with which a property is evaluated, given the
+        // arguments stored in a corpus.
+        template<typename Args>
+        struct replay_args
+          : fusion::result_of::as_vector<
+                typename fusion::result_of::transform<Args const, pack_array>::type
+            >
+        {};
+
+        template<typename Property, typename Corpus>
+        struct make_replay_results_type
+        {
+            typedef typename replay_args<typename Corpus::args_type>::type args_type;
+
+            typedef
+                typename boost::remove_const<
+                    typename boost::remove_reference<
+                        decltype(
+                            detail::get_grouper(
+                                boost::declval<Property const &>()
+                            )(boost::declval<args_type &>())
+                        )
+                    >::type
+                >::type
+            group_type;
+
+            typedef
+                typename make_qcheck_results_type<args_type, group_type>::type
+            type;
+        };
+    }
+
+    /// \fn encode(encoder &out, T const &t)
+    /// \brief The customization point for writing an argument to a corpus.
+    ///
+    /// \c corpus_writer calls \c encode() unqualified, so that it can be
+    /// found by argument-dependent lookup, for each argument of a test case,
+    /// and the default overloads call it for the elements of sequences. They
+    /// handle arithmetic and enumeration types, strings, sequences with
+    /// \c insert(), \c boost::array<> and \c std::pair<>. The arguments of
+    /// other types, like the ones built by \c quick_check::class_\<\>, need an
+    /// overload of \c encode() and one of \c decode() in their namespace.
+    ///
+    /// \em Example:
+    ///
+    /*! \code
+        struct point { int x, y; };
+
+        void encode(quick_check::encoder &out, point const &p)
+        {
+            encode(out, p.x);
+            encode(out, p.y);
+        }
+
+        void decode(quick_check::decoder &in, point &p)
+        {
+            decode(in, p.x);
+            decode(in, p.y);
+        }
+        \endcode
+    */
+    using detail::encode;
+
+    /// \fn decode(decoder &in, T &t)
+    /// \brief The customization point for reading an argument from a corpus.
+    ///
+    /// The inverse of \c quick_check::encode(). It should read exactly the
+    /// bytes that \c encode() wrote.
+    using detail::decode;
+
+    /// \brief Appends test cases to a corpus file.
+    ///
+    /// Each set of arguments is written with \c quick_check::encode(), along
+    /// with the index of the test case that generated it. The file is
+    /// created if it doesn't exist. If it does, the new test cases are
+    /// appended to the ones it holds.
+    ///
+    /// \sa \c quick_check::corpus, \c quick_check::save_failures()
+    struct corpus_writer
+    {
+        /// Constructor
+        ///
+        /// \param path The name of the corpus file.
+        ///
+        /// \throw corpus_error if the file can't be opened for writing.
+        explicit corpus_writer(std::string const &path)
+          : path_(path)
+          , arity_(0)
+          , file_()
+          , buffer_()
+        {
+            std::ifstream in(path.c_str(), std::ios::binary);
+            char header[detail::corpus_header_size];
+            if(in.read(header, sizeof(header)))
+            {
+                boost::uint32_t arity = 0;
+                std::memcpy(&arity, header + 16, sizeof(arity));
+                this->arity_ = arity;
+            }
+            in.close();
+            this->file_.open(path.c_str(), std::ios::binary | std::ios::app);
+            if(!this->file_)
+                throw corpus_error(
+                    (boost::format("Can't open the corpus %1% for writing.") % path).str());
+        }
+
+        /// Append a set of arguments to the corpus.
+        ///
+        /// \param case_index The index of the test case that generated \c args.
+        /// \param args A Fusion Sequence of arguments.
+        ///
+        /// \throw corpus_error if the corpus holds sets of a different number
+        ///        of arguments, or the write fails.
+        template<typename Args>
+        void write(std::size_t case_index, Args const &args)
+        {
+            boost::uint32_t const arity = fusion::result_of::size<Args>::value;
+            if(this->arity_ == 0)
+            {
+                char header[detail::corpus_header_size] = {};
+                boost::uint32_t const fields[4] =
+                    {detail::corpus_version, detail::corpus_byte_order, arity, 0};
+                std::memcpy(header, detail::corpus_magic, sizeof(detail::corpus_magic));
+                std::memcpy(header + 8, fields, sizeof(fields));
+                this->file_.write(header, sizeof(header));
+                this->arity_ = arity;
+            }
+            else if(this->arity_ != arity)
+                throw corpus_error(
+                    (boost::format("The corpus %1% holds sets of %2% arguments, not %3%.")
+                        % this->path_ % this->arity_ % arity).str());
+
+            this->buffer_.clear();
+            fusion::for_each(args, detail::encode_fun(this->buffer_));
+            std::string const &payload = this->buffer_.bytes();
+
+            char record[detail::corpus_record_header_size];
+            boost::uint64_t const index = case_index;
+            boost::uint32_t const size = static_cast<boost::uint32_t>(payload.size());
+            std::memcpy(record, &index, sizeof(index));
+            std::memcpy(record + 8, &size, sizeof(size));
+            this->file_.write(record, sizeof(record));
+            if(!this->file_.write(payload.data(), static_cast<std::streamsize>(payload.size())))
+                throw corpus_error(
+                    (boost::format("Can't write to the corpus %1%.") % this->path_).str());
+        }
+
+        /// Write everything appended so far to the file.
+        void flush()
+        {
+            this->file_.flush();
+        }
+
+    private:
+        corpus_writer(corpus_writer const &);
+        corpus_writer &operator=(corpus_writer const &);
+
+        std::string path_;
+        std::size_t arity_;
+        std::ofstream file_;
+        encoder buffer_;
+    };
+
+    /// \brief A read-only view of a corpus file of the test cases of a
+    ///        property with arguments of types <tt>As...</tt>.
+    ///
+    /// \tparam As The argument types, as for \c qcheck_results<>. If the
+    ///            last is an instance of \c grouped_by<>, it is ignored.
+    ///
+    /// The file is memory-mapped, and the offsets of its records are found
+    /// when it is opened. The arguments are decoded only when they are
+    /// asked for, with \c quick_check::decode(). They are re-evaluated with
+    /// \c qcheck_replay().
+    ///
+    /// \sa \c quick_check::corpus_writer, \c quick_check::qcheck_replay()
+#if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) || defined(QCHK_DOXYGEN_INVOKED)
+    template<typename ...As>
+    struct corpus
+    {
+        /// A Fusion Sequence of the stored arguments. The same as
+        /// <tt>qcheck_args<As...>::args_type</tt>.
+        typedef typename qcheck_args<As...>::args_type args_type;
+#else
+    template<BOOST_PP_ENUM_PARAMS(QCHK_MAX_ARITY, typename A)>
+    struct corpus
+    {
+        typedef
+            typename qcheck_args<BOOST_PP_ENUM_PARAMS(QCHK_MAX_ARITY, A)>::args_type
+        args_type;
+#endif
+
+        /// Constructor
+        ///
+        /// \param path The name of the corpus file. If it doesn't exist or
+        ///             is empty, the corpus is empty.
+        ///
+        /// \throw corpus_error if the file isn't a corpus of sets of
+        ///        arguments like \c args_type, written on a machine with
+        ///        the same byte order.
+        explicit corpus(std::string const &path)
+          : path_(path)
+          , region_()
+          , records_()
+        {
+            std::ifstream in(path.c_str(), std::ios::binary | std::ios::ate);
+            if(!in || in.tellg() <= 0)
+                return;
+            in.close();
+
+            boost::interprocess::file_mapping file(path.c_str(), boost::interprocess::read_only);
+            boost::interprocess::mapped_region(file, boost::interprocess::read_only).swap(
+                this->region_);
+            char const *first = static_cast<char const *>(this->region_.get_address());
+            char const *const last = first + this->region_.get_size();
+
+            boost::uint32_t fields[4] = {};
+            if(static_cast<std::size_t>(last - first) < detail::corpus_header_size ||
+               0 != std::memcmp(first, detail::corpus_magic, sizeof(detail::corpus_magic)))
+                this->error("is not a corpus file");
+            std::memcpy(fields, first + 8, sizeof(fields));
+            if(fields[0] != detail::corpus_version)
+                this->error("has an unknown version");
+            if(fields[1] != detail::corpus_byte_order)
+                this->error("was written on a machine with a different byte order");
+            if(fields[2] != fusion::result_of::size<args_type>::value)
+                this->error("holds sets of a different number of arguments");
+
+            for(first += detail::corpus_header_size; first != last;)
+            {
+                boost::uint32_t size = 0;
+                if(static_cast<std::size_t>(last - first) < detail::corpus_record_header_size)
+                    this->error("ends with a truncated record");
+                std::memcpy(&size, first + 8, sizeof(size));
+                if(static_cast<std::size_t>(last - first) - detail::corpus_record_header_size < size)
+                    this->error("ends with a truncated record");
+                this->records_.push_back(first);
+                first += detail::corpus_record_header_size + size;
+            }
+        }
+
+        /// Returns the number of sets of arguments in the corpus.
+        ///
+        /// \throw nothrow
+        std::size_t size() const
+        {
+            return this->records_.size();
+        }
+
+        /// Returns true if the corpus holds no sets of arguments.
+        ///
+        /// \throw nothrow
+        bool empty() const
+        {
+            return this->records_.empty();
+        }
+
+        /// Returns the index of the test case that generated the \c n-th set
+        /// of arguments, or <tt>std::size_t(-1)</tt> if it is a shrunk
+        /// failure.
+        ///
+        /// \pre <tt>n \< this->size()</tt>
+        std::size_t case_index(std::size_t n) const
+        {
+            BOOST_ASSERT(n < this->size());
+            boost::uint64_t case_index = 0;
+            std::memcpy(&case_index, this->records_[n], sizeof(case_index));
+            return static_cast<std::size_t>(case_index);
+        }
+
+        /// Decodes the \c n-th set of arguments into \c args.
+        ///
+        /// \pre <tt>n \< this->size()</tt>
+        ///
+        /// \throw corpus_error if the record doesn't hold exactly the
+        ///        encoding of an \c args_type.
+        void get(std::size_t n, args_type &args) const
+        {
+            BOOST_ASSERT(n < this->size());
+            boost::uint32_t size = 0;
+            std::memcpy(&size, this->records_[n] + 8, sizeof(size));
+            char const *const first = this->records_[n] + detail::corpus_record_header_size;
+            decoder in(first, first + size);
+            fusion::for_each(args, detail::decode_fun(in));
+            if(in.remaining() != 0)
+                this->error("has a record that is too long for its arguments");
+        }
+
+        /// \overload
+        ///
+        args_type operator[](std::size_t n) const
+        {
+            args_type args;
+            this->get(n, args);
+            return args;
+        }
+
+        /// Returns the name of the corpus file.
+        ///
+        /// \throw nothrow
+        std::string const &path() const
+        {
+            return this->path_;
+        }
+
+    private:
+        corpus(corpus const &);
+        corpus &operator=(corpus const &);
+
+        void error(char const *what) const
+        {
+            throw corpus_error((boost::format("The corpus %1% %2%.") % this->path_ % what).str());
+        }
+
+        std::string path_;
+        boost::interprocess::mapped_region region_;
+        std::vector<char const *> records_;
+    };
+
+    /// \brief Appends the failures in \c results to the corpus file \c path.
+    ///
+    /// If the first failure was shrunk, the shrunk set of arguments is
+    /// written first, followed by every failure in \c results.failures().
+    ///
+    /// \param results The results of \c qcheck() or one of its variants.
+    /// \param path The name of the corpus file.
+    ///
+    /// \throw corpus_error if the file can't be written to.
+    ///
+    /// \sa \c quick_check::corpus_writer
+    template<typename QchkResults>
+    void save_failures(QchkResults const &results, std::string const &path)
+    {
+        typedef typename QchkResults::args_type::args_type inner_args_type;
+        corpus_writer out(path);
+        if(!results.success() && results.shrink_count() != 0)
+            out.write(
+                results.smallest_failure().case_index()
+              , static_cast<inner_args_type const &>(results.smallest_failure())
+            );
+        for(auto const &failure : results.failures())
+            out.write(failure.case_index(), static_cast<inner_args_type const &>(failure));
+    }
+
+    /// \brief Re-evaluate the property for each set of arguments stored in
+    ///        a corpus.
+    ///
+    /// \c qcheck_replay() does what \c qcheck() does, except that instead of
+    /// generating the arguments, it decodes them from \c corpus, in order.
+    /// Sets of arguments that don't satisfy the property's condition are
+    /// skipped. The failures are recorded with the indices of the test cases
+    /// stored in the corpus, and are not shrunk.
+    ///
+    /// \em Example:
+    ///
+    /*! \code
+        auto prop = _1 * _1 >= 0;
+        auto config = make_config(_1 = uniform<int>(-100000, 100000));
+
+        // Save the failures of a run ...
+        auto res = qcheck(prop, config);
+        save_failures(res, "regressions.qcc");
+
+        // ... and check them again later.
+        corpus<int> regressions("regressions.qcc");
+        qcheck_replay(prop, regressions).print_summary();
+        \endcode
+    */
+    ///
+    /// \param prop The property to test.
+    /// \param corpus An instance of \c corpus<>.
+    ///
+    /// \pre \c Property is either an instance of \c property<> or a valid
+    ///      QuickCheckCpp property expression.
+    /// \pre \c Corpus is an instance of \c corpus<>.
+    ///
+    /// \return An instance of \c qcheck_results<> that holds the results.
+    ///
+    /// \throw corpus_error if a set of arguments can't be decoded.
+    ///
+    /// \sa \c quick_check::corpus, \c quick_check::save_failures()
+    template<typename Property, typename Corpus>
+    typename detail::make_replay_results_type<Property, Corpus>::type
+    qcheck_replay(Property const &prop, Corpus const &corpus)
+    {
+        typedef detail::make_replay_results_type<Property, Corpus> replay_types;
+        typename replay_types::type results;
+
+        auto const &classify = detail::get_classifier(prop);
+        auto const &evaluate = detail::get_evaluator(prop);
+        detail::qcheck_access::set_class_names(results, classify);
+
+        // Value-initialized, so that no compiler takes a member of either for
+        // uninitialized in the first iteration.
+        typedef detail::case_outcome<typename replay_types::group_type> outcome_type;
+        outcome_type outcome = outcome_type();
+        typename Corpus::args_type stored = typename Corpus::args_type();
+        for(std::size_t i = 0; i < corpus.size(); ++i)
+        {
+            corpus.get(i, stored);
+            typename replay_types::args_type args =
+                fusion::as_vector(fusion::transform(stored, detail::pack_array()));
+            if(!evaluate(args, outcome))
+                continue;
+
+            if(!outcome.passed)
+            {
+                detail::qcheck_access::add_failure(
+                    results
+                  , fusion::as_vector(fusion::transform(args, detail::unpack_array()))
+                  , outcome.classes
+                  , outcome.group.get()
+                  , corpus.case_index(i)
+                );
+            }
+            else
+            {
+                detail::qcheck_access::add_success(
+                    results
+                  , outcome.classes
+                  , outcome.group.get()
+                );
+            }
+        }
+
+        return boost::move(results);
+    }
+}
+
+QCHK_BOOST_NAMESPACE_END
+
+#endif
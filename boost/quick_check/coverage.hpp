@@ -0,0 +1,212 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file coverage.hpp
+/// \brief Definition of \c quick_check::sanitizer_coverage, the edge counters filled in by code
+///        compiled with SanitizerCoverage, for use with \c quick_check::qcheck_guided().
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QCHK_COVERAGE_HPP_INCLUDED
+#define QCHK_COVERAGE_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstring>
+#include <vector>
+#include <boost/cstdint.hpp>
+#include <boost/quick_check/quick_check_fwd.hpp>
+
+// The callbacks must not be instrumented themselves. With older compilers,
+// define them in a translation unit that is compiled without coverage.
+#if defined(__clang__)
+#define QCHK_NO_SANITIZE_COVERAGE __attribute__((no_sanitize("coverage")))
+#elif defined(__GNUC__) && __GNUC__ >= 12
+#define QCHK_NO_SANITIZE_COVERAGE __attribute__((no_sanitize_coverage))
+#else
+#define QCHK_NO_SANITIZE_COVERAGE
+#endif
+
+QCHK_BOOST_NAMESPACE_BEGIN
+
+namespace quick_check
+{
+    namespace detail
+    {
+        // The counters of the edges reached since they were last cleared,
+        // indexed by the guard number or the hashed address of the edge.
+        // A static data member of a template, so that it can be defined in
+        // a header and touched by the callbacks without a function call.
+        template<typename Dummy = void>
+        struct sanitizer_counters
+        {
+            static std::size_t const size = std::size_t(1) << 16;
+            static unsigned char counters[size];
+            static boost::uint32_t guards;
+        };
+
+        template<typename Dummy>
+        unsigned char sanitizer_counters<Dummy>::counters[sanitizer_counters<Dummy>::size];
+
+        template<typename Dummy>
+        boost::uint32_t sanitizer_counters<Dummy>::guards = 0;
+
+        // Bucket a hit count as AFL does: 1, 2, 3, 4-7, 8-15, 16-31, 32-127,
+        // 128+, one bit each, so that loops that run a few more times count
+        // as new behaviour, but not every extra iteration does.
+        inline unsigned char hit_count_bucket(unsigned char count)
+        {
+            return count == 0 ? 0
+                 : count <= 2 ? count
+                 : count == 3 ? 4
+                 : count <= 7 ? 8
+                 : count <= 15 ? 16
+                 : count <= 31 ? 32
+                 : count <= 127 ? 64
+                 : 128;
+        }
+
+        // The hit-count buckets of every edge any test case has reached.
+        struct coverage_tracker
+        {
+            coverage_tracker()
+              : seen_()
+              , edges_(0)
+            {}
+
+            // Add the buckets of coverage's counters. Returns true if any is
+            // new.
+            template<typename Coverage>
+            bool merge(Coverage const &coverage)
+            {
+                std::size_t const size = coverage.size();
+                unsigned char const *const counters = coverage.counters();
+                if(this->seen_.size() < size)
+                    this->seen_.resize(size);
+                bool found = false;
+                for(std::size_t i = 0; i < size; ++i)
+                {
+                    // Most counters are zero; skip them eight at a time.
+                    boost::uint64_t word = 0;
+                    if(i % 8 == 0 && i + 8 <= size &&
+                       (std::memcpy(&word, counters + i, 8), word == 0))
+                    {
+                        i += 7;
+                        continue;
+                    }
+                    if(counters[i] == 0)
+                        continue;
+                    unsigned char const bucket = detail::hit_count_bucket(counters[i]);
+                    if((this->seen_[i] & bucket) == 0)
+                    {
+                        this->edges_ += this->seen_[i] == 0;
+                        this->seen_[i] |= bucket;
+                        found = true;
+                    }
+                }
+                return found;
+            }
+
+            std::size_t edges() const
+            {
+                return this->edges_;
+            }
+
+        private:
+            std::vector<unsigned char> seen_;
+            std::size_t edges_;
+        };
+    }
+
+    /// \brief The edge counters of the code compiled with SanitizerCoverage.
+    ///
+    /// \c sanitizer_coverage is the default source of coverage for
+    /// \c quick_check::qcheck_guided(). Compile the code under test with
+    /// <tt>-fsanitize-coverage=trace-pc-guard</tt> (Clang) or
+    /// <tt>-fsanitize-coverage=trace-pc</tt> (GCC), and, in exactly one
+    /// translation unit, define \c QCHK_DEFINE_SANITIZER_COVERAGE before
+    /// including this header. That defines the callbacks the instrumented code
+    /// calls, which count the hits of each edge in a table of 65536 counters.
+    /// With <tt>trace-pc</tt>, edges are identified by a hash of their address,
+    /// so two of them occasionally share a counter.
+    ///
+    /// Any type with the same three members can be passed to
+    /// \c quick_check::qcheck_guided() instead, to measure coverage some other
+    /// way.
+    ///
+    /// \em Example:
+    ///
+    /*! \code
+        // In one file compiled with -fsanitize-coverage=trace-pc-guard:
+        #define QCHK_DEFINE_SANITIZER_COVERAGE
+        #include <boost/quick_check/quick_check.hpp>
+        \endcode
+    */
+    struct sanitizer_coverage
+    {
+        /// Resets all the counters to zero.
+        void clear()
+        {
+            std::memset(detail::sanitizer_counters<>::counters, 0, this->size());
+        }
+
+        /// Returns the number of counters.
+        ///
+        /// \throw nothrow
+        std::size_t size() const
+        {
+            return detail::sanitizer_counters<>::size;
+        }
+
+        /// Returns the counters. Each one holds the number of times its edge
+        /// was reached since the last call to \c clear(), up to 255.
+        ///
+        /// \throw nothrow
+        unsigned char const *counters() const
+        {
+            return detail::sanitizer_counters<>::counters;
+        }
+    };
+}
+
+QCHK_BOOST_NAMESPACE_END
+
+#ifdef QCHK_DEFINE_SANITIZER_COVERAGE
+extern "C"
+{
+    // Number the guards of each instrumented module from 1, once.
+    QCHK_NO_SANITIZE_COVERAGE
+    void __sanitizer_cov_trace_pc_guard_init(boost::uint32_t *start, boost::uint32_t *stop)
+    {
+        typedef QCHK_BOOST_NAMESPACE::quick_check::detail::sanitizer_counters<> counters_type;
+        if(start == stop || *start != 0)
+            return;
+        for(boost::uint32_t *guard = start; guard != stop; ++guard)
+            *guard = ++counters_type::guards;
+    }
+
+    QCHK_NO_SANITIZE_COVERAGE
+    void __sanitizer_cov_trace_pc_guard(boost::uint32_t *guard)
+    {
+        typedef QCHK_BOOST_NAMESPACE::quick_check::detail::sanitizer_counters<> counters_type;
+        unsigned char &counter = counters_type::counters[*guard & (counters_type::size - 1)];
+        counter += counter != 255;
+    }
+
+    QCHK_NO_SANITIZE_COVERAGE
+    void __sanitizer_cov_trace_pc()
+    {
+        typedef QCHK_BOOST_NAMESPACE::quick_check::detail::sanitizer_counters<> counters_type;
+        // Fibonacci hashing, spelled out: a call here would be instrumented.
+        boost::uint64_t const pc = reinterpret_cast<boost::uintptr_t>(__builtin_return_address(0));
+        unsigned char &counter = counters_type::counters[(pc * 0x9E3779B97F4A7C15ull) >> 48];
+        counter += counter != 255;
+    }
+}
+#endif
+
+#endif
@@ -118,11 +118,13 @@ namespace quick_check
             array &operator=(array const &that)
             {
                 elems = that.elems;
+                return *this;
             }
 
             array &operator=(T (&ar)[N])
             {
                 std::copy(ar, ar + N, elems.elems);
+                return *this;
             }
 
             T &operator[](std::size_t n)
@@ -330,6 +332,69 @@ namespace quick_check
                 return rg.elems;
             }
         };
+
+        // Like unpack_array, but moves the elements out of a set of
+        // arguments that is about to be overwritten.
+        struct move_unpack_array
+          : unpack_array
+        {
+            using unpack_array::operator();
+
+            template<typename T>
+            T operator()(T &t) const
+            {
+                return boost::move(t);
+            }
+
+            template<typename T, std::size_t N>
+            boost::array<T, N> operator()(detail::array<T[N]> &rg) const
+            {
+                return boost::move(rg.elems);
+            }
+        };
+
+        // The inverse of unpack_array, for evaluating a property with
+        // arguments that were stored unpacked.
+        struct pack_array
+        {
+            template<typename Sig>
+            struct result
+            {};
+
+            template<typename This, typename T>
+            struct result<This(T)>
+            {
+                typedef T type;
+            };
+
+            template<typename This, typename T, std::size_t N>
+            struct result<This(boost::array<T, N>)>
+            {
+                typedef detail::array<T[N]> type;
+            };
+
+            template<typename This, typename T>
+            struct result<This(T &)>
+              : result<This(T)>
+            {};
+
+            template<typename This, typename T>
+            struct result<This(T const &)>
+              : result<This(T)>
+            {};
+
+            template<typename T>
+            T operator()(T const &t) const
+            {
+                return t;
+            }
+
+            template<typename T, std::size_t N>
+            detail::array<T[N]> operator()(boost::array<T, N> const &rg) const
+            {
+                return detail::array<T[N]>(rg.elems);
+            }
+        };
     }
 }
 
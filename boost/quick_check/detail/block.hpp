@@ -0,0 +1,200 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file block.hpp
+/// \brief Evaluation of conditions and properties over blocks of test cases stored by column
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QCHK_DETAIL_BLOCK_HPP_INCLUDED
+#define QCHK_DETAIL_BLOCK_HPP_INCLUDED
+
+#include <vector>
+#include <cstddef>
+#include <type_traits>
+#include <boost/mpl/bool.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/fusion/view/transform_view.hpp>
+#include <boost/fusion/container/vector/convert.hpp>
+#include <boost/fusion/functional/invocation/invoke_function_object.hpp>
+#include <boost/quick_check/quick_check_fwd.hpp>
+
+QCHK_BOOST_NAMESPACE_BEGIN
+
+namespace quick_check
+{
+    namespace detail
+    {
+        // Returns a pointer to the first element of a column.
+        struct column_data
+        {
+            template<typename Sig>
+            struct result;
+
+            template<typename This, typename Column>
+            struct result<This(Column)>
+            {
+                typedef
+                    typename std::remove_reference<Column>::type::value_type const *
+                type;
+            };
+
+            template<typename T>
+            T const *operator()(std::vector<T> const &column) const
+            {
+                return column.data();
+            }
+        };
+
+        // Returns the element of a column at a given lane of a block.
+        struct lane_at
+        {
+            template<typename Sig>
+            struct result;
+
+            template<typename This, typename Ptr>
+            struct result<This(Ptr)>
+            {
+                typedef
+                    typename std::remove_pointer<
+                        typename std::remove_cv<
+                            typename std::remove_reference<Ptr>::type
+                        >::type
+                    >::type const &
+                type;
+            };
+
+            explicit lane_at(std::size_t lane)
+              : lane_(lane)
+            {}
+
+            template<typename T>
+            T const &operator()(T const *column) const
+            {
+                return column[this->lane_];
+            }
+
+        private:
+            std::size_t lane_;
+        };
+
+        // Adapts a property so that it can be called like a condition.
+        template<typename Property>
+        struct invoke_property
+        {
+            explicit invoke_property(Property const &prop)
+              : prop_(prop)
+            {}
+
+            template<typename Args>
+            bool operator()(Args &args) const
+            {
+                // Invoke prop_ itself, not a copy, which a result returned
+                // by reference could outlive.
+                return static_cast<bool>(
+                    fusion::invoke_function_object<Property const &>(this->prop_, args));
+            }
+
+            Property const &property() const
+            {
+                return this->prop_;
+            }
+
+        private:
+            invoke_property &operator=(invoke_property const &);
+            Property const &prop_;
+        };
+
+        // Evaluate fun on lanes [0, count) of a block, writing one flag per lane
+        // to out. Columns is a Fusion sequence of pointers to the columns of the
+        // block. Every iteration is independent, so for simple arithmetic
+        // properties the compiler is free to vectorize the loop.
+        template<typename Fun, typename Columns>
+        void eval_block(Fun const &fun, Columns const &columns, std::size_t count,
+                        bool *out)
+        {
+            for(std::size_t i = 0; i < count; ++i)
+            {
+                fusion::transform_view<Columns const, lane_at> lane(columns, lane_at(i));
+                out[i] = static_cast<bool>(fun(lane));
+            }
+        }
+
+        // Evaluate fun on the lanes of a block listed in lanes.
+        template<typename Fun, typename Columns>
+        void eval_block(Fun const &fun, Columns const &columns, std::size_t const *lanes,
+                        std::size_t count, bool *out)
+        {
+            for(std::size_t i = 0; i < count; ++i)
+            {
+                fusion::transform_view<Columns const, lane_at> lane(columns, lane_at(lanes[i]));
+                out[i] = static_cast<bool>(fun(lane));
+            }
+        }
+
+        // Returns a pointer to an element of a column.
+        struct column_pointer
+        {
+            template<typename Sig>
+            struct result;
+
+            template<typename This, typename T>
+            struct result<This(T)>
+            {
+                typedef
+                    typename std::remove_cv<
+                        typename std::remove_reference<T>::type
+                    >::type const *
+                type;
+            };
+
+            template<typename T>
+            T const *operator()(T const &t) const
+            {
+                return &t;
+            }
+        };
+
+        // The Fusion sequence of column pointers that describes a block of
+        // test cases whose arguments are of type Args.
+        template<typename Args>
+        struct block_columns
+          : fusion::result_of::as_vector<fusion::transform_view<Args const, column_pointer> >
+        {};
+
+        // A property<>-like object whose whole block can be evaluated with
+        // one indirect call; see static_property.hpp.
+        template<typename Args, typename Group>
+        void eval_block(view_condition<Args, Group> const &condition,
+                        typename block_columns<Args>::type const &columns, std::size_t count,
+                        bool *out)
+        {
+            condition.eval_block(columns, count, out);
+        }
+
+        template<typename Args, typename Group>
+        void eval_block(invoke_property<property_view<Args, Group> > const &fun,
+                        typename block_columns<Args>::type const &columns, std::size_t count,
+                        bool *out)
+        {
+            fun.property().eval_block(columns, 0, count, out);
+        }
+
+        template<typename Args, typename Group>
+        void eval_block(invoke_property<property_view<Args, Group> > const &fun,
+                        typename block_columns<Args>::type const &columns,
+                        std::size_t const *lanes, std::size_t count, bool *out)
+        {
+            fun.property().eval_block(columns, lanes, count, out);
+        }
+    }
+}
+
+QCHK_BOOST_NAMESPACE_END
+
+#endif
@@ -0,0 +1,145 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file dedupe.hpp
+/// \brief A compact set of the argument sets that have been tested, for skipping duplicates
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QCHK_DETAIL_DEDUPE_HPP_INCLUDED
+#define QCHK_DETAIL_DEDUPE_HPP_INCLUDED
+
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+#include <boost/cstdint.hpp>
+#include <boost/fusion/algorithm/query/all.hpp>
+#include <boost/fusion/algorithm/iteration/for_each.hpp>
+#include <boost/quick_check/quick_check_fwd.hpp>
+#include <boost/quick_check/detail/random.hpp>
+#include <boost/quick_check/detail/shrink.hpp>
+
+QCHK_BOOST_NAMESPACE_BEGIN
+
+namespace quick_check
+{
+    namespace detail
+    {
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        // seen_filter
+        //   A Bloom filter of the hashes of the argument sets tested so far.
+        //   It starts with a power of two of at least 10 bits per expected
+        //   insertion and sets 7 of them per argument set, picked by double
+        //   hashing, for about 1% false positives. Once it holds as many
+        //   argument sets as it expected, it grows by adding a filter for
+        //   twice as many, with more bits and hashes per set, so that the
+        //   false positive rate of all of them together stays below 2%.
+        //   Argument sets that cannot be hashed are never reported as seen.
+        template<typename Args>
+        struct seen_filter
+        {
+            seen_filter(bool enabled, std::size_t expected)
+              : layers_()
+            {
+                if(enabled)
+                    this->add_layer_((std::max)(expected, std::size_t(1)));
+            }
+
+            // Returns true if args (probably) has been inserted before.
+            bool contains(Args const &args) const
+            {
+                if(this->layers_.empty() || !fusion::all(args, detail::is_shrink_hashable()))
+                    return false;
+                boost::uint64_t h1, h2;
+                seen_filter::hash_(args, h1, h2);
+                for(layer const &l : this->layers_)
+                    if(l.contains(h1, h2))
+                        return true;
+                return false;
+            }
+
+            void insert(Args const &args)
+            {
+                if(this->layers_.empty() || !fusion::all(args, detail::is_shrink_hashable()))
+                    return;
+                if(this->layers_.back().count_ == this->layers_.back().capacity_)
+                    this->add_layer_(this->layers_.back().capacity_ * 2);
+                boost::uint64_t h1, h2;
+                seen_filter::hash_(args, h1, h2);
+                this->layers_.back().insert(h1, h2);
+            }
+
+        private:
+            struct layer
+            {
+                layer(std::size_t capacity, std::size_t bits_per_set, std::size_t nbr_hashes)
+                  : bits_()
+                  , mask_(0)
+                  , nbr_hashes_(nbr_hashes)
+                  , count_(0)
+                  , capacity_(capacity)
+                {
+                    std::size_t nbr_bits = 64;
+                    while(nbr_bits / bits_per_set < capacity && nbr_bits * 2 > nbr_bits)
+                        nbr_bits *= 2;
+                    this->bits_.resize(nbr_bits / 64);
+                    this->mask_ = nbr_bits - 1;
+                }
+
+                bool contains(boost::uint64_t h1, boost::uint64_t h2) const
+                {
+                    for(std::size_t i = 0; i < this->nbr_hashes_; ++i, h1 += h2)
+                    {
+                        std::size_t const bit = static_cast<std::size_t>(h1) & this->mask_;
+                        if((this->bits_[bit / 64] & boost::uint64_t(1) << (bit % 64)) == 0)
+                            return false;
+                    }
+                    return true;
+                }
+
+                void insert(boost::uint64_t h1, boost::uint64_t h2)
+                {
+                    for(std::size_t i = 0; i < this->nbr_hashes_; ++i, h1 += h2)
+                    {
+                        std::size_t const bit = static_cast<std::size_t>(h1) & this->mask_;
+                        this->bits_[bit / 64] |= boost::uint64_t(1) << (bit % 64);
+                    }
+                    ++this->count_;
+                }
+
+                std::vector<boost::uint64_t> bits_;
+                std::size_t mask_;
+                std::size_t nbr_hashes_;
+                std::size_t count_;
+                std::size_t capacity_;
+            };
+
+            static void hash_(Args const &args, boost::uint64_t &h1, boost::uint64_t &h2)
+            {
+                std::size_t seed = 0;
+                fusion::for_each(args, detail::shrink_hash_combine(seed));
+                h1 = detail::mix64(seed);
+                h2 = detail::mix64(h1 ^ 0x9E3779B97F4A7C15ull) | 1u;
+            }
+
+            // The n-th filter has about half the false positives of the one
+            // before it.
+            void add_layer_(std::size_t capacity)
+            {
+                std::size_t const n = this->layers_.size();
+                this->layers_.push_back(layer(capacity, 10 + 2 * n, 7 + n));
+            }
+
+            std::vector<layer> layers_;
+        };
+    }
+}
+
+QCHK_BOOST_NAMESPACE_END
+
+#endif
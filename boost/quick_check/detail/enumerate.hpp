@@ -0,0 +1,66 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file enumerate.hpp
+/// \brief Utilities for counting and listing the values of small domains
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QCHK_DETAIL_ENUMERATE_HPP_INCLUDED
+#define QCHK_DETAIL_ENUMERATE_HPP_INCLUDED
+
+#include <cstddef>
+#include <limits>
+#include <boost/quick_check/quick_check_fwd.hpp>
+#include <boost/quick_check/detail/array.hpp>
+#include <boost/quick_check/generator/basic_generator.hpp>
+
+QCHK_BOOST_NAMESPACE_BEGIN
+
+namespace quick_check
+{
+    namespace detail
+    {
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        // Enumeration helpers for use by the built-in generators
+
+        // The size of the product of two domains, or 0 if either can't be
+        // enumerated or the product doesn't fit in a std::size_t.
+        inline std::size_t domain_product(std::size_t a, std::size_t b)
+        {
+            if(a == 0 || b == 0 || a > (std::numeric_limits<std::size_t>::max)() / b)
+                return 0;
+            return a * b;
+        }
+
+        // The number of arrays of N elements drawn from gen.
+        template<std::size_t N, typename Gen>
+        std::size_t domain_size_elements(Gen const &gen)
+        {
+            std::size_t const size = detail::domain_size_adl(gen);
+            std::size_t product = 1;
+            for(std::size_t i = 0; i < N; ++i)
+                product = detail::domain_product(product, size);
+            return product;
+        }
+
+        // The index-th array of N elements drawn from gen, with the first
+        // element varying fastest.
+        template<typename Gen, typename T, std::size_t N>
+        void enumerate_elements(Gen &gen, std::size_t index, detail::array<T[N]> &value)
+        {
+            std::size_t const size = detail::domain_size_adl(gen);
+            for(std::size_t i = 0; i < N; ++i, index /= size)
+                detail::enumerate_adl(gen, index % size, value[i]);
+        }
+    }
+}
+
+QCHK_BOOST_NAMESPACE_END
+
+#endif
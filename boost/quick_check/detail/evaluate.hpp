@@ -0,0 +1,188 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file evaluate.hpp
+/// \brief Evaluation of a whole property for one test case in a single call
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QCHK_DETAIL_EVALUATE_HPP_INCLUDED
+#define QCHK_DETAIL_EVALUATE_HPP_INCLUDED
+
+#include <boost/optional.hpp>
+#include <boost/function.hpp>
+#include <boost/type_traits/remove_const.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+#include <boost/fusion/functional/invocation/invoke_function_object.hpp>
+#include <boost/quick_check/quick_check_fwd.hpp>
+#include <boost/quick_check/classify.hpp>
+
+QCHK_BOOST_NAMESPACE_BEGIN
+
+namespace quick_check
+{
+    namespace detail
+    {
+        // What became of a test case that satisfied its property's condition
+        template<typename Group>
+        struct case_outcome
+        {
+            case_outcome()
+              : passed(false)
+              , classes(0)
+              , group()
+            {}
+
+            bool passed;
+            class_mask classes;
+            boost::optional<Group> group;
+        };
+
+        // Evaluates prop with args. fusion::invoke_function_object takes its
+        // function object by value, so a property that returns a reference
+        // into itself, like phoenix::val(true), would leave it dangling.
+        // Invoke prop itself instead.
+        template<typename Property, typename Args>
+        bool call_property(Property const &prop, Args &args)
+        {
+            return static_cast<bool>(fusion::invoke_function_object<Property const &>(prop, args));
+        }
+
+        // The condition, classifiers, grouper and property of a property
+        // expression, evaluated in that order by one call. When the parts
+        // share a sub-expression, like _1 % 3 in
+        //
+        //      group_by(_1 % 3) | classify(_1 % 3 == 0, "zero") | ...
+        //
+        // the compiler sees both in the same inlined body and computes it
+        // once.
+        template<typename Property, typename Condition, typename Classify, typename GroupBy>
+        struct fused_evaluator
+        {
+            fused_evaluator(Property const &prop, Condition const &condition,
+                            Classify const &classify, GroupBy const &groupby)
+              : prop_(prop)
+              , condition_(condition)
+              , classify_(classify)
+              , groupby_(groupby)
+            {}
+
+            // Returns false, and leaves out alone, if args doesn't satisfy
+            // the condition.
+            template<typename Args, typename Group>
+            bool operator()(Args &args, case_outcome<Group> &out) const
+            {
+                if(!static_cast<bool>(this->condition_(args)))
+                    return false;
+                out.classes = this->classify_.mask(args);
+                out.group = this->groupby_(args);
+                out.passed = detail::call_property(this->prop_, args);
+                return true;
+            }
+
+            Property const &property() const
+            {
+                return this->prop_;
+            }
+
+            Condition const &condition() const
+            {
+                return this->condition_;
+            }
+
+            Classify const &classifier() const
+            {
+                return this->classify_;
+            }
+
+            GroupBy const &grouper() const
+            {
+                return this->groupby_;
+            }
+
+        private:
+            Property prop_;
+            Condition condition_;
+            Classify classify_;
+            GroupBy groupby_;
+        };
+
+        struct make_fused_evaluator : proto::callable
+        {
+            template<typename Sig>
+            struct result;
+
+            template<typename This, typename Prop, typename Cond, typename Classify, typename Group>
+            struct result<This(Prop, Cond, Classify, Group)>
+            {
+                typedef
+                    fused_evaluator<
+                        typename boost::remove_const<typename remove_reference<Prop>::type>::type
+                      , typename boost::remove_const<typename remove_reference<Cond>::type>::type
+                      , typename boost::remove_const<typename remove_reference<Classify>::type>::type
+                      , typename boost::remove_const<typename remove_reference<Group>::type>::type
+                    >
+                type;
+            };
+
+            template<typename Prop, typename Cond, typename Classify, typename Group>
+            fused_evaluator<Prop, Cond, Classify, Group>
+            operator()(Prop const &prop, Cond const &cond, Classify const &classify,
+                       Group const &groupby) const
+            {
+                return fused_evaluator<Prop, Cond, Classify, Group>(prop, cond, classify, groupby);
+            }
+        };
+
+        // A type-erased fused_evaluator, for property<>. Evaluating a test
+        // case costs one indirect call instead of four.
+        template<typename Args, typename Group>
+        struct any_evaluator
+        {
+            any_evaluator()
+              : fun_()
+            {}
+
+            template<typename Evaluator>
+            any_evaluator(Evaluator const &eval)
+              : fun_(eval_fun<Evaluator>(eval))
+            {}
+
+            template<typename OtherArgs>
+            bool operator()(OtherArgs const &args, case_outcome<Group> &out) const
+            {
+                return this->fun_(args, out);
+            }
+
+        private:
+            template<typename Evaluator>
+            struct eval_fun
+            {
+                typedef bool result_type;
+
+                explicit eval_fun(Evaluator const &eval)
+                  : eval_(eval)
+                {}
+
+                bool operator()(Args const &args, case_outcome<Group> &out) const
+                {
+                    return this->eval_(args, out);
+                }
+
+            private:
+                Evaluator eval_;
+            };
+
+            boost::function<bool(Args const &, case_outcome<Group> &)> fun_;
+        };
+    }
+}
+
+QCHK_BOOST_NAMESPACE_END
+
+#endif
@@ -0,0 +1,114 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file mutate.hpp
+/// \brief Utilities for making variations of the values of test cases
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QCHK_DETAIL_MUTATE_HPP_INCLUDED
+#define QCHK_DETAIL_MUTATE_HPP_INCLUDED
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <algorithm>
+#include <boost/cstdint.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/quick_check/quick_check_fwd.hpp>
+#include <boost/quick_check/detail/array.hpp>
+#include <boost/quick_check/detail/shrink.hpp>
+#include <boost/quick_check/generator/basic_generator.hpp>
+
+QCHK_BOOST_NAMESPACE_BEGIN
+
+namespace quick_check
+{
+    namespace detail
+    {
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        // Mutation helpers for use by the built-in generators
+
+        // A random number in [0, n).
+        template<typename Rng>
+        std::size_t random_below(Rng &rng, std::size_t n)
+        {
+            return boost::random::uniform_int_distribution<std::size_t>(0, n - 1)(rng);
+        }
+
+        // Replace value, which is in [lo, hi], with one of the bounds, with
+        // the value closest to 0, or with a value up to 16 away from it.
+        template<typename Int, typename Rng>
+        void mutate_integral(Rng &rng, Int &value, Int lo, Int hi)
+        {
+            typedef boost::uintmax_t uint_type;
+            switch(detail::random_below(rng, 4))
+            {
+            case 0:
+                value = detail::random_below(rng, 2) ? hi : lo;
+                break;
+            case 1:
+                value = detail::shrink_target(lo, hi);
+                break;
+            default:
+            {
+                uint_type const step = 1 + detail::random_below(rng, 16);
+                if(detail::random_below(rng, 2))
+                    value = static_cast<Int>(
+                        uint_type(value) + (std::min)(step, uint_type(hi) - uint_type(value)));
+                else
+                    value = static_cast<Int>(
+                        uint_type(value) - (std::min)(step, uint_type(value) - uint_type(lo)));
+                break;
+            }
+            }
+        }
+
+        // Replace value with one of the bounds of [lo, hi], with the value
+        // closest to 0, with its negation, double, half or next neighbour,
+        // clamped to [lo, hi].
+        template<typename Real, typename Rng>
+        void mutate_floating(Rng &rng, Real &value, Real lo, Real hi)
+        {
+            Real const inf = std::numeric_limits<Real>::infinity();
+            switch(detail::random_below(rng, 6))
+            {
+            case 0:
+                value = detail::random_below(rng, 2) ? hi : lo;
+                break;
+            case 1:
+                value = detail::shrink_target(lo, hi);
+                break;
+            case 2:
+                value = -value;
+                break;
+            case 3:
+                value *= 2;
+                break;
+            case 4:
+                value /= 2;
+                break;
+            default:
+                value = std::nextafter(value, detail::random_below(rng, 2) ? inf : -inf);
+                break;
+            }
+            value = (std::min)((std::max)(value, lo), hi);
+        }
+
+        // Mutate one element of an array with gen.
+        template<typename Gen, typename Rng, typename T, std::size_t N>
+        void mutate_elements(Gen &gen, Rng &rng, detail::array<T[N]> &value)
+        {
+            detail::mutate_adl(gen, rng, value[detail::random_below(rng, N)]);
+        }
+    }
+}
+
+QCHK_BOOST_NAMESPACE_END
+
+#endif
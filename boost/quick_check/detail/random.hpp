@@ -0,0 +1,146 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file random.hpp
+/// \brief Bit-twiddling helpers shared by the random number engines and generators
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QCHK_DETAIL_RANDOM_HPP_INCLUDED
+#define QCHK_DETAIL_RANDOM_HPP_INCLUDED
+
+#include <cstddef>
+#include <utility>
+#include <algorithm>
+#include <boost/cstdint.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/quick_check/quick_check_fwd.hpp>
+
+QCHK_BOOST_NAMESPACE_BEGIN
+
+namespace quick_check
+{
+    namespace detail
+    {
+        // The SplitMix64 output function. A good bit mixer; see
+        // http://xorshift.di.unimi.it/splitmix64.c
+        inline boost::uint64_t mix64(boost::uint64_t z)
+        {
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        }
+
+        inline boost::uint64_t rotl64(boost::uint64_t x, unsigned k)
+        {
+            return (x << (k & 63)) | (x >> ((64 - k) & 63));
+        }
+
+        inline boost::uint64_t rotr64(boost::uint64_t x, unsigned k)
+        {
+            return (x >> (k & 63)) | (x << ((64 - k) & 63));
+        }
+
+        // The 128-bit product of a and b. Returns the low half and stores
+        // the high half in hi.
+        inline boost::uint64_t mul64(boost::uint64_t a, boost::uint64_t b, boost::uint64_t &hi)
+        {
+#if defined(__SIZEOF_INT128__)
+            unsigned __int128 const p = static_cast<unsigned __int128>(a) * b;
+            hi = static_cast<boost::uint64_t>(p >> 64);
+            return static_cast<boost::uint64_t>(p);
+#else
+            boost::uint64_t const a_lo = a & 0xFFFFFFFFu, a_hi = a >> 32;
+            boost::uint64_t const b_lo = b & 0xFFFFFFFFu, b_hi = b >> 32;
+            boost::uint64_t const lo_lo = a_lo * b_lo;
+            boost::uint64_t const hi_lo = a_hi * b_lo;
+            boost::uint64_t const lo_hi = a_lo * b_hi;
+            boost::uint64_t const cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFFu) + lo_hi;
+            hi = a_hi * b_hi + (hi_lo >> 32) + (cross >> 32);
+            return (cross << 32) | (lo_lo & 0xFFFFFFFFu);
+#endif
+        }
+
+        // Just enough unsigned 128-bit arithmetic, modulo 2^128, for a
+        // 128-bit linear congruential generator.
+        struct uint128
+        {
+            boost::uint64_t hi;
+            boost::uint64_t lo;
+
+            friend uint128 operator+(uint128 a, uint128 b)
+            {
+                uint128 const r = {a.hi + b.hi + (a.lo + b.lo < a.lo), a.lo + b.lo};
+                return r;
+            }
+
+            friend uint128 operator*(uint128 a, uint128 b)
+            {
+                uint128 r;
+                r.lo = detail::mul64(a.lo, b.lo, r.hi);
+                r.hi += a.hi * b.lo + a.lo * b.hi;
+                return r;
+            }
+
+            friend bool operator==(uint128 a, uint128 b)
+            {
+                return a.hi == b.hi && a.lo == b.lo;
+            }
+        };
+
+        // Whether Rng has a member fill(uint64_t *, size_t) that writes a
+        // block of uniformly distributed 64-bit words.
+        template<typename Rng, typename Enable = void>
+        struct has_fill
+          : mpl::false_
+        {};
+
+        template<typename Rng>
+        struct has_fill<
+            Rng
+          , decltype(void(std::declval<Rng &>().fill(
+                static_cast<boost::uint64_t *>(0), std::size_t())))
+        >
+          : mpl::true_
+        {};
+
+        // Write n floating-point values uniformly distributed in [lo, hi) to out, made from
+        // the top 53 bits of words drawn a block at a time from rng.fill.
+        template<typename Value, typename Rng, typename OutIter>
+        OutIter uniform_real_n(Rng &rng, Value lo, Value hi, OutIter out, std::size_t n)
+        {
+            if(!(lo < hi))
+                return std::fill_n(out, n, lo);
+
+            boost::uint64_t words[32];
+            Value const scale = (hi - lo) * Value(1. / 9007199254740992.); // 2^-53
+            while(n != 0)
+            {
+                std::size_t const count = n < 32 ? n : 32;
+                rng.fill(words, count);
+                for(std::size_t i = 0; i < count; ++i)
+                {
+                    Value const value = lo + static_cast<Value>(words[i] >> 11) * scale;
+                    // Rounding can land on hi. The word is dropped and the
+                    // next block makes up for it.
+                    if(value < hi)
+                    {
+                        *out = value;
+                        ++out;
+                        --n;
+                    }
+                }
+            }
+            return out;
+        }
+    }
+}
+
+QCHK_BOOST_NAMESPACE_END
+
+#endif
@@ -0,0 +1,499 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file shrink.hpp
+/// \brief Utilities for shrinking failing inputs to simpler ones
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QCHK_DETAIL_SHRINK_HPP_INCLUDED
+#define QCHK_DETAIL_SHRINK_HPP_INCLUDED
+
+#include <cmath>
+#include <chrono>
+#include <limits>
+#include <vector>
+#include <utility>
+#include <unordered_map>
+#include <boost/cstdint.hpp>
+#include <boost/array.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/and.hpp>
+#include <boost/move/utility.hpp>
+#include <boost/functional/hash.hpp>
+#include <boost/type_traits/is_arithmetic.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_signed.hpp>
+#include <boost/fusion/support/is_sequence.hpp>
+#include <boost/fusion/sequence/intrinsic/at_c.hpp>
+#include <boost/fusion/sequence/intrinsic/size.hpp>
+#include <boost/fusion/sequence/intrinsic/value_at.hpp>
+#include <boost/fusion/algorithm/query/all.hpp>
+#include <boost/fusion/algorithm/iteration/for_each.hpp>
+#include <boost/fusion/functional/invocation/invoke_function_object.hpp>
+#include <boost/quick_check/quick_check_fwd.hpp>
+#include <boost/quick_check/detail/array.hpp>
+#include <boost/quick_check/generator/basic_generator.hpp>
+
+QCHK_BOOST_NAMESPACE_BEGIN
+
+namespace quick_check
+{
+    namespace detail
+    {
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        // Candidate generation helpers for use by the built-in generators
+
+        // Append value - d, value - d/2, value - d/4, ..., value -/+ 1, where
+        // d is the distance from value to target.
+        template<typename Int>
+        void shrink_integral(Int value, Int target, std::vector<Int> &out)
+        {
+            typedef boost::uintmax_t uint_type;
+            if(value == target)
+                return;
+            bool const down = target < value;
+            uint_type dist = down ? uint_type(value) - uint_type(target)
+                                  : uint_type(target) - uint_type(value);
+            for(; dist != 0; dist /= 2)
+                out.push_back(static_cast<Int>(down ? uint_type(value) - dist
+                                                    : uint_type(value) + dist));
+        }
+
+        // Like shrink_integral, but also tries the value with its fractional
+        // part dropped. All candidates are within [lo, hi].
+        template<typename Real>
+        void shrink_floating(Real value, Real target, Real lo, Real hi, std::vector<Real> &out)
+        {
+            if(value == target)
+                return;
+            if(!(std::isfinite)(value))
+            {
+                out.push_back(target);
+                return;
+            }
+            out.push_back(target);
+            Real const whole = std::trunc(value);
+            if(whole != value && whole != target && lo <= whole && whole <= hi)
+                out.push_back(whole);
+            Real dist = (value - target) / 2;
+            for(int i = 0; i < std::numeric_limits<Real>::digits && value - dist != value; ++i)
+            {
+                out.push_back(value - dist);
+                dist /= 2;
+            }
+        }
+
+        // The value in [lo, hi] that is closest to 0.
+        template<typename Number>
+        Number shrink_target(Number lo, Number hi)
+        {
+            return Number(0) < lo ? lo : hi < Number(0) ? hi : Number(0);
+        }
+
+        // Shrink each element of an array with gen, one at a time.
+        template<typename Gen, typename T, std::size_t N>
+        void shrink_elements(Gen const &gen, detail::array<T[N]> const &value,
+                             std::vector<detail::array<T[N]> > &out)
+        {
+            std::vector<T> elems;
+            for(std::size_t i = 0; i < N; ++i)
+            {
+                elems.clear();
+                detail::shrink_adl(gen, value[i], elems);
+                for(T &elem : elems)
+                {
+                    out.push_back(value);
+                    out.back()[i] = boost::move(elem);
+                }
+            }
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        // Hashing of candidates, so the shrinker can skip the ones it has
+        // already tried. Types that cannot be hashed disable the memo.
+        template<typename T, typename Enable = void>
+        struct shrink_hash
+        {
+            typedef mpl::false_ hashable;
+
+            static std::size_t call(T const &)
+            {
+                return 0;
+            }
+
+            static bool equal(T const &, T const &)
+            {
+                return false;
+            }
+
+            static std::size_t size(T const &)
+            {
+                return 1;
+            }
+        };
+
+        template<typename T>
+        struct shrink_hash<T, typename boost::enable_if<boost::is_arithmetic<T> >::type>
+        {
+            typedef mpl::true_ hashable;
+
+            static std::size_t call(T const &t)
+            {
+                return boost::hash<T>()(t);
+            }
+
+            static bool equal(T const &a, T const &b)
+            {
+                return a == b;
+            }
+
+            static std::size_t size(T const &)
+            {
+                return 1;
+            }
+        };
+
+        template<typename T>
+        struct has_const_iterator
+        {
+        private:
+            template<typename U>
+            static mpl::true_ check(typename U::const_iterator *);
+
+            template<typename U>
+            static mpl::false_ check(...);
+
+        public:
+            typedef decltype(has_const_iterator::check<T>(0)) type;
+            static bool const value = type::value;
+        };
+
+        // Containers, including std::string and boost::array
+        template<typename T>
+        struct shrink_hash<T, typename boost::enable_if<has_const_iterator<T> >::type>
+        {
+            typedef typename T::value_type value_type;
+            typedef typename shrink_hash<value_type>::hashable hashable;
+
+            static std::size_t call(T const &t)
+            {
+                std::size_t seed = 0;
+                for(value_type const &v : t)
+                    boost::hash_combine(seed, shrink_hash<value_type>::call(v));
+                return seed;
+            }
+
+            static bool equal(T const &a, T const &b)
+            {
+                typename T::const_iterator i = a.begin(), j = b.begin();
+                for(; i != a.end() && j != b.end(); ++i, ++j)
+                    if(!shrink_hash<value_type>::equal(*i, *j))
+                        return false;
+                return i == a.end() && j == b.end();
+            }
+
+            static std::size_t size(T const &t)
+            {
+                std::size_t n = 1;
+                for(value_type const &v : t)
+                    n += shrink_hash<value_type>::size(v);
+                return n;
+            }
+        };
+
+        template<typename T, std::size_t N>
+        struct shrink_hash<detail::array<T[N]> >
+        {
+            typedef typename shrink_hash<boost::array<T, N> >::hashable hashable;
+
+            static std::size_t call(detail::array<T[N]> const &t)
+            {
+                return shrink_hash<boost::array<T, N> >::call(t.elems);
+            }
+
+            static bool equal(detail::array<T[N]> const &a, detail::array<T[N]> const &b)
+            {
+                return shrink_hash<boost::array<T, N> >::equal(a.elems, b.elems);
+            }
+
+            static std::size_t size(detail::array<T[N]> const &t)
+            {
+                return shrink_hash<boost::array<T, N> >::size(t.elems);
+            }
+        };
+
+        template<typename A, typename B>
+        struct shrink_hash<std::pair<A, B> >
+        {
+            typedef
+                typename mpl::and_<
+                    typename shrink_hash<A>::hashable
+                  , typename shrink_hash<B>::hashable
+                >::type
+            hashable;
+
+            static std::size_t call(std::pair<A, B> const &t)
+            {
+                std::size_t seed = 0;
+                boost::hash_combine(seed, shrink_hash<A>::call(t.first));
+                boost::hash_combine(seed, shrink_hash<B>::call(t.second));
+                return seed;
+            }
+
+            static bool equal(std::pair<A, B> const &a, std::pair<A, B> const &b)
+            {
+                return shrink_hash<A>::equal(a.first, b.first) &&
+                       shrink_hash<B>::equal(a.second, b.second);
+            }
+
+            static std::size_t size(std::pair<A, B> const &t)
+            {
+                return shrink_hash<A>::size(t.first) + shrink_hash<B>::size(t.second);
+            }
+        };
+
+        template<>
+        struct shrink_hash<fusion::void_>
+        {
+            typedef mpl::true_ hashable;
+
+            static std::size_t call(fusion::void_ const &)
+            {
+                return 0;
+            }
+
+            static bool equal(fusion::void_ const &, fusion::void_ const &)
+            {
+                return true;
+            }
+
+            static std::size_t size(fusion::void_ const &)
+            {
+                return 0;
+            }
+        };
+
+        struct is_shrink_hashable
+        {
+            template<typename T>
+            bool operator()(T const &) const
+            {
+                return shrink_hash<T>::hashable::value;
+            }
+        };
+
+        struct shrink_hash_combine
+        {
+            explicit shrink_hash_combine(std::size_t &seed)
+              : seed_(seed)
+            {}
+
+            template<typename T>
+            void operator()(T const &t) const
+            {
+                boost::hash_combine(this->seed_, shrink_hash<T>::call(t));
+            }
+
+        private:
+            std::size_t &seed_;
+        };
+
+        struct shrink_size_sum
+        {
+            explicit shrink_size_sum(std::size_t &size)
+              : size_(size)
+            {}
+
+            template<typename T>
+            void operator()(T const &t) const
+            {
+                this->size_ += shrink_hash<T>::size(t);
+            }
+
+        private:
+            std::size_t &size_;
+        };
+
+        template<typename Args
+               , int I = 0
+               , int N = fusion::result_of::size<Args>::value>
+        struct shrink_args_equal
+        {
+            static bool call(Args const &a, Args const &b)
+            {
+                typedef typename fusion::result_of::value_at_c<Args, I>::type value_type;
+                return shrink_hash<value_type>::equal(fusion::at_c<I>(a), fusion::at_c<I>(b)) &&
+                       shrink_args_equal<Args, I + 1, N>::call(a, b);
+            }
+        };
+
+        template<typename Args, int N>
+        struct shrink_args_equal<Args, N, N>
+        {
+            static bool call(Args const &, Args const &)
+            {
+                return true;
+            }
+        };
+
+        // Remembers the argument sets that have been tried, and compares
+        // those with the same hash, so that a collision does not skip an
+        // untried candidate. Once max_size scalars are remembered, new
+        // candidates are no longer remembered, and may be tried again.
+        template<typename Args>
+        struct shrink_memo
+        {
+            static std::size_t const max_size = std::size_t(1) << 22;
+
+            explicit shrink_memo(Args const &args)
+              : enabled_(fusion::all(args, detail::is_shrink_hashable()))
+              , size_(0)
+              , seen_()
+            {
+                this->insert(args);
+            }
+
+            // Returns false if args has been seen before.
+            bool insert(Args const &args)
+            {
+                if(!this->enabled_)
+                    return true;
+                std::size_t seed = 0;
+                fusion::for_each(args, detail::shrink_hash_combine(seed));
+                typedef typename seen_type::const_iterator iterator;
+                std::pair<iterator, iterator> const range = this->seen_.equal_range(seed);
+                for(iterator it = range.first; it != range.second; ++it)
+                    if(detail::shrink_args_equal<Args>::call(it->second, args))
+                        return false;
+                std::size_t size = 0;
+                fusion::for_each(args, detail::shrink_size_sum(size));
+                if(size <= max_size - this->size_)
+                {
+                    this->size_ += size;
+                    this->seen_.insert(std::make_pair(seed, args));
+                }
+                return true;
+            }
+
+        private:
+            typedef std::unordered_multimap<std::size_t, Args> seen_type;
+            bool enabled_;
+            std::size_t size_;
+            seen_type seen_;
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        // What config::shrink_each does after offering a candidate: go on to
+        // the next one, keep this one and stop, or put it back and stop.
+        enum shrink_step
+        {
+            shrink_next
+          , shrink_keep
+          , shrink_stop
+        };
+
+        // Tries each candidate offered by config::shrink_each, charging it to
+        // the budget before it is evaluated.
+        template<typename Property, typename Condition, typename Args>
+        struct try_shrink
+        {
+            typedef std::chrono::steady_clock clock_type;
+
+            try_shrink(Property const &prop, Condition const &condition,
+                       std::size_t max_evaluations, clock_type::duration max_time, Args const &args)
+              : prop_(prop)
+              , condition_(condition)
+              , memo_(args)
+              , shrinks_(0)
+              , evaluations_(0)
+              , max_evaluations_(max_evaluations)
+              , timed_(max_time != clock_type::duration::max())
+              , deadline_(timed_ ? clock_type::now() + max_time : clock_type::time_point())
+            {}
+
+            bool exhausted() const
+            {
+                return this->evaluations_ == this->max_evaluations_ ||
+                      (this->timed_ && clock_type::now() >= this->deadline_);
+            }
+
+            std::size_t shrinks() const
+            {
+                return this->shrinks_;
+            }
+
+            shrink_step operator()(Args const &candidate)
+            {
+                if(this->exhausted())
+                    return shrink_stop;
+                if(!this->memo_.insert(candidate))
+                    return shrink_next;
+                ++this->evaluations_;
+                if(static_cast<bool>(this->condition_(candidate)) &&
+                   !static_cast<bool>(
+                       fusion::invoke_function_object<Property const &>(this->prop_, candidate)))
+                {
+                    ++this->shrinks_;
+                    return shrink_keep;
+                }
+                return shrink_next;
+            }
+
+        private:
+            try_shrink &operator=(try_shrink const &);
+            Property const &prop_;
+            Condition const &condition_;
+            shrink_memo<Args> memo_;
+            std::size_t shrinks_;
+            std::size_t evaluations_;
+            std::size_t const max_evaluations_;
+            bool const timed_;
+            clock_type::time_point const deadline_;
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        // shrink_failure
+        //   Greedily replace args with the first simpler candidate that still
+        //   satisfies the condition and falsifies the property, until no
+        //   candidate does or the budget runs out. Returns the number of
+        //   successful shrinks.
+        template<typename Property, typename Condition, typename Config>
+        std::size_t shrink_failure(
+            Property const &prop
+          , Condition const &condition
+          , Config &config
+          , typename Config::result_type &args
+        )
+        {
+            typedef typename Config::result_type args_type;
+
+            detail::try_shrink<Property, Condition, args_type> attempt(
+                prop
+              , condition
+              , config.max_shrinks()
+              , config.max_shrink_time()
+              , args
+            );
+            // Candidates are made lazily, so that a large failing input does
+            // not have all of its candidates in memory at once, and the budget
+            // is checked before each of them is made.
+            for(std::size_t shrinks = 0; config.shrink_each(args, attempt); )
+            {
+                if(attempt.shrinks() == shrinks)
+                    break;
+                shrinks = attempt.shrinks();
+            }
+            return attempt.shrinks();
+        }
+    }
+}
+
+QCHK_BOOST_NAMESPACE_END
+
+#endif
@@ -0,0 +1,161 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file stats.hpp
+/// \brief The recorders of per-phase statistics used by the qcheck algorithms
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QCHK_DETAIL_STATS_HPP_INCLUDED
+#define QCHK_DETAIL_STATS_HPP_INCLUDED
+
+#include <chrono>
+#include <cstddef>
+#include <algorithm>
+#include <boost/fusion/functional/invocation/invoke_function_object.hpp>
+#include <boost/quick_check/quick_check_fwd.hpp>
+#include <boost/quick_check/qcheck_stats.hpp>
+#include <boost/quick_check/detail/evaluate.hpp>
+
+QCHK_BOOST_NAMESPACE_BEGIN
+
+namespace quick_check
+{
+    namespace detail
+    {
+        // Records nothing. Every member is an empty inline function, so a
+        // qcheck algorithm instrumented with it compiles to the same code as
+        // one that isn't.
+        template<typename Policy>
+        struct stats_recorder
+        {
+            stats_recorder(qcheck_stats &, std::size_t)
+            {}
+
+            // Start timing the next phase.
+            void start()
+            {}
+
+            // Charge the time since the last call to start() or lap() to p.
+            void lap(qcheck_stats::phase)
+            {}
+
+            // count sets of arguments were generated, one value of each.
+            void drew(std::size_t)
+            {}
+
+            // count sets of arguments were generated by redrawing the
+            // arguments selected by mask.
+            void drew(std::size_t, std::size_t)
+            {}
+
+            // count sets of arguments did not satisfy the condition.
+            void rejected(std::size_t)
+            {}
+
+            // Count the false values of valid[0, count) as rejected.
+            void rejected(bool const *, std::size_t)
+            {}
+
+            // Evaluate a test case in one call to evaluate.
+            template<typename Evaluator, typename Property, typename Condition,
+                     typename Classify, typename GroupBy, typename Args, typename Group>
+            bool evaluate(Evaluator const &evaluate, Property const &, Condition const &,
+                          Classify const &, GroupBy const &, Args &args,
+                          case_outcome<Group> &out)
+            {
+                return evaluate(args, out);
+            }
+        };
+
+        template<>
+        struct stats_recorder<collect_stats>
+        {
+            typedef std::chrono::steady_clock clock_type;
+
+            stats_recorder(qcheck_stats &stats, std::size_t arity)
+              : stats_(stats)
+              , last_(clock_type::now())
+            {
+                stats.enabled_ = true;
+                if(stats.draws_.size() < arity)
+                    stats.draws_.resize(arity);
+            }
+
+            void start()
+            {
+                this->last_ = clock_type::now();
+            }
+
+            void lap(qcheck_stats::phase p)
+            {
+                clock_type::time_point const now = clock_type::now();
+                this->stats_.times_[p] +=
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(now - this->last_);
+                this->last_ = now;
+            }
+
+            void drew(std::size_t count)
+            {
+                this->drew(count, ~std::size_t(0));
+            }
+
+            void drew(std::size_t count, std::size_t mask)
+            {
+                this->stats_.generated_ += count;
+                for(std::size_t i = 0; i < this->stats_.draws_.size(); ++i)
+                    if(mask >> i & 1u)
+                        this->stats_.draws_[i] += count;
+            }
+
+            void rejected(std::size_t count)
+            {
+                this->stats_.rejected_ += count;
+            }
+
+            void rejected(bool const *valid, std::size_t count)
+            {
+                this->rejected(static_cast<std::size_t>(std::count(valid, valid + count, false)));
+            }
+
+            // Evaluate the parts of a test case one at a time, so that each
+            // can be timed. Sub-expressions they share are computed once per
+            // part.
+            template<typename Evaluator, typename Property, typename Condition,
+                     typename Classify, typename GroupBy, typename Args, typename Group>
+            bool evaluate(Evaluator const &, Property const &prop, Condition const &condition,
+                          Classify const &classify, GroupBy const &groupby, Args &args,
+                          case_outcome<Group> &out)
+            {
+                bool const valid = static_cast<bool>(condition(args));
+                this->lap(qcheck_stats::condition);
+                if(!valid)
+                {
+                    this->rejected(1);
+                    return false;
+                }
+                out.classes = classify.mask(args);
+                this->lap(qcheck_stats::classification);
+                out.group = groupby(args);
+                this->lap(qcheck_stats::grouping);
+                out.passed = detail::call_property(prop, args);
+                this->lap(qcheck_stats::property);
+                return true;
+            }
+
+        private:
+            stats_recorder &operator=(stats_recorder const &);
+            qcheck_stats &stats_;
+            clock_type::time_point last_;
+        };
+    }
+}
+
+QCHK_BOOST_NAMESPACE_END
+
+#endif
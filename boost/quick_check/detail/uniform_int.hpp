@@ -0,0 +1,127 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file uniform_int.hpp
+/// \brief Fast mapping of the raw output of a random number generator onto a range of integers
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QCHK_DETAIL_UNIFORM_INT_HPP_INCLUDED
+#define QCHK_DETAIL_UNIFORM_INT_HPP_INCLUDED
+
+#include <cstddef>
+#include <boost/cstdint.hpp>
+#include <boost/type_traits/is_unsigned.hpp>
+#include <boost/quick_check/quick_check_fwd.hpp>
+#include <boost/quick_check/detail/random.hpp>
+
+QCHK_BOOST_NAMESPACE_BEGIN
+
+namespace quick_check
+{
+    namespace detail
+    {
+        // Accept the 32-bit word as the offset (word * size) >> 32 unless
+        // that would bias the result.
+        template<typename OutIter, typename Fun>
+        bool uniform_int_accept(boost::uint32_t word, boost::uint32_t size,
+                                boost::uint32_t reject, OutIter &out, Fun const &fun)
+        {
+            if(size == 0) // The full range of 2^32 values
+            {
+                *out = fun(word);
+                ++out;
+                return true;
+            }
+            boost::uint64_t const m = boost::uint64_t(word) * size;
+            if(static_cast<boost::uint32_t>(m) < reject)
+                return false;
+            *out = fun(static_cast<boost::uint32_t>(m >> 32));
+            ++out;
+            return true;
+        }
+
+        // Draw both halves of 64-bit words a block at a time from rng.fill.
+        template<typename Rng, typename OutIter, typename Fun>
+        bool uniform_int_n_(Rng &rng, boost::uint32_t size, boost::uint32_t reject,
+                            OutIter &out, std::size_t n, Fun const &fun, mpl::true_)
+        {
+            boost::uint64_t words[32];
+            while(n != 0)
+            {
+                std::size_t const count = (n + 1) / 2 < 32 ? (n + 1) / 2 : 32;
+                rng.fill(words, count);
+                for(std::size_t i = 0; i != count && n != 0; ++i)
+                {
+                    n -= detail::uniform_int_accept(
+                        static_cast<boost::uint32_t>(words[i]), size, reject, out, fun);
+                    if(n != 0)
+                        n -= detail::uniform_int_accept(
+                            static_cast<boost::uint32_t>(words[i] >> 32), size, reject, out, fun);
+                }
+            }
+            return true;
+        }
+
+        // Draw one word at a time from rng.
+        template<typename Rng, typename OutIter, typename Fun>
+        bool uniform_int_n_(Rng &rng, boost::uint32_t size, boost::uint32_t reject,
+                            OutIter &out, std::size_t n, Fun const &fun, mpl::false_)
+        {
+            typedef typename Rng::result_type word_type;
+            if(!boost::is_unsigned<word_type>::value || (rng.min)() != 0)
+                return false;
+
+            unsigned shift = 0;
+            if(boost::uintmax_t((rng.max)()) == 0xFFFFFFFFu)
+                shift = 0;
+            else if(boost::uintmax_t((rng.max)()) == 0xFFFFFFFFFFFFFFFFull)
+                shift = 32;
+            else
+                return false;
+
+            while(n != 0)
+            {
+                boost::uint32_t const word =
+                    static_cast<boost::uint32_t>(boost::uint64_t(rng()) >> shift);
+                n -= detail::uniform_int_accept(word, size, reject, out, fun);
+            }
+            return true;
+        }
+
+        // Write n offsets uniformly distributed in [0, range], each passed
+        // through fun, to out. Each offset is the high half of the product of
+        // a 32-bit word from rng and range + 1, and a word is only redrawn in
+        // the rare case that keeping it would bias the result. See D. Lemire,
+        // "Fast Random Integer Generation in an Interval", 2019. If rng has a
+        // fill member, words are drawn from it a block at a time, and each
+        // 64-bit word is used as two 32-bit words.
+        //
+        // Returns false and does nothing unless range is less than 2^32 and
+        // rng either has a fill member or produces uniformly distributed 32-
+        // or 64-bit words.
+        template<typename Rng, typename OutIter, typename Fun>
+        bool uniform_int_n(Rng &rng, boost::uintmax_t range, OutIter &out, std::size_t n,
+                           Fun const &fun)
+        {
+            if(range > 0xFFFFFFFFu)
+                return false;
+
+            // size is 0 for the full range of 2^32 values.
+            boost::uint32_t const size = static_cast<boost::uint32_t>(range) + 1;
+            // The number of low products to reject, (2^32 - size) % size
+            boost::uint32_t const reject =
+                size == 0 ? 0u : static_cast<boost::uint32_t>(0u - size) % size;
+            return detail::uniform_int_n_(rng, size, reject, out, n, fun, detail::has_fill<Rng>());
+        }
+    }
+}
+
+QCHK_BOOST_NAMESPACE_END
+
+#endif
@@ -0,0 +1,227 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file failure_sink.hpp
+/// \brief Definition of \c quick_check::failure_sink, which decides which of the
+///        failures found by \c quick_check::qcheck() are kept in memory and where
+///        the others go.
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QCHK_FAILURE_SINK_HPP_INCLUDED
+#define QCHK_FAILURE_SINK_HPP_INCLUDED
+
+#include <mutex>
+#include <limits>
+#include <memory>
+#include <string>
+#include <ostream>
+#include <cstddef>
+#include <algorithm>
+#include <functional>
+#include <boost/format.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/quick_check/quick_check_fwd.hpp>
+#include <boost/quick_check/detail/random.hpp>
+
+QCHK_BOOST_NAMESPACE_BEGIN
+
+namespace quick_check
+{
+    /// \brief Says which of the failing sets of arguments found by
+    ///        \c qcheck() are kept in \c qcheck_results::failures(), and
+    ///        optionally passes each of them on to a callback as it is found.
+    ///
+    /// By default, every failure is kept. A badly broken property can fail
+    /// millions of times, so a \c failure_sink made by
+    /// \c keep_first_failures(), \c sample_failures(), \c count_failures() or
+    /// \c stream_failures() bounds the memory they take. Whatever is kept,
+    /// \c qcheck_results::failure_count() counts every failure, and the
+    /// first failure, which is the one that is shrunk and reported, is always
+    /// kept.
+    ///
+    /// A \c failure_sink is specified with \c quick_check::_failure_sink.
+    ///
+    /// \sa \c quick_check::_failure_sink
+    struct failure_sink
+    {
+        /// The ways of choosing which failures to keep
+        enum retention_policy
+        {
+            keep_all        ///< Keep every failure. This is the default.
+          , keep_first      ///< Keep the first \c capacity() failures.
+          , keep_sample     ///< Keep the first failure and a uniform sample of the others.
+        };
+
+        /// The type of the callbacks passed to \c stream_failures(). They are
+        /// called with the index of the failing test case, as returned by
+        /// \c qcheck_args::case_index(), and the failing arguments as written
+        /// by \c qcheck_results::print_summary(), or an empty string if they
+        /// can't be written to a \c std::ostream.
+        typedef std::function<void(std::size_t, std::string const &)> callback_type;
+
+        /// Default constructor
+        ///
+        /// \post <tt>this->retention() == keep_all</tt>
+        /// \post <tt>!this->streaming()</tt>
+        failure_sink()
+          : retention_(keep_all)
+          , capacity_((std::numeric_limits<std::size_t>::max)())
+          , callback_()
+        {}
+
+        /// Constructor
+        ///
+        /// \param retention How to choose the failures to keep.
+        /// \param capacity The maximum number of failures to keep. If it is
+        ///                 0, 1 is used instead, so that the first failure
+        ///                 can always be kept.
+        failure_sink(retention_policy retention, std::size_t capacity)
+          : retention_(retention)
+          , capacity_(retention == keep_all ? (std::numeric_limits<std::size_t>::max)()
+                                            : (std::max)(capacity, std::size_t(1)))
+          , callback_()
+        {}
+
+        /// Returns how the failures to keep are chosen
+        ///
+        /// \throw nothrow
+        retention_policy retention() const
+        {
+            return this->retention_;
+        }
+
+        /// Returns the maximum number of failures to keep
+        ///
+        /// \throw nothrow
+        std::size_t capacity() const
+        {
+            return this->capacity_;
+        }
+
+        /// Returns true if every failure is passed to a callback as it is
+        /// found.
+        ///
+        /// \throw nothrow
+        bool streaming() const
+        {
+            return !!this->callback_;
+        }
+
+        /// Returns a copy of \c *this that also passes every failure to
+        /// \c fun as it is found. The calls are serialized, even when the
+        /// failures are found by the shards of \c qcheck_parallel(), and
+        /// all copies of the returned sink share the same callback.
+        failure_sink stream_to(callback_type const &fun) const
+        {
+            failure_sink that(*this);
+            that.callback_ = std::make_shared<callback_state>(fun);
+            return that;
+        }
+
+        /// INTERNAL ONLY
+        /// Pass a failure on to the callback, if there is one.
+        void stream(std::size_t case_index, std::string const &args) const
+        {
+            if(this->callback_)
+            {
+                std::lock_guard<std::mutex> lock(this->callback_->mutex_);
+                this->callback_->fun_(case_index, args);
+            }
+        }
+
+        /// INTERNAL ONLY
+        /// The order in which the failures are sampled. It is a function of
+        /// the test case's index alone, so the sample is reproducible and
+        /// doesn't depend on how the test cases were sharded.
+        static boost::uint64_t priority(std::size_t case_index)
+        {
+            return detail::mix64(static_cast<boost::uint64_t>(case_index));
+        }
+
+    private:
+        struct callback_state
+        {
+            explicit callback_state(callback_type const &fun)
+              : mutex_()
+              , fun_(fun)
+            {}
+
+            std::mutex mutex_;
+            callback_type fun_;
+        };
+
+        retention_policy retention_;
+        std::size_t capacity_;
+        std::shared_ptr<callback_state> callback_;
+    };
+
+    /// Returns a \c failure_sink that keeps every failure. This is the default.
+    inline failure_sink keep_all_failures()
+    {
+        return failure_sink();
+    }
+
+    /// Returns a \c failure_sink that keeps only the first \c n failures,
+    /// or just the first if \c n is 0.
+    inline failure_sink keep_first_failures(std::size_t n)
+    {
+        return failure_sink(failure_sink::keep_first, n);
+    }
+
+    /// Returns a \c failure_sink that keeps the first failure, and a uniform
+    /// random sample of <tt>n - 1</tt> of the others, in no particular order.
+    /// The sample is chosen by the indices of the failing test cases, so it
+    /// is the same for the same test cases, however they were sharded.
+    inline failure_sink sample_failures(std::size_t n)
+    {
+        return failure_sink(failure_sink::keep_sample, n);
+    }
+
+    /// Returns a \c failure_sink that only counts the failures, keeping just
+    /// the first one so that it can be shrunk and reported.
+    inline failure_sink count_failures()
+    {
+        return failure_sink(failure_sink::keep_first, 1u);
+    }
+
+    /// Returns a copy of \c sink that passes every failure to \c fun as it
+    /// is found. By default, only the first failure is also kept.
+    ///
+    /// \sa \c failure_sink::callback_type
+    inline failure_sink stream_failures(
+        failure_sink::callback_type const &fun
+      , failure_sink const &sink = count_failures()
+    )
+    {
+        return sink.stream_to(fun);
+    }
+
+    /// Returns a copy of \c sink that writes every failure to \c sout as it
+    /// is found, one line each. By default, only the first failure is also
+    /// kept.
+    ///
+    /// \pre \c sout outlives every test run that uses the returned sink.
+    inline failure_sink stream_failures(
+        std::ostream &sout
+      , failure_sink const &sink = count_failures()
+    )
+    {
+        std::ostream *const psout = &sout;
+        return sink.stream_to(
+            [psout](std::size_t case_index, std::string const &args)
+            {
+                *psout << (boost::format("Failure in test case %1%: %2%\n") % case_index % args);
+            }
+        );
+    }
+}
+
+QCHK_BOOST_NAMESPACE_END
+
+#endif
@@ -18,6 +18,7 @@
 #include <boost/quick_check/generator/char.hpp>
 #include <boost/quick_check/generator/class.hpp>
 #include <boost/quick_check/generator/constant.hpp>
+#include <boost/quick_check/generator/file.hpp>
 #include <boost/quick_check/generator/normal.hpp>
 #include <boost/quick_check/generator/uniform.hpp>
 #include <boost/quick_check/generator/vector.hpp>
@@ -15,6 +15,7 @@
 #define QCHK_GENERATOR_BASIC_GENERATOR_HPP_INCLUDED
 
 #include <cstddef>
+#include <vector>
 #include <boost/phoenix/core/argument.hpp>
 #include <boost/quick_check/quick_check_fwd.hpp>
 
@@ -41,6 +42,175 @@ namespace quick_check
             set_size(gen, size);
         }
 
+        template<typename Value>
+        void shrink(any_generator, Value const &, std::vector<Value> &)
+        {}
+
+        template<typename Gen, typename Value>
+        void shrink_adl(Gen const &gen, Value const &value, std::vector<Value> &out)
+        {
+            using detail::shrink;
+            shrink(gen, value, out);
+        }
+
+        template<typename Gen, typename Value, typename Fun>
+        bool shrink_each(Gen const &gen, Value const &value, Fun &fun)
+        {
+            std::vector<Value> candidates;
+            detail::shrink_adl(gen, value, candidates);
+            for(Value &candidate : candidates)
+            {
+                if(fun(candidate))
+                    return true;
+            }
+            return false;
+        }
+
+        template<typename Gen, typename Value, typename Fun>
+        bool shrink_each_adl(Gen const &gen, Value const &value, Fun &fun)
+        {
+            using detail::shrink_each;
+            return shrink_each(gen, value, fun);
+        }
+
+        // For implementing shrink() in terms of shrink_each()
+        template<typename Value>
+        struct append_candidate
+        {
+            explicit append_candidate(std::vector<Value> &out)
+              : out_(out)
+            {}
+
+            bool operator()(Value &candidate) const
+            {
+                this->out_.push_back(candidate);
+                return false;
+            }
+
+        private:
+            append_candidate &operator=(append_candidate const &);
+            std::vector<Value> &out_;
+        };
+
+        template<typename Gen, typename Rng, typename OutIter>
+        OutIter generate_n(Gen &gen, Rng &rng, OutIter out, std::size_t n)
+        {
+            for(; n != 0; --n, ++out)
+                *out = gen(rng);
+            return out;
+        }
+
+        template<typename Gen, typename Rng, typename OutIter>
+        OutIter generate_n_adl(Gen &gen, Rng &rng, OutIter out, std::size_t n)
+        {
+            using detail::generate_n;
+            return generate_n(gen, rng, out, n);
+        }
+
+        template<typename Gen, typename Rng, typename Value>
+        void generate_into(Gen &gen, Rng &rng, Value &value)
+        {
+            value = gen(rng);
+        }
+
+        template<typename Gen, typename Rng, typename Value>
+        void generate_into_adl(Gen &gen, Rng &rng, Value &value)
+        {
+            using detail::generate_into;
+            generate_into(gen, rng, value);
+        }
+
+        template<typename Gen, typename Rng, typename Value>
+        void mutate(Gen &gen, Rng &rng, Value &value)
+        {
+            value = gen(rng);
+        }
+
+        template<typename Gen, typename Rng, typename Value>
+        void mutate_adl(Gen &gen, Rng &rng, Value &value)
+        {
+            using detail::mutate;
+            mutate(gen, rng, value);
+        }
+
+        template<typename Value>
+        bool narrow(any_generator, Value const &, Value const &)
+        {
+            return false;
+        }
+
+        template<typename Gen, typename Value>
+        bool narrow_adl(Gen &gen, Value const &lo, Value const &hi)
+        {
+            using detail::narrow;
+            return narrow(gen, lo, hi);
+        }
+
+        inline bool narrow_size(any_generator, std::size_t, std::size_t)
+        {
+            return false;
+        }
+
+        template<typename Gen>
+        bool narrow_size_adl(Gen &gen, std::size_t lo, std::size_t hi)
+        {
+            using detail::narrow_size;
+            return narrow_size(gen, lo, hi);
+        }
+
+        inline std::size_t domain_size(any_generator)
+        {
+            return 0;
+        }
+
+        template<typename Gen>
+        std::size_t domain_size_adl(Gen const &gen)
+        {
+            using detail::domain_size;
+            return domain_size(gen);
+        }
+
+        template<typename Value>
+        void enumerate(any_generator, std::size_t, Value &)
+        {}
+
+        template<typename Gen, typename Value>
+        void enumerate_adl(Gen &gen, std::size_t index, Value &value)
+        {
+            using detail::enumerate;
+            enumerate(gen, index, value);
+        }
+
+        inline void set_shard(any_generator, std::size_t, std::size_t)
+        {}
+
+        template<typename Gen>
+        void set_shard_adl(Gen &gen, std::size_t shard_index, std::size_t nbr_shards)
+        {
+            using detail::set_shard;
+            set_shard(gen, shard_index, nbr_shards);
+        }
+
+        struct set_shard_fun
+        {
+            typedef void result_type;
+
+            set_shard_fun(std::size_t shard_index, std::size_t nbr_shards)
+              : shard_index_(shard_index)
+              , nbr_shards_(nbr_shards)
+            {}
+
+            template<typename T>
+            void operator()(T &t) const
+            {
+                detail::set_shard_adl(t, this->shard_index_, this->nbr_shards_);
+            }
+
+        private:
+            std::size_t shard_index_;
+            std::size_t nbr_shards_;
+        };
+
         struct set_size_fun
         {
             typedef void result_type;
@@ -61,6 +231,145 @@ namespace quick_check
     }
 
     using detail::set_size;
+
+    /// \fn shrink(Gen const &gen, Value const &value, std::vector<Value> &out)
+    /// \brief The customization point for shrinking values that caused a
+    ///        property to fail.
+    ///
+    /// When \c quick_check::qcheck() finds a failing set of arguments, it
+    /// tries to find a simpler set that still fails. It asks the generator that
+    /// produced each argument for simpler variants of the argument's value by
+    /// calling \c shrink() unqualified, so that it can be found by
+    /// argument-dependent lookup. An overload for a generator type \c Gen
+    /// should append to \c out candidate values that \c gen could have
+    /// generated and that are simpler than \c value, simplest first. The
+    /// default does nothing, meaning the value cannot be shrunk.
+    ///
+    /// \sa \c quick_check::_max_shrinks
+    /// \sa \c quick_check::shrink_each
+    using detail::shrink;
+
+    /// \fn shrink_each(Gen const &gen, Value const &value, Fun &fun)
+    /// \brief The customization point for shrinking values one candidate at
+    ///        a time.
+    ///
+    /// Calls <tt>fun(candidate)</tt> with the candidates that \c shrink()
+    /// would have appended, in the same order, each as a non-const lvalue of
+    /// type \c Value, until \c fun returns true. Returns whether it did.
+    /// \c fun may swap \c candidate with another value, but swaps it back
+    /// before returning false. After \c fun returns true, \c candidate must
+    /// not be touched again. \c qcheck() shrinks failing inputs with
+    /// \c shrink_each(), called unqualified, and stops asking for candidates
+    /// once one fails or the shrinking budget runs out. The default calls
+    /// \c shrink(), which is fine for small values. A generator of large
+    /// values, like sequences, can define an overload that builds each
+    /// candidate only when it is needed.
+    ///
+    /// \sa \c quick_check::shrink
+    using detail::shrink_each;
+
+    /// \fn generate_n(Gen &gen, Rng &rng, OutIter out, std::size_t n)
+    /// \brief The customization point for generating many values at once.
+    ///
+    /// Writes \c n values generated by \c gen to \c out, and returns the
+    /// iterator past the last one written. Generators of arrays and sequences,
+    /// and \c config::generate(), call \c generate_n() unqualified, so that it
+    /// can be found by argument-dependent lookup. An overload for a generator
+    /// type \c Gen may draw the values in a cheaper way than \c n calls to
+    /// <tt>gen(rng)</tt>, as long as they have the same distribution; they need
+    /// not be the same values. The default calls <tt>gen(rng)</tt> \c n times.
+    using detail::generate_n;
+
+    /// \fn generate_into(Gen &gen, Rng &rng, Value &value)
+    /// \brief The customization point for generating a value into existing
+    ///        storage.
+    ///
+    /// Replaces \c value with a value generated by \c gen. The \c qcheck()
+    /// algorithms generate each test case into the arguments of the last one
+    /// with \c config::operator()(result_type &), which calls
+    /// \c generate_into() unqualified, so that it can be found by
+    /// argument-dependent lookup. An overload for a generator type \c Gen
+    /// may reuse the storage of \c value, like the capacity of a container,
+    /// as long as the values it generates have the same distribution as
+    /// those of <tt>gen(rng)</tt>. \c value may have been moved from. The
+    /// default assigns <tt>gen(rng)</tt> to \c value.
+    using detail::generate_into;
+
+    /// \fn mutate(Gen &gen, Rng &rng, Value &value)
+    /// \brief The customization point for making variations of a value.
+    ///
+    /// \c quick_check::qcheck_guided() makes new test cases from ones that
+    /// reached new code by calling \c mutate() unqualified, so that it can be
+    /// found by argument-dependent lookup, on some of their arguments. An
+    /// overload for a generator type \c Gen should replace \c value with a
+    /// value that \c gen could have generated and that is, more often than
+    /// not, close to it: a neighbour, a bound of its range, or an element
+    /// added, removed or changed. The default replaces \c value with
+    /// <tt>gen(rng)</tt>.
+    using detail::mutate;
+
+    /// \fn narrow(Gen &gen, Value const &lo, Value const &hi)
+    /// \brief The customization point for restricting the values a generator
+    ///        produces to a closed range.
+    ///
+    /// \c quick_check::constrain() calls \c narrow() unqualified, so that it
+    /// can be found by argument-dependent lookup, when a property's condition
+    /// requires an argument to lie between \c lo and \c hi. An overload for a
+    /// generator type \c Gen should make \c gen produce only the values it
+    /// produced before that lie within <tt>[lo, hi]</tt>, with the same
+    /// relative frequencies, and return true. If it cannot, it should leave
+    /// \c gen alone and return false, which is what the default does.
+    using detail::narrow;
+
+    /// \fn narrow_size(Gen &gen, std::size_t lo, std::size_t hi)
+    /// \brief The customization point for restricting the sizes of the
+    ///        sequences a generator produces to a closed range.
+    ///
+    /// Like \c quick_check::narrow(), but for conditions on the size of an
+    /// argument, like <tt>phoenix::size(_1) \> 3</tt>. The default does nothing
+    /// and returns false.
+    using detail::narrow_size;
+
+    /// \fn domain_size(Gen const &gen)
+    /// \brief The customization point for counting the values a generator
+    ///        can produce.
+    ///
+    /// A config made with <tt>_exhaustive = true</tt> calls \c domain_size()
+    /// unqualified, so that it can be found by argument-dependent lookup, on
+    /// the generator of each argument. An overload for a generator type
+    /// \c Gen should return the number of distinct values \c gen can
+    /// produce, if it fits in a \c std::size_t, and 0 otherwise. The default
+    /// returns 0, meaning the values can't be enumerated.
+    ///
+    /// \sa \c quick_check::enumerate, \c quick_check::_exhaustive
+    using detail::domain_size;
+
+    /// \fn enumerate(Gen &gen, std::size_t index, Value &value)
+    /// \brief The customization point for listing the values a generator
+    ///        can produce.
+    ///
+    /// An overload for a generator type \c Gen whose \c domain_size()
+    /// returns \em N should replace \c value with the \c index-th of the
+    /// \em N values \c gen can produce, so that the indices in
+    /// <tt>[0, N)</tt> list each of them once. It is called unqualified, so
+    /// that it can be found by argument-dependent lookup. The default does
+    /// nothing; it is never called when \c domain_size() returns 0.
+    ///
+    /// \sa \c quick_check::domain_size, \c quick_check::_exhaustive
+    using detail::enumerate;
+
+    /// \fn set_shard(Gen &gen, std::size_t shard_index, std::size_t nbr_shards)
+    /// \brief The customization point for splitting the values a generator
+    ///        produces between the shards of a parallel test run.
+    ///
+    /// \c quick_check::qcheck_parallel() calls \c set_shard() unqualified, so
+    /// that it can be found by argument-dependent lookup, on the generators of
+    /// the copy of the config that each of its \c nbr_shards threads runs.
+    /// Generators whose values don't come from the random number generator,
+    /// like \c quick_check::file_generator\<\>, can use it to produce only
+    /// every \c nbr_shards-th of the values they would have produced, starting
+    /// with the \c shard_index-th one. The default does nothing.
+    using detail::set_shard;
 }
 
 QCHK_BOOST_NAMESPACE_END
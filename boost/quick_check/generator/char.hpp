@@ -17,9 +17,12 @@
 #include <climits>
 #include <cctype>
 #include <vector>
+#include <algorithm>
 #include <boost/cstdint.hpp>
 #include <boost/quick_check/quick_check_fwd.hpp>
 #include <boost/quick_check/generator/basic_generator.hpp>
+#include <boost/quick_check/detail/shrink.hpp>
+#include <boost/quick_check/detail/uniform_int.hpp>
 #include <boost/random/uniform_int_distribution.hpp>
 
 QCHK_BOOST_NAMESPACE_BEGIN
@@ -57,6 +60,45 @@ namespace quick_check
                 return chars_[dist_(rng)];
             }
 
+            template<typename Rng, typename OutIter>
+            friend OutIter generate_n(char_class_generator &thiz, Rng &rng, OutIter out, std::size_t n)
+            {
+                Char const *const chars = thiz.chars_.data();
+                auto const at = [chars](boost::uint32_t i) { return chars[i]; };
+                if(detail::uniform_int_n(rng, thiz.chars_.size() - 1, out, n, at))
+                    return out;
+                for(; n != 0; --n, ++out)
+                    *out = thiz(rng);
+                return out;
+            }
+
+            friend std::size_t domain_size(char_class_generator const &thiz)
+            {
+                return thiz.chars_.size();
+            }
+
+            friend void enumerate(char_class_generator &thiz, std::size_t index, Char &value)
+            {
+                value = thiz.chars_[index];
+            }
+
+            // Shrink towards the first character in the class.
+            friend void shrink(char_class_generator const &thiz, Char const &value, std::vector<Char> &out)
+            {
+                typename std::vector<Char>::const_iterator it =
+                    std::lower_bound(thiz.chars_.begin(), thiz.chars_.end(), value);
+                if(it == thiz.chars_.end() || *it != value)
+                    return;
+                std::vector<std::size_t> indices;
+                detail::shrink_integral(
+                    static_cast<std::size_t>(it - thiz.chars_.begin())
+                  , std::size_t(0)
+                  , indices
+                );
+                for(std::size_t i : indices)
+                    out.push_back(thiz.chars_[i]);
+            }
+
         private:
             random::uniform_int_distribution<std::size_t> dist_;
             std::vector<Char> chars_;
@@ -15,6 +15,8 @@
 #ifndef QCHK_GENERATOR_CONSTANT_HPP_INCLUDED
 #define QCHK_GENERATOR_CONSTANT_HPP_INCLUDED
 
+#include <cstddef>
+#include <algorithm>
 #include <boost/quick_check/quick_check_fwd.hpp>
 #include <boost/quick_check/generator/basic_generator.hpp>
 
@@ -39,6 +41,22 @@ namespace quick_check
                 return value_;
             }
 
+            template<typename Rng, typename OutIter>
+            friend OutIter generate_n(constant_generator &thiz, Rng &, OutIter out, std::size_t n)
+            {
+                return std::fill_n(out, n, thiz.value_);
+            }
+
+            friend std::size_t domain_size(constant_generator const &)
+            {
+                return 1;
+            }
+
+            friend void enumerate(constant_generator &thiz, std::size_t, Value &value)
+            {
+                value = thiz.value_;
+            }
+
         private:
             Value value_;
         };
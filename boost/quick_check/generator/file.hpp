@@ -0,0 +1,340 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file file.hpp
+/// \brief Definition of \c quick_check::file_generator\<\>, a generator that produces the values
+///        stored in a file.
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QCHK_GENERATOR_FILE_HPP_INCLUDED
+#define QCHK_GENERATOR_FILE_HPP_INCLUDED
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <boost/format.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/quick_check/quick_check_fwd.hpp>
+#include <boost/quick_check/generator/basic_generator.hpp>
+#include <boost/quick_check/detail/array.hpp>
+
+QCHK_BOOST_NAMESPACE_BEGIN
+
+namespace quick_check
+{
+    /// The formats of the files read by \c quick_check::file_generator\<\>
+    enum file_format
+    {
+        binary_file     ///< The values, as they are in memory, one after the other.
+      , text_file       ///< The values, as read by \c operator\>\>, separated by whitespace.
+    };
+
+    namespace detail
+    {
+        // The values in a file, mapped into memory or parsed once, and
+        // shared read-only by all the copies of a file_generator.
+        template<typename Value>
+        struct file_column
+        {
+            file_column(std::string const &path, file_format format)
+              : region_()
+              , parsed_()
+              , data_(0)
+              , size_(0)
+            {
+                if(format == binary_file)
+                {
+                    static_assert(std::is_trivially_copyable<Value>::value,
+                                  "Only trivially copyable values can be read from a binary file");
+                    std::ifstream in(path.c_str(), std::ios::binary | std::ios::ate);
+                    if(!in)
+                        file_column::error(path, "can't be opened");
+                    std::streamoff const bytes = in.tellg();
+                    in.close();
+                    if(bytes % std::streamoff(sizeof(Value)) != 0)
+                        file_column::error(path, "doesn't hold a whole number of values");
+                    if(bytes != 0)
+                    {
+                        boost::interprocess::file_mapping file(
+                            path.c_str(), boost::interprocess::read_only);
+                        boost::interprocess::mapped_region(
+                            file, boost::interprocess::read_only).swap(this->region_);
+                        this->data_ = static_cast<Value const *>(this->region_.get_address());
+                        this->size_ = this->region_.get_size() / sizeof(Value);
+                    }
+                }
+                else
+                {
+                    std::ifstream in(path.c_str());
+                    if(!in)
+                        file_column::error(path, "can't be opened");
+                    this->parsed_.assign(std::istream_iterator<Value>(in),
+                                         std::istream_iterator<Value>());
+                    if(!in.eof())
+                        file_column::error(path, "holds something that isn't a value");
+                    this->data_ = this->parsed_.data();
+                    this->size_ = this->parsed_.size();
+                }
+            }
+
+            Value const *data() const
+            {
+                return this->data_;
+            }
+
+            std::size_t size() const
+            {
+                return this->size_;
+            }
+
+            static void error(std::string const &path, char const *what)
+            {
+                throw std::runtime_error(
+                    (boost::format("The input file %1% %2%.") % path % what).str());
+            }
+
+        private:
+            file_column(file_column const &);
+            file_column &operator=(file_column const &);
+
+            boost::interprocess::mapped_region region_;
+            std::vector<Value> parsed_;
+            Value const *data_;
+            std::size_t size_;
+        };
+
+        // The records of Width values of a file_column that a
+        // file_generator visits: those at position(), position() + stride(),
+        // position() + 2 * stride(), and so on, wrapping around at the end.
+        template<typename Value, std::size_t Width>
+        struct file_cursor
+        {
+            file_cursor(std::string const &path, file_format format)
+              : column_(std::make_shared<file_column<Value> >(path, format))
+              , records_(column_->size() / Width)
+              , position_(0)
+              , stride_(1)
+            {
+                if(this->records_ == 0)
+                    file_column<Value>::error(path, "holds too few values");
+            }
+
+            std::size_t size() const
+            {
+                return this->records_;
+            }
+
+            std::size_t position() const
+            {
+                return this->position_;
+            }
+
+            std::size_t stride() const
+            {
+                return this->stride_;
+            }
+
+            void seek(std::size_t position)
+            {
+                this->position_ = position % this->records_;
+            }
+
+            void set_shard(std::size_t shard_index, std::size_t nbr_shards)
+            {
+                this->seek(this->position_ + shard_index * this->stride_ % this->records_);
+                this->stride_ = nbr_shards * this->stride_ % this->records_;
+            }
+
+            // The first value of the next record
+            Value const *next()
+            {
+                Value const *const record = this->column_->data() + this->position_ * Width;
+                this->seek(this->position_ + this->stride_);
+                return record;
+            }
+
+            // Copy the next n records to out, a contiguous run at a time
+            // when the records are.
+            template<typename OutIter>
+            OutIter copy_n(OutIter out, std::size_t n)
+            {
+                if(this->stride_ != 1)
+                {
+                    for(; n != 0; --n)
+                        out = std::copy_n(this->next(), Width, out);
+                    return out;
+                }
+                while(n != 0)
+                {
+                    std::size_t const count = (std::min)(n, this->records_ - this->position_);
+                    out = std::copy_n(this->column_->data() + this->position_ * Width,
+                                      count * Width, out);
+                    this->seek(this->position_ + count);
+                    n -= count;
+                }
+                return out;
+            }
+
+        private:
+            std::shared_ptr<file_column<Value> const> column_;
+            std::size_t records_;
+            std::size_t position_;
+            std::size_t stride_;
+        };
+    }
+
+    /// \brief For generating the values stored in a file
+    ///
+    /// \tparam Value The type of the values to generate.
+    ///
+    /// Use \c file_generator\<\> to feed recorded data into a property. The
+    /// values are produced in the order in which they are stored, starting
+    /// again at the beginning after the last one. A binary file is mapped
+    /// into memory, and its values are copied straight out of the mapping;
+    /// a text file is parsed once, when the generator is constructed. Either
+    /// way, copies of a \c file_generator\<\> share the values read-only,
+    /// but each has its own position in them.
+    ///
+    /// When \c quick_check::qcheck_parallel() splits a config into shards,
+    /// it calls \c quick_check::set_shard() on each shard's generators, so
+    /// with \em N threads, the \em i-th shard's \c file_generator\<\>
+    /// produces the values at positions \em i, \em i+N, \em i+2N, and so on.
+    /// The shards then see the same values as \c quick_check::qcheck() would,
+    /// without sharing any state. Since the values depend on how many have
+    /// been produced, and not on the index of the test case, a config with a
+    /// \c file_generator\<\> can't regenerate a test case from its index.
+    ///
+    /// \em Example:
+    ///
+    /*! \code
+        // A binary file of doubles, and a text file of ints
+        file_generator<double> prices("prices.bin");
+        file_generator<int> sizes("sizes.txt", text_file);
+        auto config = make_config(_1 = prices, _2 = sizes);
+        \endcode
+    */
+    template<typename Value>
+    struct file_generator
+    {
+        /// Construct a \c file_generator\<\> object
+        ///
+        /// \param path The name of the file.
+        /// \param format The format of the file. Defaults to \c binary_file.
+        ///
+        /// \throw std::runtime_error if the file can't be opened, is empty,
+        ///        or doesn't hold a whole number of values.
+        explicit file_generator(std::string const &path, file_format format = binary_file)
+          : cursor_(path, format)
+        {}
+
+        typedef Value result_type;
+
+        /// Returns the next value in the file. \c rng is not used.
+        template<typename Rng>
+        result_type operator()(Rng &)
+        {
+            return *this->cursor_.next();
+        }
+
+        /// Returns the number of values in the file.
+        ///
+        /// \throw nothrow
+        std::size_t size() const
+        {
+            return this->cursor_.size();
+        }
+
+        /// Returns the position in the file of the next value.
+        ///
+        /// \throw nothrow
+        std::size_t position() const
+        {
+            return this->cursor_.position();
+        }
+
+        /// Makes the value at <tt>position % this->size()</tt> the next one.
+        ///
+        /// \throw nothrow
+        void seek(std::size_t position)
+        {
+            this->cursor_.seek(position);
+        }
+
+        /// Copies the next \c n values straight to \c out.
+        template<typename Rng, typename OutIter>
+        friend OutIter generate_n(file_generator &gen, Rng &, OutIter out, std::size_t n)
+        {
+            return gen.cursor_.copy_n(out, n);
+        }
+
+        /// Produces only every \c nbr_shards-th value, starting with the
+        /// \c shard_index-th one.
+        friend void set_shard(file_generator &gen, std::size_t shard_index, std::size_t nbr_shards)
+        {
+            gen.cursor_.set_shard(shard_index, nbr_shards);
+        }
+
+    private:
+        detail::file_cursor<Value, 1> cursor_;
+    };
+
+    /// \brief For generating arrays of the values stored in a file. Each
+    ///        array is made of \c N consecutive values.
+    template<typename Value, std::size_t N>
+    struct file_generator<Value[N]>
+    {
+        explicit file_generator(std::string const &path, file_format format = binary_file)
+          : cursor_(path, format)
+        {}
+
+        typedef detail::array<Value[N]> result_type;
+
+        template<typename Rng>
+        result_type operator()(Rng &)
+        {
+            result_type res;
+            std::copy_n(this->cursor_.next(), N, res.elems.elems);
+            return res;
+        }
+
+        /// Returns the number of whole arrays in the file.
+        std::size_t size() const
+        {
+            return this->cursor_.size();
+        }
+
+        std::size_t position() const
+        {
+            return this->cursor_.position();
+        }
+
+        void seek(std::size_t position)
+        {
+            this->cursor_.seek(position);
+        }
+
+        friend void set_shard(file_generator &gen, std::size_t shard_index, std::size_t nbr_shards)
+        {
+            gen.cursor_.set_shard(shard_index, nbr_shards);
+        }
+
+    private:
+        detail::file_cursor<Value, N> cursor_;
+    };
+}
+
+QCHK_BOOST_NAMESPACE_END
+
+#endif
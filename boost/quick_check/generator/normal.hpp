@@ -15,12 +15,16 @@
 #ifndef QCHK_GENERATOR_NORMAL_HPP_INCLUDED
 #define QCHK_GENERATOR_NORMAL_HPP_INCLUDED
 
+#include <limits>
+#include <vector>
 #include <algorithm>
 #include <boost/quick_check/detail/array.hpp>
 #include <boost/random/normal_distribution.hpp>
 #include <boost/type_traits/is_floating_point.hpp>
 #include <boost/quick_check/quick_check_fwd.hpp>
 #include <boost/quick_check/generator/basic_generator.hpp>
+#include <boost/quick_check/detail/shrink.hpp>
+#include <boost/quick_check/detail/mutate.hpp>
 
 QCHK_BOOST_NAMESPACE_BEGIN
 
@@ -94,6 +98,22 @@ namespace quick_check
         {
             return this->base_type::operator()(rng);
         }
+
+        /// Shrinks \c value towards 0.
+        friend void shrink(normal const &, Value const &value, std::vector<Value> &out)
+        {
+            Value const inf = std::numeric_limits<Value>::infinity();
+            detail::shrink_floating(value, Value(0), -inf, inf, out);
+        }
+
+        /// Replaces \c value with a variation of it within six standard
+        /// deviations of the mean.
+        template<typename Rng>
+        friend void mutate(normal &gen, Rng &rng, Value &value)
+        {
+            Value const spread = 6 * gen.sigma();
+            detail::mutate_floating(rng, value, gen.mean() - spread, gen.mean() + spread);
+        }
     };
 
     template<typename Value, std::size_t N>
@@ -117,10 +137,23 @@ namespace quick_check
         result_type operator()(Rng& rng)
         {
             result_type res;
-            std::generate_n(res.elems.elems, N, [&] { return gen_(rng); });
+            detail::generate_n_adl(gen_, rng, res.elems.elems, N);
             return res;
         }
 
+        /// Shrinks the elements of \c value one at a time.
+        friend void shrink(normal const &gen, result_type const &value, std::vector<result_type> &out)
+        {
+            detail::shrink_elements(gen.gen_, value, out);
+        }
+
+        /// Mutates one element of \c value.
+        template<typename Rng>
+        friend void mutate(normal &gen, Rng &rng, result_type &value)
+        {
+            detail::mutate_elements(gen.gen_, rng, value);
+        }
+
     private:
         normal<Value> gen_;
     };
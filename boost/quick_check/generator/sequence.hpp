@@ -16,15 +16,18 @@
 #define QCHK_GENERATOR_SEQUENCE_HPP_INCLUDED
 
 #include <cstddef>
+#include <vector>
 #include <iterator>
 #include <algorithm>
 #include <boost/mpl/bool.hpp>
 #include <boost/move/utility.hpp>
 #include <boost/type_traits/is_convertible.hpp>
+#include <boost/type_traits/is_same.hpp>
 #include <boost/iterator/iterator_traits.hpp>
 #include <boost/random/uniform_int_distribution.hpp>
 #include <boost/quick_check/quick_check_fwd.hpp>
 #include <boost/quick_check/generator/basic_generator.hpp>
+#include <boost/quick_check/detail/mutate.hpp>
 
 QCHK_BOOST_NAMESPACE_BEGIN
 
@@ -97,17 +100,30 @@ namespace quick_check
             template<typename Rng>
             Seq operator()(Rng &rng)
             {
-                std::size_t size = size_dist_(rng);
                 result_type res;
-                sequence_generator::reserve_(res, size, has_reserve<Seq>());
-                std::generate_n(
-                    std::back_inserter(res)
-                  , size
-                  , [&] { return gen_(rng); }
-                );
+                this->generate(rng, res);
                 return boost::move(res);
             }
 
+            // Replace the contents of out with a new sequence, keeping its
+            // capacity, so that refilling the same container allocates
+            // nothing once it has grown to size. The sequence is the one
+            // (*this)(rng) would have returned.
+            template<typename Rng>
+            void generate(Rng &rng, Seq &out)
+            {
+                std::size_t size = size_dist_(rng);
+                out.clear();
+                sequence_generator::reserve_(out, size, has_reserve<Seq>());
+                detail::generate_n_adl(gen_, rng, std::back_inserter(out), size);
+            }
+
+            template<typename Rng>
+            friend void generate_into(sequence_generator &thiz, Rng &rng, Seq &out)
+            {
+                thiz.generate(rng, out);
+            }
+
             friend void set_size(sequence_generator &thiz, std::size_t size)
             {
                 BOOST_ASSERT(size >= 1);
@@ -116,13 +132,136 @@ namespace quick_check
                 detail::set_size_adl(thiz.gen_, size);
             }
 
+            // Narrow the range of sizes to its intersection with [lo, hi].
+            // The sizes are reset by the next call to set_size.
+            friend bool narrow_size(sequence_generator &thiz, std::size_t lo, std::size_t hi)
+            {
+                std::size_t const a = (std::max)(thiz.size_dist_.a(), lo);
+                std::size_t const b = (std::min)(thiz.size_dist_.b(), hi);
+                if(b < a)
+                    return false;
+                thiz.size_dist_.param(typename size_dist_type::param_type(a, b));
+                return true;
+            }
+
+            // Shrink by first removing ever smaller chunks of elements, and
+            // then by shrinking the elements one at a time.
+            friend void shrink(sequence_generator const &thiz, Seq const &seq, std::vector<Seq> &out)
+            {
+                detail::append_candidate<Seq> append(out);
+                shrink_each(thiz, seq, append);
+            }
+
+            // The same candidates, built one at a time in the same container,
+            // so that those after the one fun stops at are never built.
+            template<typename Fun>
+            friend bool shrink_each(sequence_generator const &thiz, Seq const &seq, Fun &fun)
+            {
+                typedef typename Seq::const_iterator iterator;
+                std::size_t const size = static_cast<std::size_t>(std::distance(seq.begin(), seq.end()));
+                if(size == 0)
+                    return false;
+                Seq candidate;
+                if(fun(candidate))
+                    return true;
+                for(std::size_t chunk = size / 2; chunk != 0; chunk /= 2)
+                {
+                    for(std::size_t pos = 0; pos + chunk <= size; pos += chunk)
+                    {
+                        iterator const first = std::next(seq.begin(), pos);
+                        iterator const last = std::next(first, chunk);
+                        candidate.clear();
+                        std::copy(seq.begin(), first, std::back_inserter(candidate));
+                        std::copy(last, seq.end(), std::back_inserter(candidate));
+                        if(fun(candidate))
+                            return true;
+                    }
+                }
+                return thiz.shrink_elements_(
+                    seq
+                  , candidate
+                  , fun
+                  , boost::is_same<
+                        typename Gen::result_type
+                      , typename boost::iterator_value<typename Seq::iterator>::type
+                    >()
+                );
+            }
+
+            // Mutate by removing an element, inserting a new one, or
+            // mutating one, keeping the size within the range of sizes.
+            template<typename Rng>
+            friend void mutate(sequence_generator &thiz, Rng &rng, Seq &seq)
+            {
+                std::size_t const size = static_cast<std::size_t>(std::distance(seq.begin(), seq.end()));
+                std::size_t const op = detail::random_below(rng, 3);
+                if(op == 0 && size > thiz.size_dist_.a())
+                    seq.erase(std::next(seq.begin(), detail::random_below(rng, size)));
+                else if(op == 1 && size < thiz.size_dist_.b())
+                    seq.insert(std::next(seq.begin(), detail::random_below(rng, size + 1)),
+                               thiz.gen_(rng));
+                else if(size != 0)
+                    thiz.mutate_element_(
+                        rng
+                      , *std::next(seq.begin(), detail::random_below(rng, size))
+                      , boost::is_same<
+                            typename Gen::result_type
+                          , typename boost::iterator_value<typename Seq::iterator>::type
+                        >()
+                    );
+                else
+                    thiz.generate(rng, seq);
+            }
+
         private:
+            template<typename Rng, typename Value>
+            void mutate_element_(Rng &rng, Value &value, boost::false_type)
+            {
+                value = this->gen_(rng);
+            }
+
+            template<typename Rng, typename Value>
+            void mutate_element_(Rng &rng, Value &value, boost::true_type)
+            {
+                detail::mutate_adl(this->gen_, rng, value);
+            }
+
+            template<typename Fun>
+            bool shrink_elements_(Seq const &, Seq &, Fun &, boost::false_type) const
+            {
+                return false;
+            }
+
+            template<typename Fun>
+            bool shrink_elements_(Seq const &seq, Seq &candidate, Fun &fun, boost::true_type) const
+            {
+                typedef typename Gen::result_type value_type;
+                std::vector<value_type> values;
+                std::size_t pos = 0;
+                for(value_type const &value : seq)
+                {
+                    values.clear();
+                    detail::shrink_adl(this->gen_, value, values);
+                    for(value_type &v : values)
+                    {
+                        candidate = seq;
+                        *std::next(candidate.begin(), pos) = boost::move(v);
+                        if(fun(candidate))
+                            return true;
+                    }
+                    ++pos;
+                }
+                return false;
+            }
+
             static void reserve_(Seq &, std::size_t size, mpl::false_)
             {}
 
+            // Only grow: before C++20, a smaller reserve() may shrink.
             static void reserve_(Seq &seq, std::size_t size, mpl::true_)
             {
-                seq.reserve(size);
+                if(seq.capacity() < size)
+                    seq.reserve(size);
             }
 
             size_dist_type size_dist_;
@@ -153,10 +292,64 @@ namespace quick_check
             template<typename Rng>
             Seq operator()(Rng &rng)
             {
-                Seq seq = static_cast<sequence_generator<Seq, Gen> &>(*this)(rng);
-                std::sort(seq.begin(), seq.end());
+                Seq seq;
+                this->generate(rng, seq);
                 return boost::move(seq);
             }
+
+            template<typename Rng>
+            void generate(Rng &rng, Seq &out)
+            {
+                static_cast<sequence_generator<Seq, Gen> &>(*this).generate(rng, out);
+                std::sort(out.begin(), out.end());
+            }
+
+            template<typename Rng>
+            friend void generate_into(ordered_sequence_generator &thiz, Rng &rng, Seq &out)
+            {
+                thiz.generate(rng, out);
+            }
+
+            friend void shrink(ordered_sequence_generator const &thiz, Seq const &seq, std::vector<Seq> &out)
+            {
+                detail::append_candidate<Seq> append(out);
+                shrink_each(thiz, seq, append);
+            }
+
+            template<typename Fun>
+            friend bool shrink_each(ordered_sequence_generator const &thiz, Seq const &seq, Fun &fun)
+            {
+                sort_candidate<Fun> sorted(fun);
+                return shrink_each(static_cast<sequence_generator<Seq, Gen> const &>(thiz), seq, sorted);
+            }
+
+        private:
+            // Sorts each candidate before passing it on.
+            template<typename Fun>
+            struct sort_candidate
+            {
+                explicit sort_candidate(Fun &fun)
+                  : fun_(fun)
+                {}
+
+                bool operator()(Seq &candidate) const
+                {
+                    std::sort(candidate.begin(), candidate.end());
+                    return this->fun_(candidate);
+                }
+
+            private:
+                sort_candidate &operator=(sort_candidate const &);
+                Fun &fun_;
+            };
+
+        public:
+            template<typename Rng>
+            friend void mutate(ordered_sequence_generator &thiz, Rng &rng, Seq &seq)
+            {
+                mutate(static_cast<sequence_generator<Seq, Gen> &>(thiz), rng, seq);
+                std::sort(seq.begin(), seq.end());
+            }
         };
     }
 
@@ -172,9 +365,14 @@ namespace quick_check
     /// \c quick_check::config::sized() on the \c config\<\> object that
     /// \c quick_check::make_config() returns.
     ///
+    /// The generator overloads \c quick_check::generate_into(), so that
+    /// \c qcheck() refills the sequence of the last test case, and
+    /// reuses its capacity if \c Seq has a \c reserve() member.
+    ///
     /// \sa \c quick_check::ordered_vector
     /// \sa \c quick_check::_sized
     /// \sa \c quick_check::config::sized
+    /// \sa \c quick_check::generate_into
     template<typename Seq, typename Gen>
     detail::sequence_generator<Seq, Gen>
     sequence(Gen const &gen)
@@ -14,6 +14,8 @@
 #ifndef QCHK_GENERATOR_TRANSFORM_HPP_INCLUDED
 #define QCHK_GENERATOR_TRANSFORM_HPP_INCLUDED
 
+#include <cstddef>
+#include <iterator>
 #include <boost/utility/result_of.hpp>
 #include <boost/quick_check/quick_check_fwd.hpp>
 #include <boost/quick_check/generator/basic_generator.hpp>
@@ -24,6 +26,57 @@ namespace quick_check
 {
     namespace detail
     {
+        // An output iterator that passes the values written to it through
+        // fun before writing them to out.
+        template<typename OutIter, typename UnaryFunction>
+        struct transform_output_iterator
+        {
+            typedef std::output_iterator_tag iterator_category;
+            typedef void value_type;
+            typedef void difference_type;
+            typedef void pointer;
+            typedef void reference;
+
+            transform_output_iterator(OutIter out, UnaryFunction &fun)
+              : out_(out)
+              , fun_(&fun)
+            {}
+
+            transform_output_iterator &operator*()
+            {
+                return *this;
+            }
+
+            transform_output_iterator &operator++()
+            {
+                ++this->out_;
+                return *this;
+            }
+
+            transform_output_iterator operator++(int)
+            {
+                transform_output_iterator tmp(*this);
+                ++this->out_;
+                return tmp;
+            }
+
+            template<typename Value>
+            transform_output_iterator &operator=(Value const &value)
+            {
+                *this->out_ = (*this->fun_)(value);
+                return *this;
+            }
+
+            OutIter base() const
+            {
+                return this->out_;
+            }
+
+        private:
+            OutIter out_;
+            UnaryFunction *fun_;
+        };
+
         template<typename Generator, typename UnaryFunction>
         struct transform_generator
         {
@@ -49,6 +102,17 @@ namespace quick_check
                 detail::set_size_adl(thiz.gen_, size);
             }
 
+            template<typename Rng, typename OutIter>
+            friend OutIter generate_n(transform_generator &thiz, Rng &rng, OutIter out, std::size_t n)
+            {
+                return detail::generate_n_adl(
+                    thiz.gen_
+                  , rng
+                  , transform_output_iterator<OutIter, UnaryFunction>(out, thiz.fun_)
+                  , n
+                ).base();
+            }
+
         private:
             Generator gen_;
             UnaryFunction fun_;
@@ -15,8 +15,12 @@
 #ifndef QCHK_GENERATOR_UNIFORM_HPP_INCLUDED
 #define QCHK_GENERATOR_UNIFORM_HPP_INCLUDED
 
+#include <cmath>
+#include <limits>
+#include <vector>
 #include <algorithm>
 #include <boost/mpl/if.hpp>
+#include <boost/mpl/bool.hpp>
 #include <boost/quick_check/detail/array.hpp>
 #include <boost/random/uniform_int_distribution.hpp>
 #include <boost/random/uniform_real_distribution.hpp>
@@ -24,6 +28,11 @@
 #include <boost/type_traits/is_integral.hpp>
 #include <boost/quick_check/quick_check_fwd.hpp>
 #include <boost/quick_check/generator/basic_generator.hpp>
+#include <boost/quick_check/detail/shrink.hpp>
+#include <boost/quick_check/detail/mutate.hpp>
+#include <boost/quick_check/detail/enumerate.hpp>
+#include <boost/quick_check/detail/random.hpp>
+#include <boost/quick_check/detail/uniform_int.hpp>
 
 QCHK_BOOST_NAMESPACE_BEGIN
 
@@ -111,6 +120,156 @@ namespace quick_check
         {
             return this->base_type::operator()(rng);
         }
+
+        /// Shrinks \c value towards the value within the range of \c gen
+        /// that is closest to 0.
+        friend void shrink(uniform const &gen, Value const &value, std::vector<Value> &out)
+        {
+            gen.shrink_(value, out, mpl::bool_<boost::is_floating_point<Value>::value>());
+        }
+
+        /// Replaces \c value with a bound of the range of \c gen, with the
+        /// value within it closest to 0, or with a value near \c value.
+        template<typename Rng>
+        friend void mutate(uniform &gen, Rng &rng, Value &value)
+        {
+            gen.mutate_(rng, value, mpl::bool_<boost::is_floating_point<Value>::value>());
+        }
+
+        /// Narrows the range of \c gen to its intersection with
+        /// <tt>[lo, hi]</tt>, unless that is empty. Returns whether it did.
+        friend bool narrow(uniform &gen, Value lo, Value hi)
+        {
+            return gen.narrow_(lo, hi, mpl::bool_<boost::is_floating_point<Value>::value>());
+        }
+
+        // Integers are mapped straight from the raw output of rng when
+        // possible; see detail::uniform_int_n.
+        template<typename Rng, typename OutIter>
+        friend OutIter generate_n(uniform &gen, Rng &rng, OutIter out, std::size_t n)
+        {
+            return gen.generate_n_(rng, out, n, mpl::bool_<boost::is_integral<Value>::value>());
+        }
+
+        /// Returns the number of values in the range of \c gen if \c Value
+        /// is integral and the number fits in a \c std::size_t, and 0
+        /// otherwise.
+        friend std::size_t domain_size(uniform const &gen)
+        {
+            return gen.domain_size_(mpl::bool_<boost::is_floating_point<Value>::value>());
+        }
+
+        /// Replaces \c value with the \c index-th value in the range of
+        /// \c gen, counting up from its lower bound.
+        friend void enumerate(uniform &gen, std::size_t index, Value &value)
+        {
+            gen.enumerate_(index, value, mpl::bool_<boost::is_floating_point<Value>::value>());
+        }
+
+    private:
+        std::size_t domain_size_(mpl::false_) const
+        {
+            boost::uintmax_t const range =
+                static_cast<boost::uintmax_t>(this->b()) - static_cast<boost::uintmax_t>(this->a());
+            return range < (std::numeric_limits<std::size_t>::max)() ? std::size_t(range) + 1 : 0;
+        }
+
+        std::size_t domain_size_(mpl::true_) const
+        {
+            return 0;
+        }
+
+        void enumerate_(std::size_t index, Value &value, mpl::false_) const
+        {
+            value = static_cast<Value>(static_cast<boost::uintmax_t>(this->a()) + index);
+        }
+
+        void enumerate_(std::size_t, Value &, mpl::true_) const
+        {}
+
+        template<typename Rng, typename OutIter>
+        OutIter generate_n_(Rng &rng, OutIter out, std::size_t n, mpl::true_)
+        {
+            boost::uintmax_t const lo = static_cast<boost::uintmax_t>(this->a());
+            boost::uintmax_t const range = static_cast<boost::uintmax_t>(this->b()) - lo;
+            auto const add_lo = [lo](boost::uint32_t offset)
+            {
+                return static_cast<Value>(lo + offset);
+            };
+            if(detail::uniform_int_n(rng, range, out, n, add_lo))
+                return out;
+            return this->generate_n_(rng, out, n, mpl::false_(), mpl::false_());
+        }
+
+        template<typename Rng, typename OutIter>
+        OutIter generate_n_(Rng &rng, OutIter out, std::size_t n, mpl::false_)
+        {
+            return this->generate_n_(rng, out, n, mpl::false_(), detail::has_fill<Rng>());
+        }
+
+        // Floating-point values are made from blocks of words when rng
+        // has a fill member; see detail::uniform_real_n.
+        template<typename Rng, typename OutIter>
+        OutIter generate_n_(Rng &rng, OutIter out, std::size_t n, mpl::false_, mpl::true_)
+        {
+            return detail::uniform_real_n(rng, this->a(), this->b(), out, n);
+        }
+
+        template<typename Rng, typename OutIter>
+        OutIter generate_n_(Rng &rng, OutIter out, std::size_t n, mpl::false_, mpl::false_)
+        {
+            for(; n != 0; --n, ++out)
+                *out = this->base_type::operator()(rng);
+            return out;
+        }
+
+        bool narrow_(Value lo, Value hi, mpl::false_)
+        {
+            Value const a = (std::max)(this->a(), lo), b = (std::min)(this->b(), hi);
+            if(b < a)
+                return false;
+            this->param(typename base_type::param_type(a, b));
+            return true;
+        }
+
+        // The upper bound of a uniform_real_distribution is exclusive, and
+        // it can't be equal to the lower one.
+        bool narrow_(Value lo, Value hi, mpl::true_)
+        {
+            Value const a = (std::max)(this->a(), lo), b = (std::min)(this->b(), hi);
+            if(!(a < b))
+                return false;
+            this->param(typename base_type::param_type(a, b));
+            return true;
+        }
+
+        template<typename Rng>
+        void mutate_(Rng &rng, Value &value, mpl::false_) const
+        {
+            detail::mutate_integral(rng, value, this->a(), this->b());
+        }
+
+        template<typename Rng>
+        void mutate_(Rng &rng, Value &value, mpl::true_) const
+        {
+            // The upper bound of a uniform_real_distribution is exclusive.
+            Value const lo = this->a();
+            Value const hi = lo < this->b() ? std::nextafter(this->b(), lo) : lo;
+            detail::mutate_floating(rng, value, lo, hi);
+        }
+
+        void shrink_(Value value, std::vector<Value> &out, mpl::false_) const
+        {
+            detail::shrink_integral(value, detail::shrink_target(this->a(), this->b()), out);
+        }
+
+        void shrink_(Value value, std::vector<Value> &out, mpl::true_) const
+        {
+            // The upper bound of a uniform_real_distribution is exclusive.
+            Value const lo = this->a();
+            Value const hi = lo < this->b() ? std::nextafter(this->b(), lo) : lo;
+            detail::shrink_floating(value, detail::shrink_target(lo, hi), lo, hi, out);
+        }
     };
 
     template<typename Value, std::size_t N>
@@ -134,10 +293,37 @@ namespace quick_check
         result_type operator()(Rng& rng)
         {
             result_type res;
-            std::generate_n(res.elems.elems, N, [&] { return gen_(rng); });
+            detail::generate_n_adl(gen_, rng, res.elems.elems, N);
             return res;
         }
 
+        /// Shrinks the elements of \c value one at a time.
+        friend void shrink(uniform const &gen, result_type const &value, std::vector<result_type> &out)
+        {
+            detail::shrink_elements(gen.gen_, value, out);
+        }
+
+        /// Mutates one element of \c value.
+        template<typename Rng>
+        friend void mutate(uniform &gen, Rng &rng, result_type &value)
+        {
+            detail::mutate_elements(gen.gen_, rng, value);
+        }
+
+        /// Returns the number of arrays of \c N values in the range of
+        /// \c gen, or 0 if it doesn't fit in a \c std::size_t.
+        friend std::size_t domain_size(uniform const &gen)
+        {
+            return detail::domain_size_elements<N>(gen.gen_);
+        }
+
+        /// Replaces \c value with the \c index-th array, with its first
+        /// element varying fastest.
+        friend void enumerate(uniform &gen, std::size_t index, result_type &value)
+        {
+            detail::enumerate_elements(gen.gen_, index, value);
+        }
+
     private:
         uniform<Value> gen_;
     };
@@ -34,6 +34,10 @@ namespace quick_check
     /// \c quick_check::config::sized() on the \c config\<\> object that
     /// \c quick_check::make_config() returns.
     ///
+    /// \c qcheck() generates the vector of each test case into that of the
+    /// last one. Once that has grown to size, vectors of scalars are
+    /// generated without allocating.
+    ///
     /// \sa \c quick_check::ordered_vector
     /// \sa \c quick_check::_sized
     /// \sa \c quick_check::config::sized
@@ -14,10 +14,13 @@
 #ifndef QCHK_GENERATOR_ZIP_HPP_INCLUDED
 #define QCHK_GENERATOR_ZIP_HPP_INCLUDED
 
+#include <vector>
 #include <utility>
 #include <boost/utility/result_of.hpp>
+#include <boost/move/utility.hpp>
 #include <boost/quick_check/quick_check_fwd.hpp>
 #include <boost/quick_check/generator/basic_generator.hpp>
+#include <boost/quick_check/detail/enumerate.hpp>
 
 QCHK_BOOST_NAMESPACE_BEGIN
 
@@ -52,6 +55,35 @@ namespace quick_check
                 detail::set_size_adl(thiz.gen1_, size);
             }
 
+            friend void shrink(zip_generator const &thiz, result_type const &value, std::vector<result_type> &out)
+            {
+                std::vector<typename Generator0::result_type> firsts;
+                detail::shrink_adl(thiz.gen0_, value.first, firsts);
+                for(auto &first : firsts)
+                    out.push_back(result_type(boost::move(first), value.second));
+
+                std::vector<typename Generator1::result_type> seconds;
+                detail::shrink_adl(thiz.gen1_, value.second, seconds);
+                for(auto &second : seconds)
+                    out.push_back(result_type(value.first, boost::move(second)));
+            }
+
+            friend std::size_t domain_size(zip_generator const &thiz)
+            {
+                return detail::domain_product(
+                    detail::domain_size_adl(thiz.gen0_)
+                  , detail::domain_size_adl(thiz.gen1_)
+                );
+            }
+
+            // The first element of the pair varies fastest.
+            friend void enumerate(zip_generator &thiz, std::size_t index, result_type &value)
+            {
+                std::size_t const size0 = detail::domain_size_adl(thiz.gen0_);
+                detail::enumerate_adl(thiz.gen0_, index % size0, value.first);
+                detail::enumerate_adl(thiz.gen1_, index / size0, value.second);
+            }
+
         private:
             Generator0 gen0_;
             Generator1 gen1_;
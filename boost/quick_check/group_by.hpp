@@ -140,6 +140,13 @@ namespace quick_check
             return prop.grouper();
         }
 #endif
+
+        template<typename Args, typename Group>
+        typename property_view<Args, Group>::grouper_type
+        get_grouper(property_view<Args, Group> const &prop)
+        {
+            return prop.grouper();
+        }
     }
 
     /// \brief Used as the final template parameter to \c quick_check::property\<\>
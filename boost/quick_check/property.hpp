@@ -30,6 +30,7 @@
 #include <boost/quick_check/condition.hpp>
 #include <boost/quick_check/classify.hpp>
 #include <boost/quick_check/group_by.hpp>
+#include <boost/quick_check/detail/evaluate.hpp>
 
 QCHK_BOOST_NAMESPACE_BEGIN
 
@@ -234,9 +235,10 @@ namespace quick_check
         grouped_by_type;
 
     private:
-        boost::function<std::vector<std::string>(args_type const &)> classifier_;
+        detail::any_classifier<args_type> classifier_;
         boost::function<grouped_by_type(args_type const &)> grouper_;
         boost::function<bool(args_type const &)> condition_;
+        detail::any_evaluator<args_type, grouped_by_type> evaluator_;
 
     public:
         /// Default-construct an empty property
@@ -245,6 +247,7 @@ namespace quick_check
           , classifier_()
           , grouper_()
           , condition_()
+          , evaluator_()
         {}
 
         /// Initialize a \c property<> object with a property expression.
@@ -261,6 +264,7 @@ namespace quick_check
           , classifier_(detail::GetClassifiers()(expr, detail::unclassified_args()))
           , grouper_(detail::GetGrouper()(expr))
           , condition_(detail::GetCondition()(expr))
+          , evaluator_(detail::GetEvaluator()(expr))
         {}
 
         typedef bool result_type; // for TR1
@@ -291,7 +295,7 @@ namespace quick_check
         /// <tt><a href="http://www.sgi.com/tech/stl/ForwardContainer.html">
         /// ForwardContainer</a></tt> whose \c value_type is \c std::string.
         typedef
-            QCHK_DOXY_DETAIL(boost::function<std::vector<std::string>(args_type const &)>)
+            QCHK_DOXY_DETAIL(detail::any_classifier<args_type>)
         classifier_type;
 
         /// \return A unary function corresponding to the \c classify()
@@ -336,6 +340,17 @@ namespace quick_check
         {
             return this->condition_;
         }
+
+        /// INTERNAL ONLY
+        typedef detail::any_evaluator<args_type, grouped_by_type> evaluator_type;
+
+        /// INTERNAL ONLY
+        /// Evaluates the condition, classifiers, grouper and property for
+        /// one set of arguments with a single indirect call.
+        evaluator_type const &evaluator() const
+        {
+            return this->evaluator_;
+        }
     };
 }
 
@@ -14,20 +14,34 @@
 #ifndef QCHK_QCHECK_HPP_INCLUDED
 #define QCHK_QCHECK_HPP_INCLUDED
 
+#include <chrono>
+#include <limits>
+#include <atomic>
+#include <vector>
+#include <iostream>
+#include <algorithm>
 #include <boost/type_traits/remove_const.hpp>
 #include <boost/type_traits/remove_reference.hpp>
 #include <boost/move/utility.hpp>
+#include <boost/optional.hpp>
+#include <boost/format.hpp>
 #include <boost/quick_check/quick_check_fwd.hpp>
+#include <boost/quick_check/config.hpp>
 #include <boost/quick_check/qcheck_results.hpp>
 #include <boost/quick_check/classify.hpp>
 #include <boost/fusion/functional/invocation/invoke_function_object.hpp>
 #include <boost/fusion/container/vector/convert.hpp>
 #include <boost/fusion/algorithm/transformation/transform.hpp>
+#include <boost/fusion/view/transform_view.hpp>
 #include <boost/fusion/sequence/intrinsic/value_at.hpp>
 #include <boost/fusion/sequence/intrinsic/size.hpp>
 #include <boost/preprocessor/repetition/enum_params.hpp>
 #include <boost/quick_check/detail/array.hpp>
 #include <boost/quick_check/detail/grammar.hpp>
+#include <boost/quick_check/detail/shrink.hpp>
+#include <boost/quick_check/detail/dedupe.hpp>
+#include <boost/quick_check/detail/evaluate.hpp>
+#include <boost/quick_check/detail/stats.hpp>
 #include <boost/quick_check/classify.hpp>
 #include <boost/quick_check/group_by.hpp>
 #include <boost/quick_check/condition.hpp>
@@ -93,36 +107,458 @@ namespace quick_check
         }
 #endif
 
+        template<typename Args, typename Group>
+        property_view<Args, Group> const &
+        get_property(property_view<Args, Group> const &prop)
+        {
+            return prop;
+        }
+
+        // Compile a whole property expression into one evaluator of its
+        // condition, classifiers, grouper and property.
+        struct GetEvaluator
+          : proto::when<
+                QuickCheckExpr
+              , make_fused_evaluator(
+                    GetProperty
+                  , GetCondition
+                  , GetClassifiers(proto::_, unclassified_args())
+                  , GetGrouper
+                )
+            >
+        {};
+
+        template<typename Expr>
+        typename boost::lazy_enable_if<
+            proto::is_expr<Expr>
+          , boost::result_of<detail::GetEvaluator(Expr const &)>
+        >::type
+        get_evaluator(Expr const &prop)
+        {
+            static_assert(
+                proto::matches<Expr, QuickCheckExpr>::value
+              , "The specified quick-check expression does not match the grammar for "
+                "valid quick-check expressions."
+            );
+            return detail::GetEvaluator()(prop);
+        }
+
+#if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) || defined(QCHK_DOXYGEN_INVOKED)
+        template<typename ...As>
+        typename property<As...>::evaluator_type const &
+        get_evaluator(property<As...> const &prop)
+        {
+            return prop.evaluator();
+        }
+#else
+        template<BOOST_PP_ENUM_PARAMS(QCHK_MAX_ARITY, typename A)>
+        typename property<BOOST_PP_ENUM_PARAMS(QCHK_MAX_ARITY, A)>::evaluator_type const &
+        get_evaluator(property<BOOST_PP_ENUM_PARAMS(QCHK_MAX_ARITY, A)> const &prop)
+        {
+            return prop.evaluator();
+        }
+#endif
+
+        template<typename Args, typename Group>
+        typename property_view<Args, Group>::evaluator_type
+        get_evaluator(property_view<Args, Group> const &prop)
+        {
+            return prop.evaluator();
+        }
+
         struct qcheck_access
         {
             template<typename QchkResults, typename Args, typename Group>
             static void add_failure(
                 QchkResults &results
               , Args const &args
-              , std::vector<std::string> const &classes
+              , class_mask classes
               , Group const &group
+              , std::size_t case_index
             )
             {
-                results.add_failure(args, classes, group);
+                results.add_failure(args, classes, group, case_index);
+            }
+
+            // Like add_failure, but with the arguments of the test case as
+            // they were generated. They are moved from rather than copied,
+            // and only if the failure is kept or streamed.
+            template<typename QchkResults, typename Args, typename Group>
+            static void take_failure(
+                QchkResults &results
+              , Args &args
+              , class_mask classes
+              , Group const &group
+              , std::size_t case_index
+            )
+            {
+                typedef fusion::transform_view<Args, detail::move_unpack_array> unpacked_type;
+                if(results.count_failure(classes, group, case_index))
+                    results.record_failure(
+                        fusion::as_vector(unpacked_type(args, detail::move_unpack_array()))
+                      , classes
+                      , group
+                      , case_index
+                    );
             }
 
             template<typename QchkResults, typename Group>
             static void add_success(
                 QchkResults &results
-              , std::vector<std::string> const &classes
+              , class_mask classes
               , Group const &group
             )
             {
                 results.add_success(classes, group);
             }
 
+            // Tell results the names of the classes of classify, by which
+            // the classes passed to add_success and add_failure are named.
+            template<typename QchkResults, typename Classify>
+            static void set_class_names(QchkResults &results, Classify const &classify)
+            {
+                std::vector<std::string> names;
+                classify.names(names);
+                results.set_class_names(names);
+            }
+
+            template<typename QchkResults>
+            static void set_failure_sink(QchkResults &results, failure_sink const &sink)
+            {
+                results.set_failure_sink(sink);
+            }
+
+            template<typename QchkResults>
+            static void set_size_schedule(QchkResults &results, size_schedule const &schedule)
+            {
+                results.set_size_schedule(schedule);
+            }
+
+            template<typename QchkResults>
+            static void add_successes(QchkResults &results, std::size_t count)
+            {
+                results.add_successes(count);
+            }
+
+            template<typename QchkResults>
+            static qcheck_stats &stats(QchkResults &results)
+            {
+                return results.stats_;
+            }
+
             template<typename QchkResults>
             static void set_exhausted(QchkResults &results)
             {
                 results.set_exhausted();
             }
+
+            template<typename QchkResults>
+            static void set_stopped_early(QchkResults &results)
+            {
+                results.set_stopped_early();
+            }
+
+            template<typename QchkResults>
+            static void add_duplicate(QchkResults &results)
+            {
+                results.add_duplicate();
+            }
+
+            template<typename QchkResults, typename Args, typename Group>
+            static void set_shrunk(
+                QchkResults &results
+              , Args const &args
+              , class_mask classes
+              , Group const &group
+              , std::size_t shrink_count
+            )
+            {
+                results.set_shrunk(args, classes, group, shrink_count);
+            }
+
+            // The distance between the indices of successive test cases
+            // generated by config.
+            template<typename Config>
+            static std::size_t case_stride(Config const &config)
+            {
+                return config.case_stride_;
+            }
+
+            // The map from placeholders to the generators of config.
+            template<typename Map, typename Rng, typename Stats>
+            static Map &generators(quick_check::config<Map, Rng, Stats> &config)
+            {
+                return config.map_;
+            }
+
+            // Make config's next test case the one with index next_case.
+            template<typename Config>
+            static void set_next_case(Config &config, std::size_t next_case)
+            {
+                config.next_case_ = next_case;
+            }
+
+            // Counts a failure against config.max_failures(), which the
+            // shards of a qcheck_parallel() run share. Returns false if the
+            // failures allowed have all been recorded already, in which case
+            // this one must not be.
+            template<typename Config, typename QchkResults>
+            static bool claim_failure(Config const &config, QchkResults const &results)
+            {
+                if(config.shared_failures_)
+                    return config.shared_failures_->fetch_add(1, std::memory_order_relaxed) <
+                        config.max_failures_;
+                return results.failure_count() < config.max_failures_;
+            }
+
+            // Whether config.max_failures() failures have been recorded, by
+            // all the shards of a qcheck_parallel() run together.
+            template<typename Config, typename QchkResults>
+            static bool failures_used_up(Config const &config, QchkResults const &results)
+            {
+                if(config.shared_failures_)
+                    return config.shared_failures_->load(std::memory_order_relaxed) >=
+                        config.max_failures_;
+                return results.failure_count() >= config.max_failures_;
+            }
+
+            // Make a copy of config that runs test_count of the tests. The
+            // shard generates every nbr_shards-th test case of config, starting
+            // at the shard_index-th one. If config is not seeded, the shard's
+            // random number generator is independently reseeded. Generators
+            // that don't use it are told which shard they are in. The shards
+            // count their failures in failures.
+            template<typename Config>
+            static Config make_shard(
+                Config &config
+              , std::size_t shard_index
+              , std::size_t nbr_shards
+              , std::size_t test_count
+              , std::size_t max_test_count
+              , std::atomic<std::size_t> &failures
+            )
+            {
+                Config shard(config);
+                shard.shared_failures_ = &failures;
+                shard.test_count_ = test_count;
+                shard.max_test_count_ = (std::max)(test_count, max_test_count);
+                shard.next_case_ = config.next_case_ + shard_index * config.case_stride_;
+                shard.case_stride_ = nbr_shards * config.case_stride_;
+                if(config.next_case_ >= config.enumerated())
+                    shard.enumerated_ = 0;
+                if(!config.seed_)
+                    shard.rng_.seed(config.rng_());
+                typedef proto::functional::second F;
+                fusion::for_each(
+                    detail::make_transform_view(qcheck_access::generators(shard), F())
+                  , detail::set_shard_fun(shard_index, nbr_shards)
+                );
+                return shard;
+            }
+
+            // Resume config after the last test case generated by any of the
+            // shards made from it.
+            template<typename Config>
+            static void join_shards(Config &config, std::vector<Config> const &shards)
+            {
+                std::size_t next_case = config.next_case_;
+                for(Config const &shard : shards)
+                {
+                    // Did this shard generate any test cases?
+                    if(shard.next_case_ >= config.next_case_ + shard.case_stride_)
+                        next_case = (std::max)(
+                            next_case
+                          , shard.next_case_ - shard.case_stride_ + config.case_stride_
+                        );
+                }
+                config.next_case_ = next_case;
+            }
+        };
+
+        // Look for a simpler input that also fails, and record it in results.
+        template<
+            typename QchkResults
+          , typename Property
+          , typename Condition
+          , typename Classify
+          , typename GroupBy
+          , typename Config
+        >
+        void shrink_first_failure(
+            QchkResults &results
+          , Property const &prop
+          , Condition const &condition
+          , Classify const &classify
+          , GroupBy const &groupby
+          , Config &config
+          , typename Config::result_type &args
+        )
+        {
+            if(config.max_shrinks() == 0)
+                return;
+            std::size_t const shrinks = detail::shrink_failure(prop, condition, config, args);
+            if(shrinks != 0)
+            {
+                detail::qcheck_access::set_shrunk(
+                    results
+                  , fusion::as_vector(fusion::transform(args, detail::unpack_array()))
+                  , classify.mask(args)
+                  , groupby(args)
+                  , shrinks
+                );
+            }
+        }
+
+        // Is it time to check the rate at which the condition accepts test
+        // cases? Only once enough of them have been generated, and then only
+        // when their number is a power of two.
+        inline bool should_monitor_rejections(std::size_t total)
+        {
+            return total >= 128u && (total & (total - 1)) == 0;
+        }
+
+        // Returns true if testing should stop because, at the rate at which
+        // the condition has accepted test cases so far, config.test_count()
+        // tests can't be run within config.max_test_count() generated ones.
+        // Warns about it instead, once, if config.rejection_monitor() says so.
+        template<typename Config>
+        bool rejections_exhaust(Config const &config, std::size_t n, std::size_t total,
+                                bool &warned)
+        {
+            if(total == 0 || n >= config.test_count())
+                return false;
+            double const expected =
+                n + double(config.max_test_count() - total) * double(n) / double(total);
+            if(expected >= double(config.test_count()))
+                return false;
+            if(config.rejection_monitor() == stop_on_rejections)
+                return true;
+            if(!warned && config.rejection_monitor() == warn_on_rejections)
+            {
+                warned = true;
+                std::cerr << (boost::format("Warning: the condition accepted %1% of %2% test "
+                                            "cases, so only about %3$.0f of %4% tests can be run "
+                                            "within %5% test cases.\n")
+                                % n
+                                % total
+                                % expected
+                                % config.test_count()
+                                % config.max_test_count());
+            }
+            return false;
+        }
+
+        // Says whether to go on generating test cases. Until config.test_count()
+        // tests have been run, it is while fewer than config.max_test_count()
+        // test cases have been generated. After that, it is while there is
+        // time left in config.time_budget(). The clock is read only every so
+        // many test cases, a number picked from the rate at which they have run
+        // so far, so that it is read about a hundred times per budget. If the
+        // config enumerates its domain, it is until every element of it has
+        // been generated instead.
+        struct test_budget
+        {
+            typedef std::chrono::steady_clock clock_type;
+
+            template<typename Config>
+            explicit test_budget(Config const &config)
+              : test_count_(config.test_count())
+              , max_test_count_(config.max_test_count())
+              , enumerated_(config.enumerated())
+              , stride_(qcheck_access::case_stride(config))
+              , budget_(config.time_budget())
+              , timed_(config.time_budget() > clock_type::duration::zero())
+              , expired_(!timed_)
+              , start_(timed_ ? clock_type::now() : clock_type::time_point())
+              , next_check_(0)
+            {
+                // A config whose domain was enumerated by an earlier run samples.
+                // (The shards of qcheck_parallel() are told by make_shard.)
+                if(this->stride_ == 1 && config.next_case() >= this->enumerated_)
+                    this->enumerated_ = 0;
+            }
+
+            // Whether the test cases are enumerated rather than sampled.
+            bool enumerating() const
+            {
+                return this->enumerated_ != 0;
+            }
+
+            // n tests have been run, out of total test cases generated, and
+            // the next test case has index next_case.
+            bool more(std::size_t n, std::size_t total, std::size_t next_case)
+            {
+                if(this->enumerating())
+                    return next_case < this->enumerated_;
+                if(n < this->test_count_)
+                    return total < this->max_test_count_;
+                return !this->expired_ && !this->expired(total);
+            }
+
+            // Whether testing ended before config.test_count() tests were run
+            // without having run every one there is to run.
+            bool exhausted(std::size_t n) const
+            {
+                return !this->enumerating() && n < this->test_count_;
+            }
+
+            // The number of tests still to run, if it is known.
+            std::size_t remaining(std::size_t n) const
+            {
+                return this->timed_ || this->enumerating()
+                    ? (std::numeric_limits<std::size_t>::max)()
+                    : this->test_count_ - n;
+            }
+
+            // The number of test cases that may still be generated.
+            std::size_t max_remaining(std::size_t n, std::size_t total, std::size_t next_case) const
+            {
+                if(this->enumerating())
+                    return (this->enumerated_ - next_case - 1) / this->stride_ + 1;
+                return n < this->test_count_ ? this->max_test_count_ - total
+                                             : (std::numeric_limits<std::size_t>::max)();
+            }
+
+        private:
+            bool expired(std::size_t total)
+            {
+                if(total < this->next_check_)
+                    return false;
+                clock_type::duration const elapsed = clock_type::now() - this->start_;
+                if(elapsed >= this->budget_)
+                    return this->expired_ = true;
+                double const per_case =
+                    double(elapsed.count()) / double((std::max)(total, std::size_t(1)));
+                double const interval =
+                    double((std::min)(this->budget_ / 100, (this->budget_ - elapsed) / 2).count());
+                double const cases = interval / (std::max)(per_case, 1.);
+                this->next_check_ = total + (cases < 1. ? 1 : static_cast<std::size_t>(
+                    (std::min)(cases, double(std::numeric_limits<std::size_t>::max() / 2))));
+                return false;
+            }
+
+            std::size_t test_count_;
+            std::size_t max_test_count_;
+            std::size_t enumerated_;
+            std::size_t stride_;
+            clock_type::duration budget_;
+            bool timed_;
+            bool expired_;
+            clock_type::time_point start_;
+            std::size_t next_check_;
         };
 
+        // Generate the next test case into args, reusing the storage of the
+        // last one, if there was one.
+        template<typename Config>
+        void generate_args(Config &config, boost::optional<typename Config::result_type> &args)
+        {
+            if(args)
+                config(args.get());
+            else
+                args = config();
+        }
+
         template<typename Property, typename Config>
         struct get_group_by_type
         {
@@ -151,7 +587,9 @@ namespace quick_check
     /// The algorithm executed by \c qcheck() is described below:
     ///
     /// \li If \c sized is specified, then \c qcheck() first calls
-    /// \c config.resized(sized).
+    /// \c config.resized(sized). If \c config has a size schedule, though,
+    /// each set of arguments is generated with the size it gives instead (see
+    /// \c quick_check::_size_schedule).
     ///
     /// \li Sets of arguments are generated one at a time by invoking the \c config
     /// nullary function, for a maximum of \c config.max_test_count() times (see 
@@ -161,7 +599,30 @@ namespace quick_check
     /// for example, \c property::condition()). If it evaluates to false, the
     /// arguments are discarded, and a new set is generated. Otherwise, the
     /// arguments are passed to the \c prop predicate. This happens no
-    /// more than \c config.test_count() times.
+    /// more than \c config.test_count() times, unless \c config has a time
+    /// budget.
+    ///
+    /// \li If \c config.time_budget() is not zero, once \c config.test_count()
+    /// tests have been run, more are run in the same way until that much
+    /// time has passed since \c qcheck() was called. The number of tests run
+    /// can be queried later with \c qcheck_results::test_count().
+    ///
+    /// \li If \c config.enumerated() is not zero, the sets of arguments are
+    /// instead the elements of the Cartesian product of the domains of the
+    /// generators, each generated once, after which \c qcheck() stops (see
+    /// \c quick_check::_exhaustive).
+    ///
+    /// \li If \c config.dedupe() is true, sets of arguments that were
+    /// tested before are skipped without being evaluated or counted as
+    /// tests. The number skipped can be queried later with
+    /// \c qcheck_results::duplicate_count().
+    ///
+    /// \li If \c config.partial_redraw() is true, and the condition uses only
+    /// some of the arguments, only those are redrawn after a rejection, with
+    /// \c config::redraw(). If \c config.rejection_monitor() is not
+    /// \c ignore_rejections, and the rate at which the condition accepts the
+    /// arguments is too low for \c config.test_count() tests to be run, a
+    /// warning is written to \c std::cerr, or testing stops.
     ///
     /// \li If the property returns true, a success is recorded in a object of
     /// type \c qcheck_results<>. Otherwise, a failure is recorded along with the
@@ -172,6 +633,22 @@ namespace quick_check
     /// \c property::classifier() and \c property::grouper()). Statistics about
     /// these classifications and grouping are also recorded in the results object.
     ///
+    /// \li If \c config.max_failures() failures have been recorded, \c qcheck()
+    /// stops, and notes that it stopped early. This state can be queried later
+    /// with \c qcheck_results::stopped_early().
+    ///
+    /// \li If any test failed, \c qcheck() tries to shrink the first failing
+    /// set of arguments to a simpler one that also fails, by repeatedly
+    /// evaluating the condition and the property on simpler candidates
+    /// proposed by the generators (see \c quick_check::shrink()). This is
+    /// bounded by \c config.max_shrinks() and \c config.max_shrink_time(). The
+    /// result can be queried later with \c qcheck_results::smallest_failure().
+    ///
+    /// \li If \c config was made with <tt>_stats = collect_stats()</tt>, the
+    /// time spent in each of these steps, and the number of test cases that
+    /// were generated and rejected, are recorded too. They can be queried later
+    /// with \c qcheck_results::stats().
+    ///
     /// \li Finally, after all tests have been run, \c qcheck() notes which limit
     /// was reached first, \c config.test_count() or \c config.max_test_count().
     /// If \c config.max_test_count() was reached first, it notes that the
@@ -194,12 +671,21 @@ namespace quick_check
             ++n; // ok, we've got a valid set of arguments
             // Unpack args from tuple and evaluate the property
             if(!prop(args...))
+            {
                 Add a failure to the results object
+                if(results.failure_count() == config.max_failures())
+                {
+                    Record in the results object that we stopped early
+                    break;
+                }
+            }
             else
                 Add a success to the results object
         }
-        if(n != config.test_count())
+        if(!stopped early && n != config.test_count())
             Record in the results object that we exhausted input
+        if(!results.success())
+            Shrink the first failure and record it in the results object
         return results;
         \endcode
     */
@@ -283,45 +769,157 @@ namespace quick_check
         auto const &classify = detail::get_classifier(prop);
         auto const &groupby = detail::get_grouper(prop);
         auto const &condition = detail::get_condition(prop);
+        auto const &evaluate = detail::get_evaluator(prop);
+        detail::qcheck_access::set_class_names(results, classify);
+        detail::qcheck_access::set_failure_sink(results, config.failure_sink());
+        detail::qcheck_access::set_size_schedule(results, config.size_schedule());
+
+        detail::stats_recorder<typename Config::stats_policy> recorder(
+            detail::qcheck_access::stats(results)
+          , fusion::result_of::size<typename Config::result_type>::value
+        );
+
+        // After a rejection, redraw only the arguments the condition uses?
+        typedef typename std::decay<decltype(condition)>::type condition_type;
+        std::size_t const all_args =
+            (std::size_t(1) << fusion::result_of::size<typename Config::result_type>::value) - 1;
+        std::size_t const redraw_mask = detail::condition_mask<condition_type>::value & all_args;
+        detail::test_budget budget(config);
+        bool const partial_redraw = config.partial_redraw() && !config.seeded() &&
+                                    redraw_mask != all_args && !budget.enumerating();
+        bool const monitored =
+            config.rejection_monitor() != ignore_rejections && !budget.enumerating();
+        bool rejected = false, warned = false;
+
+        // The argument sets tested so far, if duplicates are skipped
+        detail::seen_filter<typename Config::result_type> seen(
+            config.dedupe() && !budget.enumerating()
+          , config.test_count()
+        );
+
+        // What became of each test case
+        detail::case_outcome<
+            typename detail::get_group_by_type<Property, Config>::type
+        > outcome;
+
+        // A copy of the first failing set of arguments, for shrinking.
+        boost::optional<typename Config::result_type> first_failure;
+        bool stopped_early = false;
+
+        // The current set of arguments
+        boost::optional<typename Config::result_type> current;
 
         std::size_t n = 0, total = 0;
-        for(; n < config.test_count() && total < config.max_test_count(); ++total)
+        for(; budget.more(n, total, config.next_case()); ++total)
         {
-            auto args = config();
+            if(monitored && detail::should_monitor_rejections(total) &&
+               detail::rejections_exhaust(config, n, total, warned))
+                break;
 
-            // Skip this if it is an invalid set of arguments
-            if(!static_cast<bool>(condition(args)))
+            // Stop if other shards of qcheck_parallel() found enough failures.
+            if(detail::qcheck_access::failures_used_up(config, results))
+            {
+                detail::qcheck_access::set_stopped_early(results);
+                stopped_early = true;
+                break;
+            }
+
+            std::size_t const case_index = config.next_case();
+            recorder.start();
+            if(rejected && partial_redraw)
+            {
+                config.redraw(current.get(), redraw_mask);
+                recorder.lap(qcheck_stats::generation);
+                recorder.drew(1, redraw_mask);
+            }
+            else
+            {
+                detail::generate_args(config, current);
+                recorder.lap(qcheck_stats::generation);
+                recorder.drew(1);
+            }
+            auto &args = current.get();
+
+            // Skip this if the same arguments have been tested already
+            if(seen.contains(args))
+            {
+                detail::qcheck_access::add_duplicate(results);
+                rejected = false;
                 continue;
+            }
 
-            ++n; // ok, we've got a valid set of arguments
-            auto classes = classify(args);
-            auto group = groupby(args);
+            // Evaluate everything at once, skipping this if it is an
+            // invalid set of arguments
+            rejected =
+                !recorder.evaluate(evaluate, prop_, condition, classify, groupby, args, outcome);
+            if(rejected)
+                continue;
+
+            // Only tested arguments are remembered, so that the filter
+            // doesn't fill up with the ones the condition rejects.
+            seen.insert(args);
 
-            // The static_cast here is mostly historical, but left here for
-            // the sake of strictness.
-            if(!static_cast<bool>(fusion::invoke_function_object(prop_, args)))
+            ++n; // ok, we've got a valid set of arguments
+            if(!outcome.passed)
             {
-                detail::qcheck_access::add_failure(
+                // Another shard may have recorded the last failure allowed.
+                if(!detail::qcheck_access::claim_failure(config, results))
+                {
+                    detail::qcheck_access::set_stopped_early(results);
+                    stopped_early = true;
+                    break;
+                }
+
+                if(!first_failure)
+                    first_failure = args;
+
+                // args is overwritten by the next test case, so it can be moved from.
+                detail::qcheck_access::take_failure(
                     results
-                  , fusion::as_vector(fusion::transform(args, detail::unpack_array()))
-                  , std::move(classes)
-                  , std::move(group)
+                  , args
+                  , outcome.classes
+                  , outcome.group.get()
+                  , case_index
                 );
+
+                // Bail once we have seen enough failures.
+                if(detail::qcheck_access::failures_used_up(config, results))
+                {
+                    detail::qcheck_access::set_stopped_early(results);
+                    stopped_early = true;
+                    break;
+                }
             }
             else
             {
                 detail::qcheck_access::add_success(
                     results
-                  , std::move(classes)
-                  , std::move(group)
+                  , outcome.classes
+                  , outcome.group.get()
                 );
             }
         }
 
         // Record whether we had to bail early.
-        if(n != config.test_count())
+        if(!stopped_early && budget.exhausted(n))
             detail::qcheck_access::set_exhausted(results);
 
+        // Look for a simpler input that also fails.
+        if(first_failure)
+        {
+            recorder.start();
+            detail::shrink_first_failure(
+                results
+              , prop_
+              , condition
+              , classify
+              , groupby
+              , config
+              , first_failure.get()
+            );
+            recorder.lap(qcheck_stats::shrinking);
+        }
+
         return boost::move(results);
     }
 }
@@ -0,0 +1,338 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file qcheck_batched.hpp
+/// \brief Definition of the \c quick_check::qcheck_batched() algorithm
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QCHK_QCHECK_BATCHED_HPP_INCLUDED
+#define QCHK_QCHECK_BATCHED_HPP_INCLUDED
+
+#include <string>
+#include <memory>
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/and.hpp>
+#include <boost/move/utility.hpp>
+#include <boost/optional.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/fusion/view/transform_view.hpp>
+#include <boost/fusion/container/vector/convert.hpp>
+#include <boost/fusion/algorithm/transformation/transform.hpp>
+#include <boost/fusion/functional/invocation/invoke_function_object.hpp>
+#include <boost/quick_check/quick_check_fwd.hpp>
+#include <boost/quick_check/qcheck.hpp>
+#include <boost/quick_check/detail/block.hpp>
+
+QCHK_BOOST_NAMESPACE_BEGIN
+
+namespace quick_check
+{
+    namespace detail
+    {
+        // Record the passing test cases in lanes [first, last) of a block.
+        // If no classification is needed, they are simply counted, without
+        // looking at their arguments.
+        template<typename Args, typename QchkResults, typename Classify, typename GroupBy,
+                 typename Columns>
+        void add_lane_successes(QchkResults &results, Classify const &, GroupBy const &,
+                                Columns const &, std::size_t const *, std::size_t first,
+                                std::size_t last, mpl::true_)
+        {
+            detail::qcheck_access::add_successes(results, last - first);
+        }
+
+        template<typename Args, typename QchkResults, typename Classify, typename GroupBy,
+                 typename Columns>
+        void add_lane_successes(QchkResults &results, Classify const &classify,
+                                GroupBy const &groupby, Columns const &columns,
+                                std::size_t const *lanes, std::size_t first, std::size_t last,
+                                mpl::false_)
+        {
+            for(; first != last; ++first)
+            {
+                std::size_t const lane = lanes ? lanes[first] : first;
+                Args args(fusion::transform_view<Columns const, lane_at>(columns, lane_at(lane)));
+                detail::qcheck_access::add_success(results, classify.mask(args), groupby(args));
+            }
+        }
+    }
+
+    /// \brief Like \c qcheck(), but generates and evaluates the test cases in
+    ///        blocks.
+    ///
+    /// \c qcheck_batched() asks \c config to fill a block of \c block_size
+    /// test cases at a time with \c config::generate(). The block is laid out
+    /// as one contiguous column of values per argument, rather than as one
+    /// Fusion sequence per test case. The property's condition, then the
+    /// property itself, are evaluated over the whole block in tight loops,
+    /// which the compiler can vectorize for simple arithmetic properties such as
+    /// <tt>(_1 + _2) == (_2 + _1)</tt>. Only the arguments of failing test
+    /// cases, and of those that need to be classified or grouped, are copied
+    /// out of the block.
+    ///
+    /// The results are the same as those of \c qcheck() given the same test
+    /// cases, including the limits set by \c config.max_test_count() and
+    /// \c config.max_failures(), and the shrinking of the first failure. If
+    /// \c config was created with \c _seed, the test cases are the same as
+    /// those run by \c qcheck(). Otherwise, \c config::generate() draws the
+    /// values from the random number generator in a different order.
+    ///
+    /// The condition is evaluated on every test case of a block, even if the
+    /// block holds more valid test cases than are needed, and the property is
+    /// evaluated on every valid test case of a block before any results are
+    /// recorded. The test cases that were generated but not needed are not
+    /// counted, and <tt>config.next_case()</tt> is left just past the last
+    /// test case that was.
+    ///
+    /// \c config.rejection_monitor() is consulted after each block. The
+    /// arguments of the test cases of a block are always drawn in full,
+    /// whatever \c config.partial_redraw() says, and duplicates are tested
+    /// again, whatever \c config.dedupe() says.
+    ///
+    /// If \c config was made with <tt>_stats = collect_stats()</tt>, each
+    /// phase of a block is timed as a whole. Every test case of a block counts
+    /// as generated, and every one that fails the condition as rejected. The
+    /// classifiers and the grouper are evaluated together while the results are
+    /// recorded, and that time is charged to classification.
+    ///
+    /// \em Example:
+    ///
+    /*! \code
+        uniform<int> di(-1000, 1000);
+        auto config = make_config(_1 = di, _2 = di, _test_count = 1000000u);
+
+        // Evaluate a million tests in blocks of 1024
+        auto res = qcheck_batched((_1 + _2) == (_2 + _1), config, 1024);
+        res.print_summary();
+        \endcode
+    */
+    ///
+    /// \param prop The property to test.
+    /// \param config An instance of \c config<>.
+    /// \param block_size The number of test cases to generate and evaluate
+    ///                   at a time. If 0, 1 is used.
+    ///
+    /// \pre The requirements of \c qcheck() hold.
+    /// \pre The property and its condition have no side effects that depend
+    ///      on the order in which the test cases are evaluated.
+    ///
+    /// \return An instance of \c qcheck_results<> that holds the results
+    ///         of this \c qcheck_batched() invocation.
+    ///
+    /// \sa \c qcheck(), \c config::generate()
+    template<typename Property, typename Config>
+    typename detail::make_qcheck_results_type<
+        typename Config::result_type
+      , typename detail::get_group_by_type<Property, Config>::type
+    >::type
+    qcheck_batched(Property const &prop, Config &config, std::size_t block_size)
+    {
+        typedef
+            typename detail::make_qcheck_results_type<
+                typename Config::result_type
+              , typename detail::get_group_by_type<Property, Config>::type
+            >::type
+        results_type;
+
+        typedef typename Config::result_type args_type;
+        typedef typename Config::columns_type columns_type;
+
+        results_type results;
+
+        auto const &prop_ = detail::get_property(prop);
+        auto const &classify = detail::get_classifier(prop);
+        auto const &groupby = detail::get_grouper(prop);
+        auto const &condition = detail::get_condition(prop);
+        detail::qcheck_access::set_class_names(results, classify);
+        detail::qcheck_access::set_failure_sink(results, config.failure_sink());
+        detail::qcheck_access::set_size_schedule(results, config.size_schedule());
+
+        typedef typename std::decay<decltype(prop_)>::type property_type;
+        typedef typename std::decay<decltype(classify)>::type classify_type;
+        typedef typename std::decay<decltype(groupby)>::type groupby_type;
+        typedef typename std::decay<decltype(condition)>::type condition_type;
+
+        // Can passing test cases be counted without looking at their arguments?
+        typedef
+            typename mpl::and_<
+                boost::is_same<classify_type, detail::unclassified_args>
+              , boost::is_same<groupby_type, detail::ungrouped_args>
+            >::type
+        unclassified;
+
+        bool const conditional = !boost::is_same<condition_type, detail::unconditional>::value;
+        std::size_t const stride = detail::qcheck_access::case_stride(config);
+        block_size = (std::max)(block_size, std::size_t(1));
+
+        columns_type columns;
+        std::unique_ptr<bool[]> valid(new bool[block_size]), passed(new bool[block_size]);
+        std::vector<std::size_t> lanes(block_size);
+        detail::invoke_property<property_type> const property_fun(prop_);
+
+        detail::stats_recorder<typename Config::stats_policy> recorder(
+            detail::qcheck_access::stats(results)
+          , fusion::result_of::size<args_type>::value
+        );
+
+        // A copy of the first failing set of arguments, for shrinking.
+        boost::optional<args_type> first_failure;
+        bool stopped_early = false;
+
+        detail::test_budget budget(config);
+        bool const monitored =
+            config.rejection_monitor() != ignore_rejections && !budget.enumerating();
+        bool warned = false;
+
+        std::size_t n = 0, total = 0;
+        while(!stopped_early && budget.more(n, total, config.next_case()))
+        {
+            if(monitored && total >= 128u && detail::rejections_exhaust(config, n, total, warned))
+                break;
+
+            std::size_t count =
+                (std::min)(block_size, budget.max_remaining(n, total, config.next_case()));
+            if(!conditional)
+                count = (std::min)(count, budget.remaining(n));
+
+            std::size_t const first_case = config.next_case();
+            recorder.start();
+            config.generate(columns, count);
+            auto const data = fusion::as_vector(fusion::transform(columns, detail::column_data()));
+            recorder.lap(qcheck_stats::generation);
+            recorder.drew(count);
+
+            // Pick out the valid lanes, up to the number of tests still to run.
+            // If they all are, lanes is left alone and lane i is test case i.
+            std::size_t nbr_lanes = count, used = count;
+            if(conditional)
+            {
+                detail::eval_block(condition, data, count, valid.get());
+                recorder.rejected(valid.get(), count);
+                nbr_lanes = 0;
+                for(std::size_t i = 0; i < count; ++i)
+                {
+                    if(valid[i])
+                    {
+                        lanes[nbr_lanes++] = i;
+                        if(nbr_lanes == budget.remaining(n))
+                        {
+                            used = i + 1;
+                            break;
+                        }
+                    }
+                }
+            }
+            std::size_t const *const lane_map = nbr_lanes == count ? 0 : lanes.data();
+            recorder.lap(qcheck_stats::condition);
+
+            // Evaluate the property on them.
+            if(lane_map)
+                detail::eval_block(property_fun, data, lane_map, nbr_lanes, passed.get());
+            else
+                detail::eval_block(property_fun, data, count, passed.get());
+            recorder.lap(qcheck_stats::property);
+
+            // Record the results, materializing the arguments of the failures.
+            for(std::size_t i = 0; i < nbr_lanes; ++i)
+            {
+                std::size_t const first = i;
+                while(i < nbr_lanes && passed[i])
+                    ++i;
+                detail::add_lane_successes<args_type>(
+                    results
+                  , classify
+                  , groupby
+                  , data
+                  , lane_map
+                  , first
+                  , i
+                  , unclassified()
+                );
+                n += i - first;
+                if(i == nbr_lanes)
+                    break;
+
+                std::size_t const lane = lane_map ? lane_map[i] : i;
+                ++n;
+                args_type args(
+                    fusion::transform_view<decltype(data) const, detail::lane_at>(
+                        data
+                      , detail::lane_at(lane)
+                    )
+                );
+                if(!first_failure)
+                    first_failure = args;
+
+                detail::qcheck_access::take_failure(
+                    results
+                  , args
+                  , classify.mask(args)
+                  , groupby(args)
+                  , first_case + lane * stride
+                );
+
+                // Bail once we have seen enough failures.
+                if(results.failure_count() >= config.max_failures())
+                {
+                    detail::qcheck_access::set_stopped_early(results);
+                    stopped_early = true;
+                    used = lane + 1;
+                    break;
+                }
+            }
+
+            recorder.lap(qcheck_stats::classification);
+
+            total += used;
+            // Forget about the test cases we generated but did not need.
+            detail::qcheck_access::set_next_case(config, first_case + used * stride);
+        }
+
+        // Record whether we had to bail early.
+        if(!stopped_early && budget.exhausted(n))
+            detail::qcheck_access::set_exhausted(results);
+
+        // Look for a simpler input that also fails.
+        if(first_failure)
+        {
+            recorder.start();
+            detail::shrink_first_failure(
+                results
+              , prop_
+              , condition
+              , classify
+              , groupby
+              , config
+              , first_failure.get()
+            );
+            recorder.lap(qcheck_stats::shrinking);
+        }
+
+        return boost::move(results);
+    }
+
+    /// \overload
+    ///
+    template<typename Property, typename Config>
+    typename detail::make_qcheck_results_type<
+        typename Config::result_type
+      , typename detail::get_group_by_type<Property, Config>::type
+    >::type
+    qcheck_batched(Property const &prop, Config &config)
+    {
+        return boost::move(quick_check::qcheck_batched(prop, config, 1024));
+    }
+}
+
+QCHK_BOOST_NAMESPACE_END
+
+#endif
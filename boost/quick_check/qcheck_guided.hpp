@@ -0,0 +1,245 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file qcheck_guided.hpp
+/// \brief Definition of the \c quick_check::qcheck_guided() algorithm
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QCHK_QCHECK_GUIDED_HPP_INCLUDED
+#define QCHK_QCHECK_GUIDED_HPP_INCLUDED
+
+#include <vector>
+#include <boost/cstdint.hpp>
+#include <boost/move/utility.hpp>
+#include <boost/optional.hpp>
+#include <boost/fusion/sequence/intrinsic/size.hpp>
+#include <boost/quick_check/quick_check_fwd.hpp>
+#include <boost/quick_check/qcheck.hpp>
+#include <boost/quick_check/coverage.hpp>
+#include <boost/quick_check/detail/random.hpp>
+
+QCHK_BOOST_NAMESPACE_BEGIN
+
+namespace quick_check
+{
+    /// \brief Like \c qcheck(), but steers the generation of the test cases
+    ///        towards the code they haven't reached yet.
+    ///
+    /// \c qcheck_guided() turns a property into an in-process fuzz target.
+    /// Before evaluating each test case, it clears the counters of
+    /// \c coverage, and afterwards it looks for edges that no earlier test
+    /// case reached, or reached about as many times. Test cases that satisfy
+    /// the condition and find such an edge are kept in a pool. From then on,
+    /// three test cases in four are made by taking one from the pool and
+    /// mutating one or two of its arguments with \c config::mutate(), which
+    /// asks their generators for variations of their values; the fourth is
+    /// generated afresh. Test cases that need a particular combination of
+    /// values to reach a branch are found much sooner than by \c qcheck(),
+    /// since each step towards it is kept.
+    ///
+    /// Otherwise, \c qcheck_guided() does what \c qcheck() does: it counts,
+    /// classifies and groups the test cases, skips duplicates if
+    /// \c config.dedupe() is true, stops after <tt>config.max_failures()</tt>
+    /// failures, and shrinks the first one.
+    /// Mutated test cases are recorded with the index of the test case they
+    /// were made for, but can't be regenerated from it with
+    /// \c config::operator()(std::size_t).
+    ///
+    /// \em Example:
+    ///
+    /*! \code
+        // Compiled with -fsanitize-coverage=trace-pc-guard, and the
+        // callbacks defined with QCHK_DEFINE_SANITIZER_COVERAGE.
+        auto config = make_config(_1 = uniform<int>(-1000, 1000),
+                                  _2 = uniform<int>(-1000, 1000),
+                                  _test_count = 100000u);
+        auto res = qcheck_guided(bind(&accrue, _1, _2) >= 0, config);
+        res.print_summary();
+        \endcode
+    */
+    ///
+    /// \param prop The property to test.
+    /// \param config An instance of \c config<>.
+    /// \param coverage The source of the coverage of each test case: an
+    ///                 object with a \c clear() member function, and
+    ///                 \c size() and \c counters() member functions that
+    ///                 return the number of edges and a pointer to their hit
+    ///                 counts. Defaults to a \c sanitizer_coverage object.
+    ///
+    /// \pre The requirements of \c qcheck() hold.
+    ///
+    /// \return An instance of \c qcheck_results<> that holds the results.
+    ///
+    /// \sa \c qcheck(), \c quick_check::sanitizer_coverage, \c quick_check::mutate
+    template<typename Property, typename Config, typename Coverage>
+    typename detail::make_qcheck_results_type<
+        typename Config::result_type
+      , typename detail::get_group_by_type<Property, Config>::type
+    >::type
+    qcheck_guided(Property const &prop, Config &config, Coverage &coverage)
+    {
+        typedef
+            typename detail::make_qcheck_results_type<
+                typename Config::result_type
+              , typename detail::get_group_by_type<Property, Config>::type
+            >::type
+        results_type;
+
+        results_type results;
+
+        auto const &prop_ = detail::get_property(prop);
+        auto const &classify = detail::get_classifier(prop);
+        auto const &groupby = detail::get_grouper(prop);
+        auto const &condition = detail::get_condition(prop);
+        auto const &evaluate = detail::get_evaluator(prop);
+        detail::qcheck_access::set_class_names(results, classify);
+        detail::qcheck_access::set_failure_sink(results, config.failure_sink());
+        detail::qcheck_access::set_size_schedule(results, config.size_schedule());
+
+        std::size_t const arity = fusion::result_of::size<typename Config::result_type>::value;
+        detail::stats_recorder<typename Config::stats_policy> recorder(
+            detail::qcheck_access::stats(results)
+          , arity
+        );
+
+        // What became of each test case
+        detail::case_outcome<
+            typename detail::get_group_by_type<Property, Config>::type
+        > outcome;
+
+        // A copy of the first failing set of arguments, for shrinking.
+        boost::optional<typename Config::result_type> first_failure;
+        bool stopped_early = false;
+
+        // The test cases that reached new edges, and the edges reached so far
+        std::vector<typename Config::result_type> pool;
+        detail::coverage_tracker tracker;
+
+        // The current set of arguments
+        boost::optional<typename Config::result_type> current;
+
+        detail::test_budget budget(config);
+        detail::seen_filter<typename Config::result_type> seen(
+            config.dedupe() && !budget.enumerating()
+          , config.test_count()
+        );
+        std::size_t n = 0, total = 0;
+        for(; budget.more(n, total, config.next_case()); ++total)
+        {
+            std::size_t const case_index = config.next_case();
+
+            // Which test case to mutate, and which of its arguments, are a
+            // pure function of the index of the test case.
+            boost::uint64_t const choice = detail::mix64(case_index + 0x9E3779B97F4A7C15ull);
+            recorder.start();
+            if(pool.empty() || (choice & 3u) == 0 || budget.enumerating())
+            {
+                detail::generate_args(config, current);
+                recorder.lap(qcheck_stats::generation);
+                recorder.drew(1);
+            }
+            else
+            {
+                current = pool[(choice >> 2) % pool.size()];
+                std::size_t mask = std::size_t(1) << ((choice >> 32) % arity);
+                if((choice >> 40 & 3u) == 0)
+                    mask |= std::size_t(1) << ((choice >> 48) % arity);
+                config.mutate(current.get(), mask);
+                recorder.lap(qcheck_stats::generation);
+                recorder.drew(1, mask);
+            }
+            auto &args = current.get();
+            if(seen.contains(args))
+            {
+                detail::qcheck_access::add_duplicate(results);
+                continue;
+            }
+
+            coverage.clear();
+            bool const accepted =
+                recorder.evaluate(evaluate, prop_, condition, classify, groupby, args, outcome);
+            bool const reached_new = tracker.merge(coverage);
+            if(!accepted)
+                continue;
+            seen.insert(args);
+            if(reached_new)
+                pool.push_back(args);
+
+            ++n; // ok, we've got a valid set of arguments
+            if(!outcome.passed)
+            {
+                if(!first_failure)
+                    first_failure = args;
+
+                detail::qcheck_access::take_failure(
+                    results
+                  , args
+                  , outcome.classes
+                  , outcome.group.get()
+                  , case_index
+                );
+
+                // Bail once we have seen enough failures.
+                if(results.failure_count() >= config.max_failures())
+                {
+                    detail::qcheck_access::set_stopped_early(results);
+                    stopped_early = true;
+                    break;
+                }
+            }
+            else
+            {
+                detail::qcheck_access::add_success(
+                    results
+                  , outcome.classes
+                  , outcome.group.get()
+                );
+            }
+        }
+
+        // Record whether we had to bail early.
+        if(!stopped_early && budget.exhausted(n))
+            detail::qcheck_access::set_exhausted(results);
+
+        // Look for a simpler input that also fails.
+        if(first_failure)
+        {
+            recorder.start();
+            detail::shrink_first_failure(
+                results
+              , prop_
+              , condition
+              , classify
+              , groupby
+              , config
+              , first_failure.get()
+            );
+            recorder.lap(qcheck_stats::shrinking);
+        }
+
+        return boost::move(results);
+    }
+
+    /// \overload
+    ///
+    template<typename Property, typename Config>
+    typename detail::make_qcheck_results_type<
+        typename Config::result_type
+      , typename detail::get_group_by_type<Property, Config>::type
+    >::type
+    qcheck_guided(Property const &prop, Config &config)
+    {
+        sanitizer_coverage coverage;
+        return boost::move(quick_check::qcheck_guided(prop, config, coverage));
+    }
+}
+
+QCHK_BOOST_NAMESPACE_END
+
+#endif
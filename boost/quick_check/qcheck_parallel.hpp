@@ -0,0 +1,177 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file qcheck_parallel.hpp
+/// \brief Definition of the \c quick_check::qcheck_parallel() algorithm
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QCHK_QCHECK_PARALLEL_HPP_INCLUDED
+#define QCHK_QCHECK_PARALLEL_HPP_INCLUDED
+
+#include <atomic>
+#include <vector>
+#include <thread>
+#include <exception>
+#include <algorithm>
+#include <boost/move/utility.hpp>
+#include <boost/quick_check/quick_check_fwd.hpp>
+#include <boost/quick_check/qcheck.hpp>
+
+QCHK_BOOST_NAMESPACE_BEGIN
+
+namespace quick_check
+{
+    /// \brief Like \c qcheck(), but splits the tests across several threads.
+    ///
+    /// \c qcheck_parallel() divides the <tt>config.test_count()</tt> and
+    /// <tt>config.max_test_count()</tt> budgets into one shard per thread. Each
+    /// shard runs the \c qcheck() algorithm on its own copy of \c config, and
+    /// with \em N threads, shard \em i generates test cases \em i, \em i+N,
+    /// \em i+2N, and so on. The per-shard results are then merged in shard
+    /// order, so the returned object reports the same number of tests, the same
+    /// category counts and the same kind of failures as a call to \c qcheck()
+    /// with the same total budget.
+    ///
+    /// If \c config was created with \c _seed, every test case is a pure
+    /// function of the seed and its index, so for properties without a
+    /// condition, exactly the same test cases are run as by \c qcheck(),
+    /// whatever the number of threads. Otherwise, each shard's random number
+    /// generator is reseeded with a value drawn from \c config's generator.
+    ///
+    /// The shards share <tt>config.max_failures()</tt>: once that many
+    /// failures have been recorded by any of them, they all stop. Which
+    /// failures those are depends on how the threads are scheduled.
+    ///
+    /// \em Example:
+    ///
+    /*! \code
+        uniform<int> di(1,6);
+        auto config = make_config(_1 = di, _test_count = 1000000u);
+
+        // Run a million tests on 8 threads
+        auto res = qcheck_parallel(_1 >= 1 && _1 <= 6, config, 8);
+        res.print_summary();
+        \endcode
+    */
+    ///
+    /// \param prop The property to test.
+    /// \param config An instance of \c config<>.
+    /// \param threads The number of threads to use. If 0, use
+    ///                <tt>std::thread::hardware_concurrency()</tt>.
+    ///
+    /// \pre The requirements of \c qcheck() hold.
+    /// \pre \c config's random number generator has a \c seed() member function,
+    ///      or \c config was created with \c _seed.
+    /// \pre \c prop can safely be evaluated concurrently, and copies of the
+    ///      generators in \c config do not share state.
+    ///
+    /// \return An instance of \c qcheck_results<> holding the merged results of
+    ///         all the shards.
+    ///
+    /// \throw Any exception thrown while running a shard is rethrown after all
+    ///        threads have been joined.
+    ///
+    /// \sa \c qcheck()
+    template<typename Property, typename Config>
+    typename detail::make_qcheck_results_type<
+        typename Config::result_type
+      , typename detail::get_group_by_type<Property, Config>::type
+    >::type
+    qcheck_parallel(Property const &prop, Config &config, std::size_t threads)
+    {
+        typedef
+            typename detail::make_qcheck_results_type<
+                typename Config::result_type
+              , typename detail::get_group_by_type<Property, Config>::type
+            >::type
+        results_type;
+
+        if(threads == 0)
+            threads = (std::max)(std::thread::hardware_concurrency(), 1u);
+        // Don't bother spinning up threads that have nothing to do.
+        threads = (std::max)((std::min)(threads, config.test_count()), std::size_t(1));
+
+        std::size_t const test_count = config.test_count() / threads;
+        std::size_t const test_count_rem = config.test_count() % threads;
+        std::size_t const max_test_count = config.max_test_count() / threads;
+        std::size_t const max_test_count_rem = config.max_test_count() % threads;
+
+        // Carve up the budget and seed the shards on this thread so that the
+        // run is reproducible for a given number of threads.
+        std::atomic<std::size_t> failures(0);
+        std::vector<Config> shards;
+        shards.reserve(threads);
+        for(std::size_t i = 0; i < threads; ++i)
+        {
+            shards.push_back(
+                detail::qcheck_access::make_shard(
+                    config
+                  , i
+                  , threads
+                  , test_count + (i < test_count_rem ? 1 : 0)
+                  , max_test_count + (i < max_test_count_rem ? 1 : 0)
+                  , failures
+                )
+            );
+        }
+
+        std::vector<results_type> results(threads);
+        std::vector<std::exception_ptr> errors(threads);
+        std::vector<std::thread> workers;
+        workers.reserve(threads - 1);
+
+        auto run_shard = [&](std::size_t i)
+        {
+            try
+            {
+                results[i] = quick_check::qcheck(prop, shards[i]);
+            }
+            catch(...)
+            {
+                errors[i] = std::current_exception();
+            }
+        };
+
+        // The calling thread runs the first shard itself.
+        for(std::size_t i = 1; i < threads; ++i)
+            workers.push_back(std::thread(run_shard, i));
+        run_shard(0);
+        for(std::thread &worker : workers)
+            worker.join();
+
+        detail::qcheck_access::join_shards(config, shards);
+
+        for(std::exception_ptr const &error : errors)
+        {
+            if(error)
+                std::rethrow_exception(error);
+        }
+
+        for(std::size_t i = 1; i < threads; ++i)
+            results[0].merge(boost::move(results[i]));
+
+        return boost::move(results[0]);
+    }
+
+    /// \overload
+    ///
+    template<typename Property, typename Config>
+    typename detail::make_qcheck_results_type<
+        typename Config::result_type
+      , typename detail::get_group_by_type<Property, Config>::type
+    >::type
+    qcheck_parallel(Property const &prop, Config &config)
+    {
+        return boost::move(quick_check::qcheck_parallel(prop, config, 0));
+    }
+}
+
+QCHK_BOOST_NAMESPACE_END
+
+#endif
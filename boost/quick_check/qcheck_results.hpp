@@ -22,23 +22,41 @@
 #include <sstream>
 #include <ostream>
 #include <algorithm>
+#include <stdexcept>
 #include <boost/assert.hpp>
 #include <boost/format.hpp>
+#include <boost/optional.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/type_traits/remove_reference.hpp>
 #include <boost/range/algorithm/for_each.hpp>
 #include <boost/move/utility.hpp>
+#include <boost/move/iterator.hpp>
 #include <boost/mpl/print.hpp>
 #include <boost/mpl/eval_if.hpp>
 #include <boost/mpl/identity.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/back.hpp>
+#include <boost/mpl/vector.hpp>
+#include <boost/mpl/remove_if.hpp>
+#include <boost/mpl/placeholders.hpp>
 #include <boost/fusion/algorithm/iteration/for_each.hpp>
 #include <boost/fusion/container/generation/make_vector.hpp>
 #include <boost/fusion/sequence/intrinsic/back.hpp>
 #include <boost/fusion/algorithm/transformation/join.hpp>
 #include <boost/fusion/view/single_view.hpp>
 #include <boost/fusion/functional/adapter/fused.hpp>
+#include <boost/fusion/adapted/mpl.hpp>
+#include <boost/fusion/mpl.hpp>
+#include <boost/mpl/find_if.hpp>
+#include <boost/mpl/not.hpp>
+#include <boost/mpl/and.hpp>
+#include <boost/mpl/or.hpp>
 #include <boost/quick_check/quick_check_fwd.hpp>
 #include <boost/quick_check/detail/array.hpp>
+#include <boost/quick_check/classify.hpp>
+#include <boost/quick_check/qcheck_stats.hpp>
+#include <boost/quick_check/failure_sink.hpp>
+#include <boost/quick_check/size_schedule.hpp>
 #include <boost/preprocessor/repetition/enum_binary_params.hpp>
 #include <boost/preprocessor/facilities/intercept.hpp>
 #include <boost/preprocessor/repetition/enum.hpp>
@@ -79,6 +97,55 @@ namespace quick_check
             typedef detail::array<T[N]> type;
         };
 
+        // Can a T be written to a std::ostream by detail::disp?
+        template<typename T>
+        struct is_printable
+        {
+        private:
+            template<typename U>
+            static auto check(int)
+                -> decltype(std::declval<std::ostream &>() << std::declval<U const &>(), mpl::true_());
+
+            template<typename U>
+            static mpl::false_ check(...);
+
+        public:
+            typedef decltype(is_printable::check<T>(0)) type;
+            static bool const value = type::value;
+        };
+
+        template<typename T, std::size_t N>
+        struct is_printable<boost::array<T, N> >
+          : is_printable<T>
+        {};
+
+        // Can a qcheck_args<> with these arguments and this group be written
+        // to a std::ostream?
+        template<typename Args, typename Group>
+        struct are_printable
+          : mpl::and_<
+                boost::is_same<
+                    typename mpl::find_if<Args, mpl::not_<is_printable<mpl::_1> > >::type
+                  , typename mpl::end<Args>::type
+                >
+              , mpl::or_<boost::is_same<Group, ungrouped_args>, is_printable<Group> >
+            >
+        {};
+
+        template<typename Args>
+        std::string print_failure(Args const &args, mpl::true_)
+        {
+            std::stringstream sout;
+            sout << args;
+            return sout.str();
+        }
+
+        template<typename Args>
+        std::string print_failure(Args const &, mpl::false_)
+        {
+            return std::string();
+        }
+
         template<typename Seq, std::size_t I>
         struct safe_at_c
           : mpl::eval_if_c<
@@ -172,6 +239,36 @@ namespace quick_check
             >
         {};
 
+#if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) || defined(QCHK_DOXYGEN_INVOKED)
+        template<typename T>
+        struct is_grouped_by
+          : mpl::false_
+        {};
+
+        template<typename T>
+        struct is_grouped_by<grouped_by<T> >
+          : mpl::true_
+        {};
+
+        // With variadic Fusion, make_vector no longer drops trailing void_
+        // elements, so strip the grouped_by<> parameter explicitly.
+        template<typename ...As>
+        struct ungrouped_args_vector
+          : fusion::result_of::as_vector<
+                typename mpl::remove_if<
+                    mpl::vector<As...>
+                  , is_grouped_by<mpl::_>
+                >::type
+            >
+        {};
+
+        template<typename ...As>
+        struct find_grouped_by_type
+          : detail::grouped_by_<
+                typename mpl::back<mpl::vector<As...> >::type
+            >
+        {};
+#else
         template<BOOST_PP_ENUM_PARAMS_WITH_A_DEFAULT(QCHK_MAX_ARITY, typename A, void)>
         struct find_grouped_by_type
           : detail::grouped_by_<
@@ -186,6 +283,7 @@ namespace quick_check
                 >::type
             >
         {};
+#endif
 
         template<>
         struct find_grouped_by_type<>
@@ -213,17 +311,13 @@ namespace quick_check
 #if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) || defined(QCHK_DOXYGEN_INVOKED)
     template<typename...As>
     struct qcheck_args
-      : fusion::result_of::make_vector<
-            typename detail::fusion_elem_ignore_grouped<As>::type...
-        >::type
+      : detail::ungrouped_args_vector<As...>::type
     {
         /// A tuple-like type where the tuple elements correspond the
         /// the template arguments with which this \c property<> type
         /// was instantiated, minus \c grouped_by<>, if present.
         typedef
-            typename fusion::result_of::make_vector<
-                typename detail::fusion_elem_ignore_grouped<As>::type...
-            >::type
+            typename detail::ungrouped_args_vector<As...>::type
         args_type;
 
         /// If an instance of \c grouped_by<> is the last template parameter
@@ -262,14 +356,32 @@ namespace quick_check
         /// \param args A tuple-like object containing a set of arguments.
         /// \param classes The classifications applicable to this set of arguments, if any.
         /// \param group The group to which this set of arguments belongs, if any.
+        /// \param case_index The index of the test case that generated this
+        ///                   set of arguments, if known.
         qcheck_args(
             args_type const &args
           , std::vector<std::string> const &classes
           , grouped_by_type const &group
+          , std::size_t case_index = 0
         )
           : args_type(args)
           , classes_(classes)
           , group_(group)
+          , case_index_(case_index)
+        {}
+
+        /// \overload
+        ///
+        qcheck_args(
+            BOOST_RV_REF(args_type) args
+          , std::vector<std::string> const &classes
+          , grouped_by_type const &group
+          , std::size_t case_index = 0
+        )
+          : args_type(boost::move(args))
+          , classes_(classes)
+          , group_(group)
+          , case_index_(case_index)
         {}
 
         /// \overload
@@ -278,6 +390,7 @@ namespace quick_check
           : args_type(args)
           , classes_(classes)
           , group_()
+          , case_index_(0)
         {}
 
         /// \overload
@@ -286,8 +399,28 @@ namespace quick_check
           : args_type(args)
           , classes_()
           , group_()
+          , case_index_(0)
         {}
 
+        /// The index of the test case that generated this set of arguments.
+        /// If the config was created with \c _seed, passing this to
+        /// \c config::operator()(std::size_t) regenerates the arguments.
+        /// Arguments that no test case generated, like a shrunk failure,
+        /// have the index <tt>std::size_t(-1)</tt>.
+        ///
+        /// \sa \c has_case_index
+        std::size_t case_index() const
+        {
+            return this->case_index_;
+        }
+
+        /// Whether a test case generated this set of arguments, so that
+        /// \c case_index() can regenerate it. False for a shrunk failure.
+        bool has_case_index() const
+        {
+            return this->case_index_ != std::size_t(-1);
+        }
+
         friend std::ostream &operator<<(std::ostream &sout, qcheck_args const &args)
         {
             bool first = true;
@@ -311,6 +444,7 @@ namespace quick_check
     private:
         std::vector<std::string> classes_;
         grouped_by_type group_;
+        std::size_t case_index_;
     };
 
 #if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) || defined(QCHK_DOXYGEN_INVOKED)
@@ -357,7 +491,7 @@ namespace quick_check
             };
         )
         typedef
-            std::pair<grouped_by_type, std::vector<std::string> >
+            std::pair<grouped_by_type, detail::class_mask>
         key_type;
 
         BOOST_COPYABLE_AND_MOVABLE(qcheck_results)
@@ -371,9 +505,18 @@ namespace quick_check
         qcheck_results()
           : failures_()
           , categories_()
+          , class_names_()
           , nbr_tests_(0)
           , first_failed_test_(0)
           , exhausted_(false)
+          , stopped_early_(false)
+          , shrunk_()
+          , shrink_count_(0)
+          , stats_()
+          , sink_()
+          , schedule_()
+          , nbr_failures_(0)
+          , nbr_duplicates_(0)
         {}
 
         /// Copy constructor
@@ -386,9 +529,18 @@ namespace quick_check
         qcheck_results(qcheck_results const &that)
           : failures_(that.failures_)
           , categories_(that.categories_)
+          , class_names_(that.class_names_)
           , nbr_tests_(that.nbr_tests_)
           , first_failed_test_(that.first_failed_test_)
           , exhausted_(that.exhausted_)
+          , stopped_early_(that.stopped_early_)
+          , shrunk_(that.shrunk_)
+          , shrink_count_(that.shrink_count_)
+          , stats_(that.stats_)
+          , sink_(that.sink_)
+          , schedule_(that.schedule_)
+          , nbr_failures_(that.nbr_failures_)
+          , nbr_duplicates_(that.nbr_duplicates_)
         {}
 
         /// Copy assignment operator
@@ -402,9 +554,18 @@ namespace quick_check
         {
             this->failures_ = that.failures_;
             this->categories_ = that.categories_;
+            this->class_names_ = that.class_names_;
             this->nbr_tests_ = that.nbr_tests_;
             this->first_failed_test_ = that.first_failed_test_;
             this->exhausted_ = that.exhausted_;
+            this->stopped_early_ = that.stopped_early_;
+            this->shrunk_ = that.shrunk_;
+            this->shrink_count_ = that.shrink_count_;
+            this->stats_ = that.stats_;
+            this->sink_ = that.sink_;
+            this->schedule_ = that.schedule_;
+            this->nbr_failures_ = that.nbr_failures_;
+            this->nbr_duplicates_ = that.nbr_duplicates_;
             return *this;
         }
 
@@ -419,9 +580,18 @@ namespace quick_check
         qcheck_results(BOOST_RV_REF(qcheck_results) that) BOOST_NOEXCEPT
           : failures_(boost::move(that.failures_))
           , categories_(boost::move(that.categories_))
+          , class_names_(boost::move(that.class_names_))
           , nbr_tests_(that.nbr_tests_)
           , first_failed_test_(that.first_failed_test_)
           , exhausted_(that.exhausted_)
+          , stopped_early_(that.stopped_early_)
+          , shrunk_(boost::move(that.shrunk_))
+          , shrink_count_(that.shrink_count_)
+          , stats_(boost::move(that.stats_))
+          , sink_(boost::move(that.sink_))
+          , schedule_(boost::move(that.schedule_))
+          , nbr_failures_(that.nbr_failures_)
+          , nbr_duplicates_(that.nbr_duplicates_)
         {}
 
         /// Move assignment operator
@@ -436,22 +606,108 @@ namespace quick_check
         {
             this->failures_ = boost::move(that.failures_);
             this->categories_ = boost::move(that.categories_);
+            this->class_names_ = boost::move(that.class_names_);
             this->nbr_tests_ = that.nbr_tests_;
             this->first_failed_test_ = that.first_failed_test_;
             this->exhausted_ = that.exhausted_;
+            this->stopped_early_ = that.stopped_early_;
+            this->shrunk_ = boost::move(that.shrunk_);
+            this->shrink_count_ = that.shrink_count_;
+            this->stats_ = boost::move(that.stats_);
+            this->sink_ = boost::move(that.sink_);
+            this->schedule_ = boost::move(that.schedule_);
+            this->nbr_failures_ = that.nbr_failures_;
+            this->nbr_duplicates_ = that.nbr_duplicates_;
+            return *this;
+        }
+
+        /// Merge the results of another test run into \c *this, as if the
+        /// tests recorded in \c that had run after those recorded in
+        /// \c *this. This is useful for combining the results of test runs
+        /// that were sharded or batched.
+        ///
+        /// \param that The results to merge. \c that is left in an
+        ///             unspecified state.
+        ///
+        /// \pre <tt>&that != this</tt>
+        /// \post <tt>this->failures()</tt> holds the failures from \c *this
+        ///       followed by the failures from \c that, as far as the
+        ///       \c failure_sink of \c *this allows.
+        /// \post <tt>this->failure_count()</tt> is the sum of the failure
+        ///       counts of both objects.
+        /// \post <tt>this->exhausted()</tt> is true if either object was
+        ///       exhausted, and likewise for <tt>this->stopped_early()</tt>.
+        /// \post <tt>this->stats()</tt> holds the sum of the statistics of
+        ///       both objects, and likewise for <tt>this->duplicate_count()</tt>.
+        ///
+        /// The failing argument sets are moved rather than copied, and the
+        /// category counts are merged in time linear in the number of
+        /// categories.
+        ///
+        /// \return \c *this
+        ///
+        /// \throw std::length_error if the two objects have more than 64
+        ///        distinct class names between them, in which case neither
+        ///        is changed.
+        qcheck_results &merge(BOOST_RV_REF(qcheck_results) that)
+        {
+            BOOST_ASSERT(&that != this);
+
+            // First, since it is the only step that can fail.
+            if(!that.categories_.empty() && that.class_names_ != this->class_names_)
+                this->adopt_class_names(that);
+
+            if(this->first_failed_test_ == 0 && that.first_failed_test_ != 0)
+                this->first_failed_test_ = this->nbr_tests_ + that.first_failed_test_;
+
+            if(this->nbr_failures_ == 0)
+            {
+                this->failures_.swap(that.failures_);
+                this->shrunk_ = boost::move(that.shrunk_);
+                this->shrink_count_ = that.shrink_count_;
+            }
+            else
+                this->failures_.insert(
+                    this->failures_.end()
+                  , boost::make_move_iterator(that.failures_.begin())
+                  , boost::make_move_iterator(that.failures_.end())
+                );
+            this->nbr_failures_ += that.nbr_failures_;
+            this->trim_failures();
+
+            if(this->categories_.empty())
+                this->categories_.swap(that.categories_);
+            else if(!that.categories_.empty())
+                this->merge_categories(that.categories_);
+
+            this->nbr_tests_ += that.nbr_tests_;
+            this->nbr_duplicates_ += that.nbr_duplicates_;
+            this->exhausted_ = this->exhausted_ || that.exhausted_;
+            this->stopped_early_ = this->stopped_early_ || that.stopped_early_;
+            this->stats_.merge(that.stats_);
+            if(!this->schedule_.scheduled())
+                this->schedule_ = boost::move(that.schedule_);
             return *this;
         }
 
+        /// Equivalent to <tt>this->merge(boost::move(that))</tt>
+        ///
+        /// \return \c *this
+        qcheck_results &operator+=(BOOST_RV_REF(qcheck_results) that)
+        {
+            return this->merge(boost::move(that));
+        }
+
         /// If \c *this was returned from \c qcheck(), then \c success() reports
         /// the success or failure of the \c qcheck() test run. Otherwise, returns
         /// true.
         ///
-        /// \return <tt>this->failures().empty()</tt>
+        /// \return <tt>this->failure_count() == 0</tt>
         ///
         /// \throw nothrow
         bool success() const
         {
-            return this->failures_.empty();
+            return this->nbr_failures_ == 0;
         }
 
         /// If \c *this was returned from \c qcheck(), then \c exhausted() reports
@@ -470,6 +726,104 @@ namespace quick_check
             return this->exhausted_;
         }
 
+        /// If \c *this was returned from \c qcheck(), then \c stopped_early()
+        /// reports true if testing stopped because \c max_failures failures
+        /// had been recorded, and false otherwise.
+        ///
+        /// \throw nothrow
+        ///
+        /// \sa \c config::max_failures
+        bool stopped_early() const
+        {
+            return this->stopped_early_;
+        }
+
+        /// Returns the number of tests that were run; that is, the number of
+        /// generated argument sets that satisfied the property's condition.
+        /// With a time budget, it may be more than the config's
+        /// \c test_count.
+        ///
+        /// \sa \c quick_check::_time_budget
+        ///
+        /// \throw nothrow
+        std::size_t test_count() const
+        {
+            return this->nbr_tests_;
+        }
+
+        /// Returns the number of generated argument sets that were skipped
+        /// without being tested because they had been tested already. It is
+        /// 0 unless the config was made with <tt>_dedupe = true</tt>.
+        ///
+        /// \sa \c quick_check::_dedupe
+        ///
+        /// \throw nothrow
+        std::size_t duplicate_count() const
+        {
+            return this->nbr_duplicates_;
+        }
+
+        /// Returns the number of tests that failed. This counts every
+        /// failure, including those that the config's \c failure_sink did not
+        /// keep in <tt>this->failures()</tt>.
+        ///
+        /// \throw nothrow
+        ///
+        /// \sa \c quick_check::_failure_sink
+        std::size_t failure_count() const
+        {
+            return this->nbr_failures_;
+        }
+
+        /// Returns the number of times the first failing set of arguments
+        /// was successfully shrunk to a simpler one.
+        ///
+        /// \throw nothrow
+        ///
+        /// \sa \c config::max_shrinks
+        std::size_t shrink_count() const
+        {
+            return this->shrink_count_;
+        }
+
+        /// Returns the simplest set of arguments found that caused the
+        /// property to fail. This is the first failure after it has been
+        /// shrunk, or <tt>this->failures()[0]</tt> if it could not be shrunk.
+        /// A shrunk failure has no case index, so
+        /// <tt>!this->smallest_failure().has_case_index()</tt> after a shrink.
+        ///
+        /// \pre <tt>!this->success()</tt>
+        args_type const &smallest_failure() const
+        {
+            BOOST_ASSERT(!this->success());
+            return this->shrunk_ ? this->shrunk_.get() : this->failures_[0];
+        }
+
+        /// Returns the per-phase timings and counters of the test run. They
+        /// are only collected if the config was made with
+        /// <tt>_stats = collect_stats()</tt>; otherwise,
+        /// <tt>!this->stats().enabled()</tt>.
+        ///
+        /// \throw nothrow
+        ///
+        /// \sa \c quick_check::_stats
+        qcheck_stats const &stats() const
+        {
+            return this->stats_;
+        }
+
+        /// Returns the size schedule of the config that was tested, so that
+        /// the size each test case was generated with can be recovered from
+        /// its index. If the config had none, <tt>!this->size_schedule().scheduled()</tt>.
+        ///
+        /// \throw nothrow
+        ///
+        /// \sa \c quick_check::_size_schedule
+        quick_check::size_schedule const &size_schedule() const
+        {
+            return this->schedule_;
+        }
+
         /// INTERNAL ONLY
         typedef int detail_smart_bool_type_::* unspecified_bool_type;
 
@@ -485,8 +839,12 @@ namespace quick_check
         }
 
         /// Returns a Range of arguments and their associated metadata that caused
-        /// an invocation of the \c qcheck() algorithm to fail.
+        /// an invocation of the \c qcheck() algorithm to fail. Which of them
+        /// are kept is decided by the config's \c failure_sink; by default,
+        /// all of them are. If there were any, the first is always kept, as
+        /// <tt>this->failures()[0]</tt>.
         ///
+        /// \sa \c quick_check::_failure_sink
         std::vector<args_type> const &failures() const
         {
             return this->failures_;
@@ -508,13 +866,31 @@ namespace quick_check
                 else
                     sout << (boost::format("OK, passed %1% tests.\n")
                                 % this->nbr_tests_);
+                if(this->nbr_duplicates_ != 0)
+                    sout << (boost::format("Skipped %1% duplicate test cases.\n")
+                                % this->nbr_duplicates_);
                 // If we have groups or classes, print them now.
                 if(!std::is_same<grouped_by_type, detail::ungrouped_args>::value ||
                    this->categories_.size() != 1 ||
-                   this->categories_.begin()->first.second.size() != 0)
+                   this->categories_.begin()->first.second != 0)
                 {
-                    // Iterate over the categories and print them with percentages
+                    // Name the categories, and print them in order of their
+                    // names with percentages.
+                    typedef std::pair<grouped_by_type, std::vector<std::string> > named_key_type;
+                    std::vector<std::pair<named_key_type, std::size_t> > named;
+                    named.reserve(this->categories_.size());
                     for(std::pair<key_type, std::size_t> const &p : this->categories_)
+                        named.push_back(std::make_pair(
+                            named_key_type(
+                                p.first.first
+                              , detail::class_names(this->class_names_, p.first.second)
+                            )
+                          , p.second
+                        ));
+                    std::sort(named.begin(), named.end());
+                    // Clauses that share a name make one category.
+                    named.erase(detail::merge_adjacent(named.begin(), named.end()), named.end());
+                    for(std::pair<named_key_type, std::size_t> const &p : named)
                     {
                         sout << (boost::format("%1$.0f%% %2%.\n")
                                     % ((p.second * 100.) / this->nbr_tests_)
@@ -525,17 +901,39 @@ namespace quick_check
             }
             else
             {
-                sout << (boost::format("Falsifiable, after %1% tests:\n%2%\n")
-                            % this->first_failed_test_
-                            % this->failures_[0]);
+                if(this->shrink_count_ == 0)
+                    sout << (boost::format("Falsifiable, after %1% tests:\n%2%\n")
+                                % this->first_failed_test_
+                                % this->failures_[0]);
+                else
+                    sout << (boost::format("Falsifiable, after %1% tests and %2% shrinks:\n%3%\n")
+                                % this->first_failed_test_
+                                % this->shrink_count_
+                                % this->smallest_failure());
+                if(this->stopped_early_)
+                    sout << (boost::format("Stopped after %1% tests and %2% failures.\n")
+                                % this->nbr_tests_
+                                % this->nbr_failures_);
                 sout << std::flush;
             }
             return sout;
         }
 
+        /// Write the statistics returned by \c stats() to the specified
+        /// \c std::ostream, as by \c qcheck_stats::print().
+        ///
+        /// \param sout The \c std::ostream to which the statistics should be written.
+        ///
+        /// \return \c sout
+        std::ostream &print_stats(std::ostream &sout = std::cout) const
+        {
+            return this->stats_.print(sout);
+        }
+
     private:
         /// INTERNAL ONLY
-        static std::string category_name(key_type const &p)
+        template<typename NamedKey>
+        static std::string category_name(NamedKey const &p)
         {
             std::stringstream sout;
             std::vector<std::string> tmp = p.second;
@@ -550,44 +948,285 @@ namespace quick_check
         /// INTERNAL ONLY
         typedef typename args_type::args_type inner_args_type;
 
+        /// INTERNAL ONLY
+        typedef boost::container::flat_map<key_type, std::size_t> categories_type;
+
+        /// INTERNAL ONLY
+        /// Both maps are sorted by key, so a single merge pass suffices.
+        void merge_categories(categories_type &that)
+        {
+            typedef typename categories_type::iterator iterator;
+            typename categories_type::sequence_type merged;
+            merged.reserve(this->categories_.size() + that.size());
+            iterator b0 = this->categories_.begin(), e0 = this->categories_.end();
+            iterator b1 = that.begin(), e1 = that.end();
+            while(b0 != e0 && b1 != e1)
+            {
+                if(b0->first < b1->first)
+                    merged.push_back(boost::move(*b0++));
+                else if(b1->first < b0->first)
+                    merged.push_back(boost::move(*b1++));
+                else
+                {
+                    merged.push_back(boost::move(*b0++));
+                    merged.back().second += (b1++)->second;
+                }
+            }
+            merged.insert(merged.end(), boost::make_move_iterator(b0), boost::make_move_iterator(e0));
+            merged.insert(merged.end(), boost::make_move_iterator(b1), boost::make_move_iterator(e1));
+            this->categories_.adopt_sequence(boost::container::ordered_unique_range, boost::move(merged));
+        }
+
+        /// INTERNAL ONLY
+        /// Re-key the categories of that by the class names of *this,
+        /// adding any class names that *this lacks.
+        /// Throws std::length_error, without changing either object, if
+        /// that would take more than 64 class names.
+        void adopt_class_names(qcheck_results &that)
+        {
+            std::vector<std::string> names(this->class_names_);
+            std::vector<std::size_t> bits(that.class_names_.size());
+            for(std::size_t i = 0; i < bits.size(); ++i)
+            {
+                auto const it = std::find(names.begin(), names.end(), that.class_names_[i]);
+                bits[i] = static_cast<std::size_t>(it - names.begin());
+                if(it == names.end())
+                    names.push_back(that.class_names_[i]);
+            }
+            if(names.size() > 64)
+                throw std::length_error(
+                    "Can't merge the results of properties with more than 64 distinct class names.");
+
+            categories_type rekeyed;
+            for(std::pair<key_type, std::size_t> const &p : that.categories_)
+            {
+                detail::class_mask mask = 0;
+                for(std::size_t i = 0; i < bits.size(); ++i)
+                    if(p.first.second >> i & 1u)
+                        mask |= detail::class_mask(1u) << bits[i];
+                rekeyed[key_type(p.first.first, mask)] += p.second;
+            }
+            that.categories_.swap(rekeyed);
+            this->class_names_.swap(names);
+            that.class_names_ = this->class_names_;
+        }
+
+        /// INTERNAL ONLY
+        void set_class_names(std::vector<std::string> const &names)
+        {
+            BOOST_ASSERT(this->categories_.empty());
+            this->class_names_ = names;
+        }
+
         /// INTERNAL ONLY
         void add_failure(
             inner_args_type const &args
-          , std::vector<std::string> const &classes
+          , detail::class_mask classes
+          , grouped_by_type const &group
+          , std::size_t case_index
+        )
+        {
+            // Only make a copy of the arguments if it is going somewhere.
+            if(this->count_failure(classes, group, case_index))
+                this->record_failure(inner_args_type(args), classes, group, case_index);
+        }
+
+        /// INTERNAL ONLY
+        /// Counts a failure, and returns whether its arguments should be
+        /// passed to record_failure().
+        bool count_failure(
+            detail::class_mask classes
           , grouped_by_type const &group
+          , std::size_t case_index
         )
         {
             this->add_success(classes, group);
-            failures_.push_back(args_type(args, classes, group));
             if(this->first_failed_test_ == 0)
                 this->first_failed_test_ = this->nbr_tests_;
+            ++this->nbr_failures_;
+            return this->has_room_for(case_index) || this->sink_.streaming();
+        }
+
+        /// INTERNAL ONLY
+        void record_failure(
+            BOOST_RV_REF(inner_args_type) args
+          , detail::class_mask classes
+          , grouped_by_type const &group
+          , std::size_t case_index
+        )
+        {
+            bool const keep = this->has_room_for(case_index);
+            args_type failure(
+                boost::move(args)
+              , detail::class_names(this->class_names_, classes)
+              , group
+              , case_index
+            );
+            if(this->sink_.streaming())
+                this->sink_.stream(
+                    case_index
+                  , detail::print_failure(
+                        failure
+                      , typename detail::are_printable<inner_args_type, grouped_by_type>::type()
+                    )
+                );
+            if(keep)
+                this->keep_failure(boost::move(failure));
+        }
+
+        /// INTERNAL ONLY
+        /// Orders the sampled failures so that the one to evict next is at
+        /// the top of a max-heap.
+        struct by_priority
+        {
+            bool operator()(args_type const &a, args_type const &b) const
+            {
+                return failure_sink::priority(a.case_index()) <
+                       failure_sink::priority(b.case_index());
+            }
+        };
+
+        /// INTERNAL ONLY
+        /// Would the failure of the test case case_index be kept? When
+        /// sampling, the failures after the first are kept in a heap.
+        bool has_room_for(std::size_t case_index) const
+        {
+            if(this->failures_.size() < this->sink_.capacity())
+                return true;
+            return this->sink_.retention() == failure_sink::keep_sample &&
+                   this->failures_.size() > 1 &&
+                   failure_sink::priority(case_index) <
+                       failure_sink::priority(this->failures_[1].case_index());
+        }
+
+        /// INTERNAL ONLY
+        void keep_failure(BOOST_RV_REF(args_type) failure)
+        {
+            typedef typename failures_type::iterator iterator;
+            bool const sampled = this->sink_.retention() == failure_sink::keep_sample;
+            if(this->failures_.size() < this->sink_.capacity())
+            {
+                this->failures_.push_back(boost::move(failure));
+                if(sampled && this->failures_.size() > 2)
+                    std::push_heap(this->failures_.begin() + 1, this->failures_.end(), by_priority());
+            }
+            else
+            {
+                iterator const begin = this->failures_.begin() + 1, end = this->failures_.end();
+                std::pop_heap(begin, end, by_priority());
+                this->failures_.back() = boost::move(failure);
+                std::push_heap(begin, end, by_priority());
+            }
+        }
+
+        /// INTERNAL ONLY
+        /// Keep no more failures than the sink allows after a merge.
+        void trim_failures()
+        {
+            typedef typename failures_type::iterator iterator;
+            std::size_t const capacity = this->sink_.capacity();
+            if(this->sink_.retention() == failure_sink::keep_sample && this->failures_.size() > 1)
+            {
+                if(this->failures_.size() > capacity)
+                    std::nth_element(
+                        this->failures_.begin() + 1
+                      , this->failures_.begin() + capacity
+                      , this->failures_.end()
+                      , by_priority()
+                    );
+                iterator const end = this->failures_.begin() + (std::min)(capacity, this->failures_.size());
+                this->failures_.erase(end, this->failures_.end());
+                std::make_heap(this->failures_.begin() + 1, this->failures_.end(), by_priority());
+            }
+            else if(this->failures_.size() > capacity)
+                this->failures_.erase(this->failures_.begin() + capacity, this->failures_.end());
+        }
+
+        /// INTERNAL ONLY
+        void set_failure_sink(failure_sink const &sink)
+        {
+            BOOST_ASSERT(this->nbr_failures_ == 0);
+            this->sink_ = sink;
+        }
+
+        /// INTERNAL ONLY
+        void set_size_schedule(quick_check::size_schedule const &schedule)
+        {
+            this->schedule_ = schedule;
         }
 
         /// INTERNAL ONLY
         void add_success(
-            std::vector<std::string> const &classes
+            detail::class_mask classes
           , grouped_by_type const &group
         )
         {
             // Track the group/category as long as there is one.
             if(!std::is_same<grouped_by_type, detail::ungrouped_args>::value ||
-               !classes.empty())
+               classes != 0)
                 ++this->categories_[key_type(group, classes)];
             ++this->nbr_tests_;
         }
 
+        /// INTERNAL ONLY
+        void add_successes(std::size_t count)
+        {
+            static_assert(
+                std::is_same<grouped_by_type, detail::ungrouped_args>::value
+              , "Only unclassified, ungrouped successes can be added in bulk"
+            );
+            this->nbr_tests_ += count;
+        }
+
+        /// INTERNAL ONLY
+        void add_duplicate()
+        {
+            ++this->nbr_duplicates_;
+        }
+
         /// INTERNAL ONLY
         void set_exhausted()
         {
             this->exhausted_ = true;
         }
 
+        /// INTERNAL ONLY
+        void set_stopped_early()
+        {
+            this->stopped_early_ = true;
+        }
+
+        /// INTERNAL ONLY
+        void set_shrunk(
+            inner_args_type const &args
+          , detail::class_mask classes
+          , grouped_by_type const &group
+          , std::size_t shrink_count
+        )
+        {
+            BOOST_ASSERT(!this->success());
+            // No test case generates the shrunk arguments, so they have no
+            // index that would regenerate them.
+            this->shrunk_ = args_type(args, detail::class_names(this->class_names_, classes), group,
+                                      std::size_t(-1));
+            this->shrink_count_ = shrink_count;
+        }
+
         friend struct detail::qcheck_access;
         std::vector<args_type> failures_;
-        boost::container::flat_map<key_type, std::size_t> categories_;
+        categories_type categories_;
+        std::vector<std::string> class_names_;
         std::size_t nbr_tests_;
         std::size_t first_failed_test_;
         bool exhausted_;
+        bool stopped_early_;
+        boost::optional<args_type> shrunk_;
+        std::size_t shrink_count_;
+        qcheck_stats stats_;
+        failure_sink sink_;
+        quick_check::size_schedule schedule_;
+        std::size_t nbr_failures_;
+        std::size_t nbr_duplicates_;
     };
 
 }
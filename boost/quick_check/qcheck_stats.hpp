@@ -0,0 +1,223 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file qcheck_stats.hpp
+/// \brief Definition of \c quick_check::qcheck_stats, the per-phase timings and
+///        counters of a \c quick_check::qcheck() run, and of the \c no_stats and
+///        \c collect_stats policies that turn their collection off and on.
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QCHK_QCHECK_STATS_HPP_INCLUDED
+#define QCHK_QCHECK_STATS_HPP_INCLUDED
+
+#include <chrono>
+#include <vector>
+#include <iosfwd>
+#include <ostream>
+#include <iostream>
+#include <algorithm>
+#include <boost/format.hpp>
+#include <boost/quick_check/quick_check_fwd.hpp>
+
+QCHK_BOOST_NAMESPACE_BEGIN
+
+namespace quick_check
+{
+    /// A policy for use with \c quick_check::_stats that turns off the
+    /// collection of \c quick_check::qcheck_stats. This is the default, and
+    /// it costs nothing.
+    struct no_stats
+    {};
+
+    /// A policy for use with \c quick_check::_stats that turns on the
+    /// collection of \c quick_check::qcheck_stats.
+    struct collect_stats
+    {};
+
+    /// \brief Where the time of a \c qcheck() run went, and how many test
+    ///        cases were generated and rejected on the way.
+    ///
+    /// An object of type \c qcheck_stats is returned by
+    /// \c qcheck_results::stats(). It is only filled in if the config that was
+    /// tested was made with <tt>_stats = collect_stats()</tt>; otherwise,
+    /// \c enabled() is false, and all the times and counts are zero.
+    ///
+    /// \sa \c quick_check::_stats
+    struct qcheck_stats
+    {
+        /// The phases of a \c qcheck() run that are timed separately.
+        enum phase
+        {
+            generation      ///< Generating the arguments of the test cases
+          , condition       ///< Evaluating the property's condition
+          , classification  ///< Evaluating the property's classifiers
+          , grouping        ///< Evaluating the property's grouper
+          , property        ///< Evaluating the property itself
+          , shrinking       ///< Shrinking the first failure
+        };
+
+        /// The number of phases
+        static std::size_t const phase_count = 6;
+
+        /// Default constructor
+        ///
+        /// \post <tt>!this->enabled()</tt>
+        qcheck_stats()
+          : enabled_(false)
+          , times_()
+          , generated_(0)
+          , rejected_(0)
+          , draws_()
+        {
+            std::fill(this->times_, this->times_ + phase_count, std::chrono::nanoseconds(0));
+        }
+
+        /// Returns true if statistics were collected
+        ///
+        /// \throw nothrow
+        bool enabled() const
+        {
+            return this->enabled_;
+        }
+
+        /// Returns the cumulative time spent in the phase \c p
+        ///
+        /// \throw nothrow
+        std::chrono::nanoseconds time(phase p) const
+        {
+            return this->times_[p];
+        }
+
+        /// Returns the cumulative time spent in all the phases
+        ///
+        /// \throw nothrow
+        std::chrono::nanoseconds total_time() const
+        {
+            std::chrono::nanoseconds total(0);
+            for(std::size_t i = 0; i < phase_count; ++i)
+                total += this->times_[i];
+            return total;
+        }
+
+        /// Returns the number of sets of arguments that were generated, each
+        /// of which was checked against the property's condition.
+        ///
+        /// \throw nothrow
+        std::size_t generated() const
+        {
+            return this->generated_;
+        }
+
+        /// Returns the number of sets of arguments that did not satisfy the
+        /// property's condition.
+        ///
+        /// \throw nothrow
+        std::size_t rejected() const
+        {
+            return this->rejected_;
+        }
+
+        /// Returns <tt>this->rejected()</tt> as a fraction of
+        /// <tt>this->generated()</tt>, or 0 if nothing was generated.
+        ///
+        /// \throw nothrow
+        double rejection_rate() const
+        {
+            return this->generated_ == 0 ? 0. : double(this->rejected_) / this->generated_;
+        }
+
+        /// Returns the number of values drawn from the generator of each
+        /// argument. The \c i-th element is the count for the placeholder
+        /// <tt>_(i+1)</tt>.
+        std::vector<std::size_t> const &draws() const
+        {
+            return this->draws_;
+        }
+
+        /// Add the times and counts of \c that to those of \c *this. This is
+        /// used to combine the statistics of shards that ran in parallel, so
+        /// the times add up to more than the wall-clock time of the run.
+        ///
+        /// \return \c *this
+        qcheck_stats &merge(qcheck_stats const &that)
+        {
+            this->enabled_ = this->enabled_ || that.enabled_;
+            for(std::size_t i = 0; i < phase_count; ++i)
+                this->times_[i] += that.times_[i];
+            this->generated_ += that.generated_;
+            this->rejected_ += that.rejected_;
+            if(this->draws_.size() < that.draws_.size())
+                this->draws_.resize(that.draws_.size());
+            for(std::size_t i = 0; i < that.draws_.size(); ++i)
+                this->draws_[i] += that.draws_[i];
+            return *this;
+        }
+
+        /// Returns the name of the phase \c p, as written by \c print().
+        static char const *name(phase p)
+        {
+            static char const *const names[phase_count] =
+                {"generation", "condition", "classification", "grouping", "property", "shrinking"};
+            return names[p];
+        }
+
+        /// Write the statistics to the specified \c std::ostream, one line per
+        /// phase with its time in milliseconds and its share of the total.
+        ///
+        /// \param sout The \c std::ostream to which the statistics should be written.
+        ///
+        /// \return \c sout
+        std::ostream &print(std::ostream &sout = std::cout) const
+        {
+            if(!this->enabled_)
+                return sout << "No statistics collected.\n" << std::flush;
+
+            sout << (boost::format("Generated %1% argument sets, rejected %2% (%3$.1f%%).\n")
+                        % this->generated_
+                        % this->rejected_
+                        % (this->rejection_rate() * 100.));
+            if(!this->draws_.empty())
+            {
+                sout << "Draws:";
+                for(std::size_t i = 0; i < this->draws_.size(); ++i)
+                    sout << (boost::format(" _%1%=%2%") % (i + 1) % this->draws_[i]);
+                sout << "\n";
+            }
+            double const total = static_cast<double>(this->total_time().count());
+            for(std::size_t i = 0; i < phase_count; ++i)
+            {
+                double const ns = static_cast<double>(this->times_[i].count());
+                sout << (boost::format("%1$-15s%2$12.3f ms %3$5.1f%%\n")
+                            % qcheck_stats::name(static_cast<phase>(i))
+                            % (ns / 1e6)
+                            % (total == 0. ? 0. : ns * 100. / total));
+            }
+            return sout << std::flush;
+        }
+
+        /// Equivalent to <tt>stats.print(sout)</tt>
+        friend std::ostream &operator<<(std::ostream &sout, qcheck_stats const &stats)
+        {
+            return stats.print(sout);
+        }
+
+    private:
+        template<typename Policy>
+        friend struct detail::stats_recorder;
+        bool enabled_;
+        std::chrono::nanoseconds times_[phase_count];
+        std::size_t generated_;
+        std::size_t rejected_;
+        std::vector<std::size_t> draws_;
+    };
+}
+
+QCHK_BOOST_NAMESPACE_END
+
+#endif
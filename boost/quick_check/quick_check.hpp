@@ -17,12 +17,19 @@
 #include <boost/quick_check/quick_check_fwd.hpp>
 #include <boost/quick_check/config.hpp>
 #include <boost/quick_check/qcheck.hpp>
+#include <boost/quick_check/qcheck_batched.hpp>
+#include <boost/quick_check/qcheck_parallel.hpp>
+#include <boost/quick_check/qcheck_guided.hpp>
 #include <boost/quick_check/qcheck_results.hpp>
+#include <boost/quick_check/random.hpp>
 #include <boost/quick_check/property.hpp>
+#include <boost/quick_check/static_property.hpp>
 #include <boost/quick_check/generator.hpp>
 #include <boost/quick_check/classify.hpp>
 #include <boost/quick_check/group_by.hpp>
 #include <boost/quick_check/condition.hpp>
+#include <boost/quick_check/constrain.hpp>
+#include <boost/quick_check/corpus.hpp>
 #include <boost/phoenix/operator.hpp>
 
 #endif
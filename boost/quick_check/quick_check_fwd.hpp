@@ -90,29 +90,62 @@ namespace quick_check
 
         template<typename Args, typename GroupBy>
         struct make_qcheck_results_type;
+
+        template<typename Args, typename Group>
+        struct property_view;
+
+        template<typename Args, typename Group>
+        struct view_condition;
+
+        template<typename Policy>
+        struct stats_recorder;
     }
 
-    template<typename Map, typename Rng>
+    struct no_stats;
+
+    struct collect_stats;
+
+    struct qcheck_stats;
+
+    template<typename Map, typename Rng, typename Stats = no_stats>
     struct config;
 
 #if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) || defined(QCHK_DOXYGEN_INVOKED)
     template<typename ...As>
     struct property;
 
+    template<typename ...As>
+    struct static_property;
+
+    template<typename ...As>
+    struct property_ref;
+
     template<typename ...As>
     struct qcheck_results;
 
     template<typename ...As>
     struct qcheck_args;
+
+    template<typename ...As>
+    struct corpus;
 #else
     template<BOOST_PP_ENUM_PARAMS_WITH_A_DEFAULT(QCHK_MAX_ARITY, typename A, void)>
     struct property;
 
+    template<BOOST_PP_ENUM_PARAMS_WITH_A_DEFAULT(QCHK_MAX_ARITY, typename A, void)>
+    struct static_property;
+
+    template<BOOST_PP_ENUM_PARAMS_WITH_A_DEFAULT(QCHK_MAX_ARITY, typename A, void)>
+    struct property_ref;
+
     template<BOOST_PP_ENUM_PARAMS_WITH_A_DEFAULT(QCHK_MAX_ARITY, typename A, void)>
     struct qcheck_results;
 
     template<BOOST_PP_ENUM_PARAMS_WITH_A_DEFAULT(QCHK_MAX_ARITY, typename A, void)>
     struct qcheck_args;
+
+    template<BOOST_PP_ENUM_PARAMS_WITH_A_DEFAULT(QCHK_MAX_ARITY, typename A, void)>
+    struct corpus;
 #endif
 
     template<typename>
@@ -131,6 +164,20 @@ namespace quick_check
       , typename detail::get_group_by_type<Property, Config>::type
     >::type
     qcheck(Property const &prop, Config &config, std::size_t sized);
+
+    template<typename Property, typename Config>
+    typename detail::make_qcheck_results_type<
+        typename Config::result_type
+      , typename detail::get_group_by_type<Property, Config>::type
+    >::type
+    qcheck_parallel(Property const &prop, Config &config);
+
+    template<typename Property, typename Config>
+    typename detail::make_qcheck_results_type<
+        typename Config::result_type
+      , typename detail::get_group_by_type<Property, Config>::type
+    >::type
+    qcheck_parallel(Property const &prop, Config &config, std::size_t threads);
 }
 
 QCHK_BOOST_NAMESPACE_END
@@ -0,0 +1,21 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file random.hpp
+/// \brief Fast random number engines that can be used with \c quick_check::_rng
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QCHK_RANDOM_HPP_INCLUDED
+#define QCHK_RANDOM_HPP_INCLUDED
+
+#include <boost/quick_check/random/pcg.hpp>
+#include <boost/quick_check/random/philox.hpp>
+#include <boost/quick_check/random/xoshiro.hpp>
+
+#endif
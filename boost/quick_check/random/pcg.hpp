@@ -0,0 +1,212 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file pcg.hpp
+/// \brief Definition of \c quick_check::pcg64, a permuted congruential random number engine.
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QCHK_RANDOM_PCG_HPP_INCLUDED
+#define QCHK_RANDOM_PCG_HPP_INCLUDED
+
+#include <cstddef>
+#include <boost/cstdint.hpp>
+#include <boost/utility/enable_if.hpp>
+#include <boost/type_traits/is_arithmetic.hpp>
+#include <boost/quick_check/quick_check_fwd.hpp>
+#include <boost/quick_check/detail/random.hpp>
+
+QCHK_BOOST_NAMESPACE_BEGIN
+
+namespace quick_check
+{
+    /// \brief The PCG64 random number engine of M. E. O'Neill.
+    ///
+    /// \c pcg64 is a 128-bit linear congruential generator whose output is
+    /// permuted with an xor-shift and a data-dependent rotation (the XSL RR
+    /// variant), producing 64-bit words with a period of 2^128. Its stream
+    /// can be selected when seeding, and it can be advanced by any number of
+    /// steps in logarithmic time. See http://www.pcg-random.org/.
+    ///
+    /// \c pcg64 models the UniformRandomNumberGenerator concept and can be
+    /// passed to \c make_config with \c quick_check::_rng. Its \c fill member
+    /// writes a block of words at once, and generators like
+    /// \c quick_check::uniform\<\> use it when generating values in bulk.
+    struct pcg64
+    {
+        typedef boost::uint64_t result_type;
+
+        static bool const has_fixed_range = false;
+
+        /// The seed of a default-constructed engine
+        static result_type const default_seed = 0u;
+
+        /// \brief Construct an engine seeded with \c default_seed
+        pcg64()
+        {
+            this->seed();
+        }
+
+        /// \brief Construct an engine from a single integral seed
+        explicit pcg64(result_type value)
+        {
+            this->seed(value);
+        }
+
+        /// \brief Construct an engine from an integral seed on the stream
+        ///        numbered \c stream
+        pcg64(result_type value, result_type stream)
+        {
+            this->seed(value, stream);
+        }
+
+        /// \brief Construct an engine seeded from a SeedSeq
+        template<typename SeedSeq>
+        explicit pcg64(SeedSeq &seq,
+            typename boost::disable_if<boost::is_arithmetic<SeedSeq> >::type * = 0)
+        {
+            this->seed(seq);
+        }
+
+        /// \brief Reseed the engine with \c default_seed
+        void seed()
+        {
+            this->seed(default_seed);
+        }
+
+        /// \brief Reseed the engine from a single integral seed on the
+        ///        default stream
+        void seed(result_type value)
+        {
+            detail::uint128 const state = {0u, value};
+            this->seed_(state, default_increment());
+        }
+
+        /// \brief Reseed the engine from an integral seed on the stream
+        ///        numbered \c stream
+        void seed(result_type value, result_type stream)
+        {
+            detail::uint128 const state = {0u, value};
+            detail::uint128 const inc = {stream >> 63, stream << 1 | 1u};
+            this->seed_(state, inc);
+        }
+
+        /// \brief Reseed the engine from eight 32-bit words of a SeedSeq,
+        ///        which choose both the initial state and the stream
+        template<typename SeedSeq>
+        typename boost::disable_if<boost::is_arithmetic<SeedSeq> >::type seed(SeedSeq &seq)
+        {
+            boost::uint32_t words[8];
+            seq.generate(words, words + 8);
+            boost::uint64_t w[4];
+            for(std::size_t i = 0; i < 4; ++i)
+                w[i] = boost::uint64_t(words[2 * i]) | boost::uint64_t(words[2 * i + 1]) << 32;
+            detail::uint128 const state = {w[0], w[1]};
+            detail::uint128 const inc = {w[2] << 1 | w[3] >> 63, w[3] << 1 | 1u};
+            this->seed_(state, inc);
+        }
+
+        static BOOST_CONSTEXPR result_type min BOOST_PREVENT_MACRO_SUBSTITUTION ()
+        {
+            return 0u;
+        }
+
+        static BOOST_CONSTEXPR result_type max BOOST_PREVENT_MACRO_SUBSTITUTION ()
+        {
+            return ~result_type(0u);
+        }
+
+        /// \brief Return the next random word
+        result_type operator()()
+        {
+            this->state_ = this->state_ * multiplier() + this->inc_;
+            return output(this->state_);
+        }
+
+        /// \brief Write the next \c n random words to \c out
+        ///
+        /// Equivalent to \c n calls to \c operator().
+        void fill(boost::uint64_t *out, std::size_t n)
+        {
+            detail::uint128 state = this->state_;
+            detail::uint128 const mult = multiplier(), inc = this->inc_;
+            for(std::size_t i = 0; i < n; ++i)
+            {
+                state = state * mult + inc;
+                out[i] = output(state);
+            }
+            this->state_ = state;
+        }
+
+        /// \brief Advance the engine by \c z steps in O(log z) time
+        void discard(boost::uintmax_t z)
+        {
+            // F. Brown, "Random Number Generation with Arbitrary Stride", 1994
+            detail::uint128 const one = {0u, 1u};
+            detail::uint128 acc_mult = one, acc_plus = {0u, 0u};
+            detail::uint128 cur_mult = multiplier(), cur_plus = this->inc_;
+            for(; z != 0; z >>= 1)
+            {
+                if(z & 1u)
+                {
+                    acc_mult = acc_mult * cur_mult;
+                    acc_plus = acc_plus * cur_mult + cur_plus;
+                }
+                cur_plus = (cur_mult + one) * cur_plus;
+                cur_mult = cur_mult * cur_mult;
+            }
+            this->state_ = acc_mult * this->state_ + acc_plus;
+        }
+
+        friend bool operator==(pcg64 const &left, pcg64 const &right)
+        {
+            return left.state_ == right.state_ && left.inc_ == right.inc_;
+        }
+
+        friend bool operator!=(pcg64 const &left, pcg64 const &right)
+        {
+            return !(left == right);
+        }
+
+    private:
+        static detail::uint128 multiplier()
+        {
+            detail::uint128 const mult = {0x2360ED051FC65DA4ull, 0x4385DF649FCCF645ull};
+            return mult;
+        }
+
+        static detail::uint128 default_increment()
+        {
+            detail::uint128 const inc = {0x5851F42D4C957F2Dull, 0x14057B7EF767814Full};
+            return inc;
+        }
+
+        static result_type output(detail::uint128 state)
+        {
+            return detail::rotr64(state.hi ^ state.lo, static_cast<unsigned>(state.hi >> 58));
+        }
+
+        // As pcg_setseq_128_srandom_r in the PCG reference implementation
+        void seed_(detail::uint128 state, detail::uint128 inc)
+        {
+            detail::uint128 const zero = {0u, 0u};
+            this->state_ = zero;
+            this->inc_ = inc;
+            (*this)();
+            this->state_ = this->state_ + state;
+            (*this)();
+        }
+
+        detail::uint128 state_;
+        detail::uint128 inc_;
+    };
+}
+
+QCHK_BOOST_NAMESPACE_END
+
+#endif
@@ -0,0 +1,235 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file philox.hpp
+/// \brief Definition of \c quick_check::philox4x32, a counter-based random number engine.
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QCHK_RANDOM_PHILOX_HPP_INCLUDED
+#define QCHK_RANDOM_PHILOX_HPP_INCLUDED
+
+#include <cstddef>
+#include <boost/cstdint.hpp>
+#include <boost/utility/enable_if.hpp>
+#include <boost/type_traits/is_arithmetic.hpp>
+#include <boost/quick_check/quick_check_fwd.hpp>
+
+QCHK_BOOST_NAMESPACE_BEGIN
+
+namespace quick_check
+{
+    /// \brief The Philox4x32-10 counter-based random number engine of
+    ///        J. K. Salmon et al.
+    ///
+    /// \c philox4x32 encrypts a 128-bit counter with a 64-bit key in ten
+    /// rounds of multiplications and xors, and returns the four 32-bit words
+    /// of each encrypted block in turn. The state is nothing more than the
+    /// key and the counter, so seeding the engine is as cheap as it gets,
+    /// distinct keys give independent streams, and \c discard is O(1). See
+    /// "Parallel Random Numbers: As Easy as 1, 2, 3", SC11.
+    ///
+    /// \c philox4x32 models the UniformRandomNumberGenerator concept and can
+    /// be passed to \c make_config with \c quick_check::_rng. Its \c fill
+    /// member writes a block of 64-bit words at once, and generators like
+    /// \c quick_check::uniform\<\> use it when generating values in bulk.
+    struct philox4x32
+    {
+        typedef boost::uint32_t result_type;
+
+        static bool const has_fixed_range = false;
+
+        /// The seed of a default-constructed engine
+        static boost::uint64_t const default_seed = 0u;
+
+        /// \brief Construct an engine seeded with \c default_seed
+        philox4x32()
+        {
+            this->seed();
+        }
+
+        /// \brief Construct an engine whose key is \c value
+        explicit philox4x32(boost::uint64_t value)
+        {
+            this->seed(value);
+        }
+
+        /// \brief Construct an engine seeded from a SeedSeq
+        template<typename SeedSeq>
+        explicit philox4x32(SeedSeq &seq,
+            typename boost::disable_if<boost::is_arithmetic<SeedSeq> >::type * = 0)
+        {
+            this->seed(seq);
+        }
+
+        /// \brief Reseed the engine with \c default_seed
+        void seed()
+        {
+            this->seed(default_seed);
+        }
+
+        /// \brief Reseed the engine with the key \c value and a zero counter
+        void seed(boost::uint64_t value)
+        {
+            this->key_[0] = static_cast<boost::uint32_t>(value);
+            this->key_[1] = static_cast<boost::uint32_t>(value >> 32);
+            this->ctr_[0] = this->ctr_[1] = this->ctr_[2] = this->ctr_[3] = 0u;
+            this->idx_ = 4;
+        }
+
+        /// \brief Reseed the engine from four 32-bit words of a SeedSeq,
+        ///        which make up the key and the high half of the counter
+        template<typename SeedSeq>
+        typename boost::disable_if<boost::is_arithmetic<SeedSeq> >::type seed(SeedSeq &seq)
+        {
+            boost::uint32_t words[4];
+            seq.generate(words, words + 4);
+            this->key_[0] = words[0];
+            this->key_[1] = words[1];
+            this->ctr_[0] = this->ctr_[1] = 0u;
+            this->ctr_[2] = words[2];
+            this->ctr_[3] = words[3];
+            this->idx_ = 4;
+        }
+
+        static BOOST_CONSTEXPR result_type min BOOST_PREVENT_MACRO_SUBSTITUTION ()
+        {
+            return 0u;
+        }
+
+        static BOOST_CONSTEXPR result_type max BOOST_PREVENT_MACRO_SUBSTITUTION ()
+        {
+            return ~result_type(0u);
+        }
+
+        /// \brief Return the next random word
+        result_type operator()()
+        {
+            if(this->idx_ == 4)
+            {
+                this->next_block_(this->out_);
+                this->idx_ = 0;
+            }
+            return this->out_[this->idx_++];
+        }
+
+        /// \brief Write the next \c 2*n random 32-bit words to \c out, two to
+        ///        a 64-bit word with the first in the low half
+        ///
+        /// Whole blocks are encrypted straight into \c out.
+        void fill(boost::uint64_t *out, std::size_t n)
+        {
+            std::size_t i = 0;
+            for(; i != n && this->idx_ != 4; ++i)
+                out[i] = this->next_pair_();
+            for(; n - i >= 2; i += 2)
+            {
+                boost::uint32_t block[4];
+                this->next_block_(block);
+                out[i] = boost::uint64_t(block[0]) | boost::uint64_t(block[1]) << 32;
+                out[i + 1] = boost::uint64_t(block[2]) | boost::uint64_t(block[3]) << 32;
+            }
+            for(; i != n; ++i)
+                out[i] = this->next_pair_();
+        }
+
+        /// \brief Advance the engine by \c z steps in O(1) time
+        void discard(boost::uintmax_t z)
+        {
+            if(z <= 4u - this->idx_)
+            {
+                this->idx_ += static_cast<unsigned>(z);
+                return;
+            }
+            z -= 4u - this->idx_;
+            this->add_to_counter_(static_cast<boost::uint64_t>(z / 4));
+            this->idx_ = 4;
+            if(unsigned const rest = static_cast<unsigned>(z % 4))
+            {
+                this->next_block_(this->out_);
+                this->idx_ = rest;
+            }
+        }
+
+        friend bool operator==(philox4x32 const &left, philox4x32 const &right)
+        {
+            // The buffered block is a function of the key and counter.
+            return left.key_[0] == right.key_[0] && left.key_[1] == right.key_[1] &&
+                   left.ctr_[0] == right.ctr_[0] && left.ctr_[1] == right.ctr_[1] &&
+                   left.ctr_[2] == right.ctr_[2] && left.ctr_[3] == right.ctr_[3] &&
+                   left.idx_ == right.idx_;
+        }
+
+        friend bool operator!=(philox4x32 const &left, philox4x32 const &right)
+        {
+            return !(left == right);
+        }
+
+        /// \brief Encrypt the counter \c ctr with the key \c key
+        ///
+        /// The Philox4x32-10 bijection, for callers that want random access
+        /// to the stream.
+        static void encrypt(boost::uint32_t const ctr[4], boost::uint32_t const key[2],
+                            boost::uint32_t out[4])
+        {
+            boost::uint32_t c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3];
+            boost::uint32_t k0 = key[0], k1 = key[1];
+            for(int round = 0; round != 10; ++round)
+            {
+                if(round != 0)
+                {
+                    k0 += 0x9E3779B9u;
+                    k1 += 0xBB67AE85u;
+                }
+                boost::uint64_t const p0 = boost::uint64_t(0xD2511F53u) * c0;
+                boost::uint64_t const p1 = boost::uint64_t(0xCD9E8D57u) * c2;
+                c0 = static_cast<boost::uint32_t>(p1 >> 32) ^ c1 ^ k0;
+                c1 = static_cast<boost::uint32_t>(p1);
+                c2 = static_cast<boost::uint32_t>(p0 >> 32) ^ c3 ^ k1;
+                c3 = static_cast<boost::uint32_t>(p0);
+            }
+            out[0] = c0;
+            out[1] = c1;
+            out[2] = c2;
+            out[3] = c3;
+        }
+
+    private:
+        void next_block_(boost::uint32_t out[4])
+        {
+            encrypt(this->ctr_, this->key_, out);
+            this->add_to_counter_(1u);
+        }
+
+        boost::uint64_t next_pair_()
+        {
+            boost::uint64_t const lo = (*this)();
+            return lo | boost::uint64_t((*this)()) << 32;
+        }
+
+        void add_to_counter_(boost::uint64_t n)
+        {
+            boost::uint64_t const lo =
+                boost::uint64_t(this->ctr_[0]) | boost::uint64_t(this->ctr_[1]) << 32;
+            boost::uint64_t const sum = lo + n;
+            this->ctr_[0] = static_cast<boost::uint32_t>(sum);
+            this->ctr_[1] = static_cast<boost::uint32_t>(sum >> 32);
+            if(sum < lo && ++this->ctr_[2] == 0u)
+                ++this->ctr_[3];
+        }
+
+        boost::uint32_t key_[2];
+        boost::uint32_t ctr_[4];
+        boost::uint32_t out_[4];
+        unsigned idx_;
+    };
+}
+
+QCHK_BOOST_NAMESPACE_END
+
+#endif
@@ -0,0 +1,179 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file xoshiro.hpp
+/// \brief Definition of \c quick_check::xoshiro256ss, a small and very fast random number
+///        engine.
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QCHK_RANDOM_XOSHIRO_HPP_INCLUDED
+#define QCHK_RANDOM_XOSHIRO_HPP_INCLUDED
+
+#include <cstddef>
+#include <boost/cstdint.hpp>
+#include <boost/utility/enable_if.hpp>
+#include <boost/type_traits/is_arithmetic.hpp>
+#include <boost/quick_check/quick_check_fwd.hpp>
+#include <boost/quick_check/detail/random.hpp>
+
+QCHK_BOOST_NAMESPACE_BEGIN
+
+namespace quick_check
+{
+    /// \brief The xoshiro256** random number engine of D. Blackman and S. Vigna.
+    ///
+    /// \c xoshiro256ss has 256 bits of state, a period of 2^256-1, and
+    /// produces 64-bit words with a handful of shifts, rotations and
+    /// multiplications. It is several times faster than the Mersenne Twister,
+    /// and its small state makes reseeding it, as \c quick_check::_seed does
+    /// before each test case, cheap. See http://prng.di.unimi.it/.
+    ///
+    /// \c xoshiro256ss models the UniformRandomNumberGenerator concept and can
+    /// be passed to \c make_config with \c quick_check::_rng. Its \c fill
+    /// member writes a block of words at once, and generators like
+    /// \c quick_check::uniform\<\> use it when generating values in bulk.
+    ///
+    /// \em Example:
+    ///
+    /*! \code
+        auto config = make_config(_1 = uniform<int>(), _rng = xoshiro256ss(42));
+        \endcode
+    */
+    struct xoshiro256ss
+    {
+        typedef boost::uint64_t result_type;
+
+        static bool const has_fixed_range = false;
+
+        /// The seed of a default-constructed engine
+        static result_type const default_seed = 0u;
+
+        /// \brief Construct an engine seeded with \c default_seed
+        xoshiro256ss()
+        {
+            this->seed();
+        }
+
+        /// \brief Construct an engine from a single integral seed
+        explicit xoshiro256ss(result_type value)
+        {
+            this->seed(value);
+        }
+
+        /// \brief Construct an engine seeded from a SeedSeq
+        template<typename SeedSeq>
+        explicit xoshiro256ss(SeedSeq &seq,
+            typename boost::disable_if<boost::is_arithmetic<SeedSeq> >::type * = 0)
+        {
+            this->seed(seq);
+        }
+
+        /// \brief Reseed the engine with \c default_seed
+        void seed()
+        {
+            this->seed(default_seed);
+        }
+
+        /// \brief Reseed the engine from a single integral seed
+        ///
+        /// The 256 bits of state are the outputs of the SplitMix64
+        /// generator seeded with \c value, as the authors recommend.
+        void seed(result_type value)
+        {
+            for(boost::uint64_t &s : this->s_)
+                s = detail::mix64(value += 0x9E3779B97F4A7C15ull);
+        }
+
+        /// \brief Reseed the engine from eight 32-bit words of a SeedSeq
+        template<typename SeedSeq>
+        typename boost::disable_if<boost::is_arithmetic<SeedSeq> >::type seed(SeedSeq &seq)
+        {
+            boost::uint32_t words[8];
+            seq.generate(words, words + 8);
+            for(std::size_t i = 0; i < 4; ++i)
+                this->s_[i] = boost::uint64_t(words[2 * i]) | boost::uint64_t(words[2 * i + 1]) << 32;
+            // The all-zero state is a fixed point.
+            if((this->s_[0] | this->s_[1] | this->s_[2] | this->s_[3]) == 0)
+                this->s_[0] = 1;
+        }
+
+        static BOOST_CONSTEXPR result_type min BOOST_PREVENT_MACRO_SUBSTITUTION ()
+        {
+            return 0u;
+        }
+
+        static BOOST_CONSTEXPR result_type max BOOST_PREVENT_MACRO_SUBSTITUTION ()
+        {
+            return ~result_type(0u);
+        }
+
+        /// \brief Return the next random word
+        result_type operator()()
+        {
+            result_type const res = detail::rotl64(this->s_[1] * 5, 7) * 9;
+            boost::uint64_t const t = this->s_[1] << 17;
+            this->s_[2] ^= this->s_[0];
+            this->s_[3] ^= this->s_[1];
+            this->s_[1] ^= this->s_[2];
+            this->s_[0] ^= this->s_[3];
+            this->s_[2] ^= t;
+            this->s_[3] = detail::rotl64(this->s_[3], 45);
+            return res;
+        }
+
+        /// \brief Write the next \c n random words to \c out
+        ///
+        /// Equivalent to \c n calls to \c operator(), with the state kept in
+        /// registers for the length of the block.
+        void fill(boost::uint64_t *out, std::size_t n)
+        {
+            boost::uint64_t s0 = this->s_[0], s1 = this->s_[1], s2 = this->s_[2], s3 = this->s_[3];
+            for(std::size_t i = 0; i < n; ++i)
+            {
+                out[i] = detail::rotl64(s1 * 5, 7) * 9;
+                boost::uint64_t const t = s1 << 17;
+                s2 ^= s0;
+                s3 ^= s1;
+                s1 ^= s2;
+                s0 ^= s3;
+                s2 ^= t;
+                s3 = detail::rotl64(s3, 45);
+            }
+            this->s_[0] = s0;
+            this->s_[1] = s1;
+            this->s_[2] = s2;
+            this->s_[3] = s3;
+        }
+
+        /// \brief Advance the engine by \c z steps
+        void discard(boost::uintmax_t z)
+        {
+            for(; z != 0; --z)
+                (*this)();
+        }
+
+        friend bool operator==(xoshiro256ss const &left, xoshiro256ss const &right)
+        {
+            return left.s_[0] == right.s_[0] && left.s_[1] == right.s_[1] &&
+                   left.s_[2] == right.s_[2] && left.s_[3] == right.s_[3];
+        }
+
+        friend bool operator!=(xoshiro256ss const &left, xoshiro256ss const &right)
+        {
+            return !(left == right);
+        }
+
+    private:
+        boost::uint64_t s_[4];
+    };
+}
+
+QCHK_BOOST_NAMESPACE_END
+
+#endif
@@ -0,0 +1,165 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file size_schedule.hpp
+/// \brief Definition of \c quick_check::size_schedule, which says how big the sequences generated
+///        for each test case should be.
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QCHK_SIZE_SCHEDULE_HPP_INCLUDED
+#define QCHK_SIZE_SCHEDULE_HPP_INCLUDED
+
+#include <cmath>
+#include <cstddef>
+#include <algorithm>
+#include <functional>
+#include <boost/assert.hpp>
+#include <boost/quick_check/quick_check_fwd.hpp>
+
+QCHK_BOOST_NAMESPACE_BEGIN
+
+namespace quick_check
+{
+    /// \brief Says which size the generators are given for each test case.
+    ///
+    /// By default, every test case is generated with the size specified with
+    /// \c quick_check::_sized. A \c size_schedule made by \c linear_sizes() or
+    /// \c geometric_sizes(), or from a function of your own, makes the size a
+    /// function of the index of the test case instead, so that most test
+    /// cases can be small and cheap while some are large. The sizes ramp up
+    /// over \c length() test cases, then start again. A \c length() of 0
+    /// means the \c _test_count of the config the schedule is given to.
+    ///
+    /// Since the size is a function of the index of the test case alone,
+    /// \c config::operator()(std::size_t) regenerates a test case with the
+    /// size it was first generated with, and \c qcheck_parallel() runs each
+    /// test case with the size \c qcheck() would have.
+    ///
+    /// A \c size_schedule is specified with \c quick_check::_size_schedule.
+    /// The schedule that was used is returned by
+    /// \c qcheck_results::size_schedule().
+    ///
+    /// \sa \c quick_check::_size_schedule
+    struct size_schedule
+    {
+        /// The type of the functions that make up a schedule. They are called
+        /// with the position of a test case in the ramp, in
+        /// <tt>[0, length)</tt>, and the length of the ramp, and return the
+        /// size to generate it with.
+        typedef std::function<std::size_t(std::size_t, std::size_t)> function_type;
+
+        /// Default constructor
+        ///
+        /// \post <tt>!this->scheduled()</tt>
+        size_schedule()
+          : fun_()
+          , length_(0)
+        {}
+
+        /// Constructor
+        ///
+        /// \param fun The function that returns the size of each test case.
+        /// \param length The number of test cases over which the sizes ramp
+        ///               up, or 0 for the \c _test_count of the config.
+        explicit size_schedule(function_type const &fun, std::size_t length = 0)
+          : fun_(fun)
+          , length_(length)
+        {}
+
+        /// Returns true if the size depends on the test case, and false if
+        /// \c _sized is used throughout.
+        ///
+        /// \throw nothrow
+        bool scheduled() const
+        {
+            return !!this->fun_;
+        }
+
+        /// Returns the number of test cases over which the sizes ramp up
+        ///
+        /// \throw nothrow
+        std::size_t length() const
+        {
+            return this->length_;
+        }
+
+        /// Returns a copy of \c *this that ramps up over \c length test cases
+        /// if <tt>this->length()</tt> is 0, and \c *this otherwise.
+        size_schedule over(std::size_t length) const
+        {
+            return size_schedule(this->fun_, this->length_ == 0 ? length : this->length_);
+        }
+
+        /// Returns the size with which to generate the test case with index
+        /// \c case_index. It is at least 1.
+        ///
+        /// \pre <tt>this->scheduled()</tt>
+        std::size_t operator()(std::size_t case_index) const
+        {
+            BOOST_ASSERT(this->scheduled());
+            std::size_t const length = (std::max)(this->length_, std::size_t(1));
+            return (std::max)(this->fun_(case_index % length, length), std::size_t(1));
+        }
+
+    private:
+        function_type fun_;
+        std::size_t length_;
+    };
+
+    /// Returns a \c size_schedule that ramps the size up linearly, from
+    /// \c lo for the first test case to \c hi for the last, as QuickCheck
+    /// does.
+    ///
+    /// \param lo The smallest size.
+    /// \param hi The largest size.
+    /// \param length The number of test cases over which the sizes ramp up,
+    ///               or 0 for the \c _test_count of the config.
+    ///
+    /// \pre <tt>lo <= hi</tt>
+    inline size_schedule linear_sizes(std::size_t lo, std::size_t hi, std::size_t length = 0)
+    {
+        return size_schedule(
+            [lo, hi](std::size_t i, std::size_t length) -> std::size_t
+            {
+                double const t = length > 1 ? double(i) / double(length - 1) : 1.;
+                return lo + static_cast<std::size_t>(
+                    std::floor((double(hi) - double(lo)) * t + .5));
+            }
+          , length
+        );
+    }
+
+    /// Returns a \c size_schedule that ramps the size up geometrically, from
+    /// \c lo for the first test case to \c hi for the last, so that most test
+    /// cases are small, and a tail of them is large.
+    ///
+    /// \param lo The smallest size. If it is 0, 1 is used instead.
+    /// \param hi The largest size.
+    /// \param length The number of test cases over which the sizes ramp up,
+    ///               or 0 for the \c _test_count of the config.
+    ///
+    /// \pre <tt>lo <= hi</tt>
+    inline size_schedule geometric_sizes(std::size_t lo, std::size_t hi, std::size_t length = 0)
+    {
+        lo = (std::max)(lo, std::size_t(1));
+        return size_schedule(
+            [lo, hi](std::size_t i, std::size_t length) -> std::size_t
+            {
+                double const t = length > 1 ? double(i) / double(length - 1) : 1.;
+                return static_cast<std::size_t>(
+                    std::floor(double(lo) * std::pow(double(hi) / double(lo), t) + .5));
+            }
+          , length
+        );
+    }
+}
+
+QCHK_BOOST_NAMESPACE_END
+
+#endif
@@ -0,0 +1,582 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file static_property.hpp
+/// \brief Definition of the \c quick_check::static_property\<\> and
+///        \c quick_check::property_ref\<\> class templates.
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QCHK_STATIC_PROPERTY_HPP_INCLUDED
+#define QCHK_STATIC_PROPERTY_HPP_INCLUDED
+
+#include <new>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <type_traits>
+#include <boost/assert.hpp>
+#include <boost/utility/enable_if.hpp>
+#include <boost/utility/result_of.hpp>
+#include <boost/preprocessor/iteration/local.hpp>
+#include <boost/preprocessor/repetition/enum_params.hpp>
+#include <boost/preprocessor/repetition/enum_binary_params.hpp>
+#include <boost/preprocessor/punctuation/comma.hpp>
+#include <boost/fusion/functional/invocation/invoke_function_object.hpp>
+#include <boost/quick_check/quick_check_fwd.hpp>
+#include <boost/quick_check/qcheck.hpp>
+#include <boost/quick_check/property.hpp>
+#include <boost/quick_check/detail/block.hpp>
+#include <boost/quick_check/detail/evaluate.hpp>
+
+/// \brief The number of bytes of storage that a \c quick_check::static_property\<\>
+/// reserves for its property expression.
+///
+/// Property expressions that fit, which is most of them, are stored inside
+/// the \c static_property\<\> object. Bigger ones are stored on the heap.
+/// The default value is 256.
+#ifndef QCHK_STATIC_PROPERTY_BUFFER_SIZE
+#define QCHK_STATIC_PROPERTY_BUFFER_SIZE 256
+#endif
+
+QCHK_BOOST_NAMESPACE_BEGIN
+
+namespace quick_check
+{
+    namespace detail
+    {
+        // Everything qcheck() and qcheck_batched() do with a property
+        // expression, behind one vtable. The block functions evaluate a
+        // whole block of test cases with a single virtual call, inside which
+        // the expression is inlined.
+        template<typename Args, typename Group>
+        struct property_holder_base
+        {
+            typedef typename block_columns<Args>::type columns_type;
+
+            virtual ~property_holder_base()
+            {}
+
+            // Copy this into buffer if it fits there, and onto the heap if not.
+            virtual property_holder_base *clone(void *buffer, std::size_t size) const = 0;
+            virtual bool call(Args const &args) const = 0;
+            virtual bool condition(Args const &args) const = 0;
+            virtual class_mask mask(Args const &args) const = 0;
+            virtual void names(std::vector<std::string> &out) const = 0;
+            virtual Group group(Args const &args) const = 0;
+            virtual bool evaluate(Args const &args, case_outcome<Group> &out) const = 0;
+            virtual void eval_condition_block(columns_type const &columns, std::size_t count,
+                                              bool *out) const = 0;
+            virtual void eval_property_block(columns_type const &columns,
+                                             std::size_t const *lanes, std::size_t count,
+                                             bool *out) const = 0;
+        };
+
+        template<typename Evaluator, typename Args, typename Group>
+        struct property_holder
+          : property_holder_base<Args, Group>
+        {
+            typedef typename block_columns<Args>::type columns_type;
+
+            explicit property_holder(Evaluator const &eval)
+              : eval_(eval)
+            {}
+
+            static property_holder_base<Args, Group> *
+            create(Evaluator const &eval, void *buffer, std::size_t size)
+            {
+                if(sizeof(property_holder) <= size &&
+                   std::alignment_of<property_holder>::value <=
+                       std::alignment_of<std::max_align_t>::value)
+                    return ::new(buffer) property_holder(eval);
+                return new property_holder(eval);
+            }
+
+            property_holder_base<Args, Group> *clone(void *buffer, std::size_t size) const
+            {
+                return property_holder::create(this->eval_, buffer, size);
+            }
+
+            bool call(Args const &args) const
+            {
+                return detail::call_property(this->eval_.property(), args);
+            }
+
+            bool condition(Args const &args) const
+            {
+                return static_cast<bool>(this->eval_.condition()(args));
+            }
+
+            class_mask mask(Args const &args) const
+            {
+                return this->eval_.classifier().mask(args);
+            }
+
+            void names(std::vector<std::string> &out) const
+            {
+                this->eval_.classifier().names(out);
+            }
+
+            Group group(Args const &args) const
+            {
+                return this->eval_.grouper()(args);
+            }
+
+            bool evaluate(Args const &args, case_outcome<Group> &out) const
+            {
+                return this->eval_(args, out);
+            }
+
+            void eval_condition_block(columns_type const &columns, std::size_t count,
+                                      bool *out) const
+            {
+                detail::eval_block(this->eval_.condition(), columns, count, out);
+            }
+
+            void eval_property_block(columns_type const &columns, std::size_t const *lanes,
+                                     std::size_t count, bool *out) const
+            {
+                typedef
+                    typename std::decay<decltype(this->eval_.property())>::type
+                property_type;
+                detail::invoke_property<property_type> const fun(this->eval_.property());
+                if(lanes)
+                    detail::eval_block(fun, columns, lanes, count, out);
+                else
+                    detail::eval_block(fun, columns, count, out);
+            }
+
+        private:
+            Evaluator eval_;
+        };
+
+        // The parts of a property_view<>, as returned by get_condition(),
+        // get_classifier(), get_grouper() and get_evaluator(). Each is a
+        // pointer to the holder of the whole property.
+        template<typename Args, typename Group>
+        struct view_condition
+        {
+            typedef bool result_type;
+
+            explicit view_condition(property_holder_base<Args, Group> const *holder)
+              : holder_(holder)
+            {}
+
+            bool operator()(Args const &args) const
+            {
+                return this->holder_->condition(args);
+            }
+
+            void eval_block(typename block_columns<Args>::type const &columns, std::size_t count,
+                            bool *out) const
+            {
+                this->holder_->eval_condition_block(columns, count, out);
+            }
+
+        private:
+            property_holder_base<Args, Group> const *holder_;
+        };
+
+        template<typename Args, typename Group>
+        struct view_classifier
+        {
+            typedef std::vector<std::string> result_type;
+
+            explicit view_classifier(property_holder_base<Args, Group> const *holder)
+              : holder_(holder)
+            {}
+
+            result_type operator()(Args const &args) const
+            {
+                std::vector<std::string> names;
+                this->holder_->names(names);
+                return detail::class_names(names, this->holder_->mask(args));
+            }
+
+            class_mask mask(Args const &args) const
+            {
+                return this->holder_->mask(args);
+            }
+
+            void names(std::vector<std::string> &out) const
+            {
+                this->holder_->names(out);
+            }
+
+        private:
+            property_holder_base<Args, Group> const *holder_;
+        };
+
+        template<typename Args, typename Group>
+        struct view_grouper
+        {
+            typedef Group result_type;
+
+            explicit view_grouper(property_holder_base<Args, Group> const *holder)
+              : holder_(holder)
+            {}
+
+            Group operator()(Args const &args) const
+            {
+                return this->holder_->group(args);
+            }
+
+        private:
+            property_holder_base<Args, Group> const *holder_;
+        };
+
+        template<typename Args, typename Group>
+        struct view_evaluator
+        {
+            explicit view_evaluator(property_holder_base<Args, Group> const *holder)
+              : holder_(holder)
+            {}
+
+            bool operator()(Args const &args, case_outcome<Group> &out) const
+            {
+                return this->holder_->evaluate(args, out);
+            }
+
+        private:
+            property_holder_base<Args, Group> const *holder_;
+        };
+
+        // What static_property<> and property_ref<> have in common: a pointer
+        // to the holder of a property expression.
+        template<typename Args, typename Group>
+        struct property_view
+        {
+            typedef Args args_type;
+            typedef Group grouped_by_type;
+            typedef bool result_type;
+            typedef view_classifier<Args, Group> classifier_type;
+            typedef view_grouper<Args, Group> grouper_type;
+            typedef view_condition<Args, Group> condition_type;
+            typedef view_evaluator<Args, Group> evaluator_type;
+
+        #if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+            template<typename ...Ts>
+            bool operator()(Ts const &... ts) const
+            {
+                BOOST_ASSERT(this->holder_);
+                return this->holder_->call(Args(ts...));
+            }
+        #else
+            bool operator()() const
+            {
+                BOOST_ASSERT(this->holder_);
+                return this->holder_->call(Args());
+            }
+
+            /// INTERNAL ONLY
+        #define BOOST_PP_LOCAL_MACRO(N)                                                             \
+            template<BOOST_PP_ENUM_PARAMS(N, typename T)>                                           \
+            bool operator()(BOOST_PP_ENUM_BINARY_PARAMS(N, T, const &t)) const                      \
+            {                                                                                       \
+                BOOST_ASSERT(this->holder_);                                                        \
+                return this->holder_->call(Args(BOOST_PP_ENUM_PARAMS(N, t)));                       \
+            }                                                                                       \
+            /**/
+
+            /// INTERNAL ONLY
+        #define BOOST_PP_LOCAL_LIMITS (1, QCHK_MAX_ARITY)
+        #include BOOST_PP_LOCAL_ITERATE()
+        #endif
+
+            classifier_type classifier() const
+            {
+                BOOST_ASSERT(this->holder_);
+                return classifier_type(this->holder_);
+            }
+
+            grouper_type grouper() const
+            {
+                BOOST_ASSERT(this->holder_);
+                return grouper_type(this->holder_);
+            }
+
+            condition_type condition() const
+            {
+                BOOST_ASSERT(this->holder_);
+                return condition_type(this->holder_);
+            }
+
+            evaluator_type evaluator() const
+            {
+                BOOST_ASSERT(this->holder_);
+                return evaluator_type(this->holder_);
+            }
+
+            // Evaluate the property on the lanes of a block listed in lanes,
+            // or on lanes [0, count) if lanes is null.
+            void eval_block(typename block_columns<Args>::type const &columns,
+                            std::size_t const *lanes, std::size_t count, bool *out) const
+            {
+                BOOST_ASSERT(this->holder_);
+                this->holder_->eval_property_block(columns, lanes, count, out);
+            }
+
+        protected:
+            property_view()
+              : holder_(0)
+            {}
+
+            property_holder_base<Args, Group> const *holder_;
+        };
+
+        template<typename Traits>
+        struct property_view_of
+        {
+            typedef
+                property_view<typename Traits::args_type, typename Traits::grouped_by_type>
+            type;
+        };
+    }
+
+#if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) || defined(QCHK_DOXYGEN_INVOKED)
+    /// \brief A holder for quickCheckCpp properties that evaluates a whole
+    ///        block of test cases with one virtual call.
+    ///
+    /// \tparam As As for \c property\<\>.
+    ///
+    /// \c static_property\<\> can be used wherever \c property\<\> can. Where
+    /// \c property\<\> stores the parts of a property expression, its
+    /// condition, classifiers, grouper and the property itself, in four
+    /// separate \c boost::function objects, \c static_property\<\> stores the
+    /// whole expression in one object, behind one virtual function table.
+    /// Expressions no bigger than \c QCHK_STATIC_PROPERTY_BUFFER_SIZE bytes are
+    /// stored inside the \c static_property\<\> itself, rather than on the heap.
+    ///
+    /// Evaluating a test case with \c qcheck() costs one virtual call.
+    /// Evaluating a block of test cases with \c qcheck_batched() costs one
+    /// virtual call for the condition and one for the property, whatever the
+    /// size of the block; the loop over the block is compiled together with
+    /// the expression, as it is when \c qcheck_batched() is given the
+    /// expression itself. This requires that the config's \c result_type is
+    /// \c args_type. If it is not, the test cases are evaluated one at a time.
+    ///
+    /// Use \c property_ref\<\> to pass a \c static_property\<\> around without
+    /// copying it.
+    ///
+    /// \em Example:
+    ///
+    /*! \code
+        uniform<int> di(1,6);
+        normal<double> dd(0.0, 1.0);
+        auto config = make_config(_1 = di, _2 = dd);
+
+        static_property<int, double>
+            is_reflexive =
+                classify(_2>0.,"foo")
+              | classify(_2<=0.,"bar")
+              | ((_1 + _2) == (_2 + _1)) ;
+
+        qcheck_batched(is_reflexive, config).print_summary();
+        \endcode
+    */
+    template<typename ...As>
+    struct static_property
+      : detail::property_view_of<detail::property_traits<As...> >::type
+    {
+    private:
+        typedef detail::property_traits<As...> property_traits_type;
+#else
+    template<BOOST_PP_ENUM_PARAMS(QCHK_MAX_ARITY, typename A)>
+    struct static_property
+      : detail::property_view_of<
+            detail::property_traits<BOOST_PP_ENUM_PARAMS(QCHK_MAX_ARITY, A)>
+        >::type
+    {
+    private:
+        typedef
+            detail::property_traits<BOOST_PP_ENUM_PARAMS(QCHK_MAX_ARITY, A)>
+        property_traits_type;
+#endif
+        typedef typename detail::property_view_of<property_traits_type>::type view_type;
+        typedef
+            detail::property_holder_base<
+                typename property_traits_type::args_type
+              , typename property_traits_type::grouped_by_type
+            >
+        holder_type;
+
+    public:
+        /// As for \c property\<\>
+        typedef
+            QCHK_DOXY_DETAIL(typename property_traits_type::args_type)
+        args_type;
+
+        /// As for \c property\<\>
+        typedef
+            QCHK_DOXY_DETAIL(typename property_traits_type::grouped_by_type)
+        grouped_by_type;
+
+        /// Default-construct an empty property
+        static_property()
+          : view_type()
+          , buffer_()
+        {}
+
+        /// Initialize a \c static_property<> object with a property expression.
+        ///
+        /// \note This constructor does not participate in overload resolution if
+        /// \c Expr is not the type of a valid property expression.
+        template<typename Expr>
+        static_property(
+            Expr const &expr
+            QCHK_DOXY_HIDDEN(BOOST_PP_COMMA()
+                             typename boost::enable_if<proto::is_expr<Expr> >::type* = 0)
+        )
+          : view_type()
+          , buffer_()
+        {
+            typedef
+                typename boost::result_of<detail::GetEvaluator(Expr const &)>::type
+            evaluator_type;
+            this->holder_ =
+                detail::property_holder<evaluator_type, args_type, grouped_by_type>::create(
+                    detail::get_evaluator(expr)
+                  , &this->buffer_
+                  , sizeof(this->buffer_)
+                );
+        }
+
+        /// Copy a \c static_property<> object
+        static_property(static_property const &that)
+          : view_type()
+          , buffer_()
+        {
+            if(that.holder_)
+                this->holder_ = that.holder_->clone(&this->buffer_, sizeof(this->buffer_));
+        }
+
+        /// Replace the property expression with a copy of \c that's
+        static_property &operator=(static_property const &that)
+        {
+            if(this != &that)
+            {
+                this->reset_();
+                if(that.holder_)
+                    this->holder_ = that.holder_->clone(&this->buffer_, sizeof(this->buffer_));
+            }
+            return *this;
+        }
+
+        ~static_property()
+        {
+            this->reset_();
+        }
+
+        /// \return True if the property expression is stored inside this
+        /// object, false if it is stored on the heap or if this object is
+        /// empty.
+        bool is_stored_inline() const
+        {
+            return this->holder_ &&
+                   static_cast<void const *>(this->holder_) ==
+                       static_cast<void const *>(&this->buffer_);
+        }
+
+#ifdef QCHK_DOXYGEN_INVOKED
+        /// Evaluate this property with the specified arguments.
+        bool operator()(As const &... as) const { return true; }
+
+        /// As \c property::classifier()
+        classifier_type classifier() const;
+
+        /// As \c property::grouper()
+        grouper_type grouper() const;
+
+        /// As \c property::condition()
+        condition_type condition() const;
+#endif
+
+    private:
+        void reset_()
+        {
+            if(this->is_stored_inline())
+                this->holder_->~holder_type();
+            else
+                delete this->holder_;
+            this->holder_ = 0;
+        }
+
+        typename std::aligned_storage<
+            QCHK_STATIC_PROPERTY_BUFFER_SIZE
+          , std::alignment_of<std::max_align_t>::value
+        >::type buffer_;
+    };
+
+#if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) || defined(QCHK_DOXYGEN_INVOKED)
+    /// \brief A non-owning reference to a \c static_property\<\>.
+    ///
+    /// \tparam As As for \c static_property\<\>.
+    ///
+    /// \c property_ref\<\> is the size of a pointer and is trivially
+    /// copyable, so it can be passed by value where a \c static_property\<\>
+    /// would be expensive to copy. It can be used wherever the
+    /// \c static_property\<\> to which it refers can, as long as that
+    /// \c static_property\<\> lives.
+    ///
+    /// \em Example:
+    ///
+    /*! \code
+        bool check(property_ref<int, double> prop)
+        {
+            uniform<int> di(1,6);
+            normal<double> dd(0.0, 1.0);
+            auto config = make_config(_1 = di, _2 = dd);
+            return qcheck(prop, config).success();
+        }
+
+        static_property<int, double> is_reflexive = ((_1 + _2) == (_2 + _1));
+        check(is_reflexive);
+        \endcode
+    */
+    template<typename ...As>
+    struct property_ref
+      : detail::property_view_of<detail::property_traits<As...> >::type
+    {
+    private:
+        typedef detail::property_traits<As...> property_traits_type;
+#else
+    template<BOOST_PP_ENUM_PARAMS(QCHK_MAX_ARITY, typename A)>
+    struct property_ref
+      : detail::property_view_of<
+            detail::property_traits<BOOST_PP_ENUM_PARAMS(QCHK_MAX_ARITY, A)>
+        >::type
+    {
+    private:
+        typedef
+            detail::property_traits<BOOST_PP_ENUM_PARAMS(QCHK_MAX_ARITY, A)>
+        property_traits_type;
+#endif
+        typedef typename detail::property_view_of<property_traits_type>::type view_type;
+
+    public:
+        /// As for \c property\<\>
+        typedef
+            QCHK_DOXY_DETAIL(typename property_traits_type::args_type)
+        args_type;
+
+        /// As for \c property\<\>
+        typedef
+            QCHK_DOXY_DETAIL(typename property_traits_type::grouped_by_type)
+        grouped_by_type;
+
+        /// Refer to \c prop, which is usually a \c static_property\<\> with
+        /// the same template arguments.
+        property_ref(QCHK_DOXY_DETAIL(view_type) const &prop)
+          : view_type(prop)
+        {}
+    };
+}
+
+QCHK_BOOST_NAMESPACE_END
+
+#endif
@@ -0,0 +1,124 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file batch.cpp
+/// \brief Compares qcheck() with qcheck_batched(), and row-wise with column-wise evaluation
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+#include <boost/quick_check/quick_check.hpp>
+#include "./bench.hpp"
+
+namespace qchk = boost::quick_check;
+
+static std::size_t const block_size = 1024;
+
+// Run the property with both algorithms on configs made from make.
+template<typename Property, typename MakeConfig>
+void bench_qcheck(bench::reporter &rep, std::string const &name, Property const &prop,
+                  MakeConfig make)
+{
+    rep.run("qcheck: " + name, [&] {
+        auto config = make();
+        rep.expect(qchk::qcheck(prop, config).success(), name);
+    });
+    rep.run("qcheck_batched: " + name, [&] {
+        auto config = make();
+        rep.expect(qchk::qcheck_batched(prop, config, block_size).success(), name);
+    });
+}
+
+// Time the evaluation alone of the property on a block of pre-generated
+// test cases, one set of arguments at a time and column-wise.
+template<typename Property, typename MakeConfig>
+void bench_eval(bench::reporter &rep, std::string const &name, Property const &prop,
+                MakeConfig make)
+{
+    typedef typename decltype(make())::result_type args_type;
+    typedef typename decltype(make())::columns_type columns_type;
+
+    auto config = make();
+    columns_type columns;
+    config.generate(columns, block_size);
+    auto const data =
+        boost::fusion::as_vector(boost::fusion::transform(columns, qchk::detail::column_data()));
+
+    std::vector<args_type> rows;
+    for(std::size_t i = 0; i < block_size; ++i)
+        rows.push_back(args_type(boost::fusion::transform_view<decltype(data) const,
+                                 qchk::detail::lane_at>(data, qchk::detail::lane_at(i))));
+
+    std::size_t const blocks = (rep.cases() + block_size - 1) / block_size;
+    std::size_t row_passed = 0, block_passed = 0;
+    std::unique_ptr<bool[]> passed(new bool[block_size]);
+
+    rep.run("eval by row: " + name, blocks * block_size, [&] {
+        for(std::size_t b = 0; b < blocks; ++b)
+        {
+            for(std::size_t i = 0; i < block_size; ++i)
+                passed[i] = static_cast<bool>(boost::fusion::invoke_function_object(prop, rows[i]));
+            row_passed += std::count(passed.get(), passed.get() + block_size, true);
+        }
+    });
+
+    qchk::detail::invoke_property<Property> const fun(prop);
+    rep.run("eval by column: " + name, blocks * block_size, [&] {
+        for(std::size_t b = 0; b < blocks; ++b)
+        {
+            qchk::detail::eval_block(fun, data, block_size, passed.get());
+            block_passed += std::count(passed.get(), passed.get() + block_size, true);
+        }
+    });
+
+    rep.expect(row_passed == block_passed, name);
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace qchk;
+    bench::reporter rep("batch", argc, argv);
+    std::size_t const test_count = rep.cases();
+
+    uniform<int> di(-1000000, 1000000);
+    normal<double> dd(0., 1000.);
+
+    auto make_int_config = [&]
+    {
+        return make_config(_1 = di, _2 = di, _test_count = test_count, _max_shrinks = 0u);
+    };
+    auto make_double_config = [&]
+    {
+        return make_config(_1 = dd, _2 = dd, _test_count = test_count, _max_shrinks = 0u);
+    };
+
+    bench_qcheck(rep, "uniform<int>: (_1+_2)==(_2+_1)",
+                 (_1 + _2) == (_2 + _1), make_int_config);
+    bench_qcheck(rep, "uniform<int>: _1*2-_2==_1+(_1-_2)",
+                 _1 * 2 - _2 == _1 + (_1 - _2), make_int_config);
+    bench_qcheck(rep, "normal<double>: (_1+_2)==(_2+_1)",
+                 (_1 + _2) == (_2 + _1), make_double_config);
+    bench_qcheck(rep, "normal<double>: _1*_1+_2*_2>=0",
+                 _1 * _1 + _2 * _2 >= 0., make_double_config);
+    bench_qcheck(rep, "normal<double>: _1>=0 ==> ...",
+                 _1 >= 0. >>= (_1 * _2 <= _1 * (_2 + 1.)), make_double_config);
+
+    bench_eval(rep, "uniform<int>: (_1+_2)==(_2+_1)",
+               (_1 + _2) == (_2 + _1), make_int_config);
+    bench_eval(rep, "uniform<int>: _1*2-_2==_1+(_1-_2)",
+               _1 * 2 - _2 == _1 + (_1 - _2), make_int_config);
+    bench_eval(rep, "normal<double>: (_1+_2)==(_2+_1)",
+               (_1 + _2) == (_2 + _1), make_double_config);
+    bench_eval(rep, "normal<double>: _1*_1+_2*_2>=0",
+               _1 * _1 + _2 * _2 >= 0., make_double_config);
+
+    return rep.finish();
+}
@@ -0,0 +1,199 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file bench.hpp
+/// \brief A small harness that times the QuickCheckCpp benchmarks and reports
+///        nanoseconds per test case as text, CSV or JSON
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QCHK_BENCH_BENCH_HPP_INCLUDED
+#define QCHK_BENCH_BENCH_HPP_INCLUDED
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace bench
+{
+    typedef std::chrono::steady_clock clock_type;
+
+    /// Keep the computation of \c value from being optimized away.
+    template<typename T>
+    inline void keep(T const &value)
+    {
+#if defined(__GNUC__)
+        asm volatile("" : : "g"(&value) : "memory");
+#else
+        static void const *volatile sink;
+        sink = &value;
+#endif
+    }
+
+    enum format
+    {
+        text
+      , csv
+      , json
+    };
+
+    /// Times the benchmarks of one suite and prints their results when it is
+    /// finished. Every benchmark program takes the same command line:
+    ///
+    ///     bench_xxx [--text|--csv|--json] [cases] [repeats]
+    ///
+    /// where \c cases is the number of test cases each benchmark runs, and
+    /// each benchmark is timed \c repeats times and the fastest time kept.
+    struct reporter
+    {
+        reporter(char const *suite, int argc, char *argv[])
+          : suite_(suite)
+          , format_(text)
+          , cases_(100000u)
+          , repeats_(3u)
+          , failed_(false)
+          , results_()
+        {
+            std::size_t positional = 0;
+            for(int i = 1; i < argc; ++i)
+            {
+                if(0 == std::strcmp(argv[i], "--text"))
+                    this->format_ = text;
+                else if(0 == std::strcmp(argv[i], "--csv"))
+                    this->format_ = csv;
+                else if(0 == std::strcmp(argv[i], "--json"))
+                    this->format_ = json;
+                else if(positional++ == 0)
+                    this->cases_ = std::strtoul(argv[i], 0, 10);
+                else
+                    this->repeats_ = std::strtoul(argv[i], 0, 10);
+            }
+            if(this->repeats_ == 0)
+                this->repeats_ = 1;
+        }
+
+        /// The number of test cases each benchmark should run
+        std::size_t cases() const
+        {
+            return this->cases_;
+        }
+
+        /// Time \c fun, which runs \c cases test cases, and record the
+        /// fastest of \c repeats runs under \c name.
+        template<typename Fun>
+        void run(std::string const &name, std::size_t cases, Fun fun)
+        {
+            double best = (std::numeric_limits<double>::max)();
+            for(std::size_t i = 0; i < this->repeats_; ++i)
+            {
+                clock_type::time_point const start = clock_type::now();
+                fun();
+                double const elapsed =
+                    std::chrono::duration<double, std::nano>(clock_type::now() - start).count();
+                best = (std::min)(best, elapsed);
+            }
+            result const res = {name, cases, cases == 0 ? 0. : best / cases};
+            this->results_.push_back(res);
+        }
+
+        /// \overload
+        template<typename Fun>
+        void run(std::string const &name, Fun fun)
+        {
+            this->run(name, this->cases_, fun);
+        }
+
+        /// Note that a benchmark computed a wrong answer.
+        void expect(bool ok, std::string const &name)
+        {
+            if(!ok)
+            {
+                std::cerr << this->suite_ << ": " << name << " failed\n";
+                this->failed_ = true;
+            }
+        }
+
+        /// Print the results. Returns the program's exit code.
+        int finish(std::ostream &sout = std::cout) const
+        {
+            switch(this->format_)
+            {
+            case csv:
+                sout << "suite,name,cases,ns_per_case\n";
+                for(result const &res : this->results_)
+                {
+                    sout << this->suite_ << ",\"";
+                    escape(sout, res.name, '"');
+                    sout << "\"," << res.cases << ","
+                         << std::fixed << std::setprecision(3) << res.ns_per_case << "\n";
+                }
+                break;
+            case json:
+                sout << "{\"suite\": \"" << this->suite_ << "\", \"results\": [";
+                for(std::size_t i = 0; i < this->results_.size(); ++i)
+                {
+                    result const &res = this->results_[i];
+                    sout << (i == 0 ? "\n" : ",\n") << "  {\"name\": \"";
+                    escape(sout, res.name, '\\');
+                    sout << "\", \"cases\": " << res.cases << ", \"ns_per_case\": "
+                         << std::fixed << std::setprecision(3) << res.ns_per_case << "}";
+                }
+                sout << "\n]}\n";
+                break;
+            default:
+            {
+                std::size_t width = 0;
+                for(result const &res : this->results_)
+                    width = (std::max)(width, res.name.size());
+                sout << this->suite_ << ": " << this->cases_ << " cases, best of "
+                     << this->repeats_ << "\n";
+                for(result const &res : this->results_)
+                    sout << "  " << std::left << std::setw(static_cast<int>(width)) << res.name
+                         << std::right << std::fixed << std::setprecision(2) << std::setw(12)
+                         << res.ns_per_case << " ns/case\n";
+                break;
+            }
+            }
+            return this->failed_ ? 1 : 0;
+        }
+
+    private:
+        struct result
+        {
+            std::string name;
+            std::size_t cases;
+            double ns_per_case;
+        };
+
+        // Write str, preceding each double quote, and esc itself, with esc.
+        static void escape(std::ostream &sout, std::string const &str, char esc)
+        {
+            for(char ch : str)
+            {
+                if(ch == '"' || ch == esc)
+                    sout << esc;
+                sout << ch;
+            }
+        }
+
+        std::string suite_;
+        format format_;
+        std::size_t cases_;
+        std::size_t repeats_;
+        bool failed_;
+        std::vector<result> results_;
+    };
+}
+
+#endif
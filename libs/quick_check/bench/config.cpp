@@ -0,0 +1,82 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file config.cpp
+/// \brief Benchmarks of the generation of test cases by config<>
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <boost/quick_check/quick_check.hpp>
+#include "./bench.hpp"
+
+namespace qchk = boost::quick_check;
+
+// Time cases calls to config::operator()().
+template<typename Config>
+void bench_call(bench::reporter &rep, std::string const &name, Config config)
+{
+    rep.run(name, [&] {
+        for(std::size_t i = 0; i < rep.cases(); ++i)
+            bench::keep(config());
+    });
+}
+
+// Time cases calls to config::operator()(std::size_t), in order.
+template<typename Config>
+void bench_index(bench::reporter &rep, std::string const &name, Config config)
+{
+    rep.run(name, [&] {
+        for(std::size_t i = 0; i < rep.cases(); ++i)
+            bench::keep(config(i));
+    });
+}
+
+// Time config::generate() on blocks of 1024 test cases.
+template<typename Config>
+void bench_generate(bench::reporter &rep, std::string const &name, Config config)
+{
+    std::size_t const block_size = 1024;
+    typename Config::columns_type columns;
+    rep.run(name, [&] {
+        for(std::size_t n = 0; n < rep.cases(); n += block_size)
+        {
+            config.generate(columns, (std::min)(block_size, rep.cases() - n));
+            bench::keep(columns);
+        }
+    });
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace qchk;
+    bench::reporter rep("config", argc, argv);
+
+    uniform<int> di(1, 6);
+    normal<double> nd(0., 1.);
+    auto vi = vector(di);
+
+    bench_call(rep, "operator()(): _1=uniform<int>", make_config(_1 = di));
+    bench_call(rep, "operator()(): _1=uniform<int>, _2=normal<double>",
+               make_config(_1 = di, _2 = nd));
+    bench_call(rep, "operator()(): _1, _2, _3=vector(uniform<int>)",
+               make_config(_1 = di, _2 = nd, _3 = vi));
+    bench_call(rep, "operator()(): _1, _2, _seed",
+               make_config(_1 = di, _2 = nd, _seed = 42u));
+    bench_call(rep, "operator()(): _1, _2, _rng = xoshiro256ss",
+               make_config(_1 = di, _2 = nd, _rng = xoshiro256ss()));
+
+    bench_index(rep, "operator()(i): _1, _2", make_config(_1 = di, _2 = nd));
+    bench_index(rep, "operator()(i): _1, _2, _seed", make_config(_1 = di, _2 = nd, _seed = 42u));
+
+    bench_generate(rep, "generate(): _1, _2", make_config(_1 = di, _2 = nd));
+    bench_generate(rep, "generate(): _1, _2, _rng = xoshiro256ss",
+                   make_config(_1 = di, _2 = nd, _rng = xoshiro256ss()));
+
+    return rep.finish();
+}
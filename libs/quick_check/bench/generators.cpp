@@ -0,0 +1,110 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file generators.cpp
+/// \brief Benchmarks of each of the generators, one value and one block at a time
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdlib>
+#include <deque>
+#include <list>
+#include <string>
+#include <vector>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/quick_check/quick_check.hpp>
+#include "./bench.hpp"
+
+namespace qchk = boost::quick_check;
+
+// The size given to the sequence generators
+static std::size_t const sized = 16;
+
+struct S
+{
+    S(int i, double d)
+      : i_(i), d_(d)
+    {}
+
+    explicit S(int i)
+      : i_(i), d_(0.)
+    {}
+
+    int i_;
+    double d_;
+};
+
+// Time cases calls to gen.
+template<typename Gen>
+void bench_gen(bench::reporter &rep, std::string const &name, Gen gen)
+{
+    boost::random::mt11213b rng;
+    rep.run(name, [&] {
+        for(std::size_t i = 0; i < rep.cases(); ++i)
+            bench::keep(gen(rng));
+    });
+}
+
+// Time one call to generate_n for cases values.
+template<typename Gen>
+void bench_gen_n(bench::reporter &rep, std::string const &name, Gen gen)
+{
+    typedef typename Gen::result_type value_type;
+    boost::random::mt11213b rng;
+    std::vector<value_type> values(rep.cases());
+    rep.run(name, [&] {
+        qchk::generate_n(gen, rng, values.begin(), values.size());
+        bench::keep(values.back());
+    });
+}
+
+template<typename Gen>
+Gen sized_gen(Gen gen)
+{
+    qchk::detail::set_size_adl(gen, sized);
+    return gen;
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace qchk;
+    bench::reporter rep("generators", argc, argv);
+
+    uniform<int> di(-1000000, 1000000);
+    uniform<double> ud(-1000., 1000.);
+    normal<double> nd(0., 1.);
+    auto abs_di = transform(di, detail::make_unary([](int i) { return std::abs(i); }));
+
+    bench_gen(rep, "uniform<int>", di);
+    bench_gen(rep, "uniform<double>", ud);
+    bench_gen(rep, "uniform<int[3]>", uniform<int[3]>(-1000, 1000));
+    bench_gen(rep, "normal<double>", nd);
+    bench_gen(rep, "normal<double[3]>", normal<double[3]>(0., 1.));
+    bench_gen(rep, "alnum()", alnum());
+    bench_gen(rep, "print()", print());
+    bench_gen(rep, "constant(42)", constant(42));
+    bench_gen(rep, "transform(uniform<int>, abs)", abs_di);
+    bench_gen(rep, "zip(uniform<int>, normal<double>)", zip(di, nd));
+    bench_gen(rep, "class_<S>(uniform<int>, normal<double>)", class_<S>(di, nd));
+    bench_gen(rep, "class_<S>(ctor(i, d) % 50 | ctor(i) % 50)",
+              class_<S>(ctor(di, nd) % 50 | ctor(di) % 50));
+    bench_gen(rep, "string(alnum()), size 16", sized_gen(string(alnum())));
+    bench_gen(rep, "vector(uniform<int>), size 16", sized_gen(vector(di)));
+    bench_gen(rep, "ordered_vector(uniform<int>), size 16", sized_gen(ordered_vector(di)));
+    bench_gen(rep, "sequence<list<int>>(uniform<int>), size 16",
+              sized_gen(sequence<std::list<int> >(di)));
+    bench_gen(rep, "ordered_sequence<deque<int>>(uniform<int>), size 16",
+              sized_gen(ordered_sequence<std::deque<int> >(di)));
+
+    bench_gen_n(rep, "generate_n(uniform<int>)", di);
+    bench_gen_n(rep, "generate_n(uniform<double>)", ud);
+    bench_gen_n(rep, "generate_n(normal<double>)", nd);
+    bench_gen_n(rep, "generate_n(alnum())", alnum());
+
+    return rep.finish();
+}
@@ -0,0 +1,85 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file property.cpp
+/// \brief Compares the speed of property expressions, property<> and static_property<>
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <boost/quick_check/quick_check.hpp>
+#include "./bench.hpp"
+
+namespace qchk = boost::quick_check;
+
+static std::size_t const block_size = 1024;
+
+// Time qcheck and qcheck_batched on expr, held each way.
+template<typename Expr, typename MakeConfig>
+void bench_property(bench::reporter &rep, std::string const &name, Expr const &expr,
+                    MakeConfig make)
+{
+    typedef typename decltype(make())::result_type args_type;
+    typedef
+        typename boost::fusion::result_of::value_at_c<args_type, 0>::type
+    arg_type;
+
+    qchk::property<arg_type, arg_type> const prop = expr;
+    qchk::static_property<arg_type, arg_type> const static_prop = expr;
+    rep.expect(static_prop.is_stored_inline(), name);
+
+    auto run = [&](std::string const &held, auto const &p)
+    {
+        rep.run("qcheck: " + held + ": " + name, [&] {
+            auto config = make();
+            rep.expect(qchk::qcheck(p, config).success(), name);
+        });
+        rep.run("qcheck_batched: " + held + ": " + name, [&] {
+            auto config = make();
+            rep.expect(qchk::qcheck_batched(p, config, block_size).success(), name);
+        });
+    };
+    run("expression", expr);
+    run("property<>", prop);
+    run("static_property<>", static_prop);
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace qchk;
+    bench::reporter rep("property", argc, argv);
+    std::size_t const test_count = rep.cases();
+
+    uniform<int> di(-1000000, 1000000);
+    normal<double> dd(0., 1000.);
+
+    auto make_int_config = [&]
+    {
+        return make_config(_1 = di, _2 = di, _test_count = test_count, _max_shrinks = 0u);
+    };
+    auto make_double_config = [&]
+    {
+        return make_config(_1 = dd, _2 = dd, _test_count = test_count, _max_shrinks = 0u);
+    };
+
+    bench_property(rep, "uniform<int>: (_1+_2)==(_2+_1)",
+                   (_1 + _2) == (_2 + _1), make_int_config);
+    bench_property(rep, "uniform<int>: classify | _1*2-_2==_1+(_1-_2)",
+                   classify(_1 < 0, "negative") | (_1 * 2 - _2 == _1 + (_1 - _2)),
+                   make_int_config);
+    bench_property(rep, "normal<double>: _1>=0 ==> ...",
+                   _1 >= 0. >>= (_1 * _2 <= _1 * (_2 + 1.)), make_double_config);
+    bench_property(rep, "normal<double>: _1>=0 ==> classify | classify | ...",
+                   _1 >= 0. >>=
+                       classify(_2 < 0., "_2 negative")
+                     | classify(_1 > 1000., "_1 large")
+                     | (_1 * _1 + _2 * _2 >= 0.),
+                   make_double_config);
+
+    return rep.finish();
+}
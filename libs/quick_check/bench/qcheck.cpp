@@ -0,0 +1,147 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file qcheck.cpp
+/// \brief Benchmarks of qcheck() from end to end on the properties of the examples
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <cfloat>
+#include <string>
+#include <boost/phoenix/stl/container.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/quick_check/quick_check.hpp>
+#include "./bench.hpp"
+
+namespace qchk = boost::quick_check;
+
+namespace lazy
+{
+    // As in example/bind.cpp
+    struct is_reflexive_impl
+    {
+        typedef bool result_type;
+
+        template<typename A, typename B>
+        bool operator()(A a, B b) const
+        {
+            return (a + b) == (b + a);
+        }
+    };
+
+    boost::phoenix::function<is_reflexive_impl> const is_reflexive = is_reflexive_impl();
+
+    // As in example/condition.cpp
+    struct sqrt_impl
+    {
+        typedef double result_type;
+
+        double operator()(double d) const
+        {
+            return std::sqrt(d);
+        }
+    };
+
+    boost::phoenix::function<sqrt_impl> const sqrt = sqrt_impl();
+
+    struct abs_impl
+    {
+        typedef double result_type;
+
+        double operator()(double d) const
+        {
+            return std::abs(d);
+        }
+    };
+
+    boost::phoenix::function<abs_impl> const abs = abs_impl();
+}
+
+// Time qcheck() and qcheck_batched() on prop with configs made by make,
+// which run cases test cases. If must_pass, the property must hold.
+template<typename Property, typename MakeConfig>
+void bench_qcheck(bench::reporter &rep, std::string const &name, Property const &prop,
+                  MakeConfig make, bool must_pass = true)
+{
+    rep.run("qcheck: " + name, [&] {
+        auto config = make();
+        rep.expect(qchk::qcheck(prop, config).success() || !must_pass, name);
+    });
+    rep.run("qcheck_batched: " + name, [&] {
+        auto config = make();
+        rep.expect(qchk::qcheck_batched(prop, config).success() || !must_pass, name);
+    });
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace qchk;
+    bench::reporter rep("qcheck", argc, argv);
+    std::size_t const cases = rep.cases();
+
+    uniform<int> die(1, 6);
+    normal<double> one(0.0, 1.0);
+    auto make_die_one = [&] {
+        return make_config(_1 = die, _2 = one, _test_count = cases);
+    };
+
+    // example/simple.cpp
+    bench_qcheck(rep, "simple", (_1 + _2) == (_2 + _1), make_die_one);
+
+    // example/bind.cpp
+    bench_qcheck(rep, "bind", lazy::is_reflexive(_1, _2), make_die_one);
+
+    // example/classifiers.cpp
+    bench_qcheck(rep, "classifiers",
+        classify(_2 > 0, "positive")
+      | classify(_2 <= 0, "non-positive")
+      | ((_1 + _2) == (_2 + _1))
+      , make_die_one);
+
+    // example/group_by.cpp
+    bench_qcheck(rep, "group_by",
+        group_by(_1 % 3)
+      | ((_1 + _2) == (_2 + _1))
+      , make_die_one);
+
+    // example/condition.cpp, whose property may fail
+    bench_qcheck(rep, "condition",
+        (_1 > 0) >>=
+            (lazy::abs(_1 - lazy::sqrt(_1) * lazy::sqrt(_1)) <= DBL_EPSILON)
+      , [&] { return make_config(_1 = one, _test_count = cases, _max_failures = cases); }
+      , false);
+
+    // example/complex.cpp
+    bench_qcheck(rep, "complex",
+        (_2 > 0) >>=
+            group_by(_1 % 3)
+              | classify(_1 > 3, "foo")
+              | classify(_1 <= 3, "bar")
+              | ((_1 + _2) == (_2 + _1))
+      , [&] {
+            return make_config(_1 = die, _2 = one, _rng = boost::random::mt11213b(),
+                               _test_count = cases, _max_test_count = cases * 3 / 2);
+        });
+
+    // A condition that rejects 90% of test cases and uses only one of the
+    // arguments, with and without _partial_redraw.
+    auto const rare = (_1 % 10 == 9) >>= (boost::phoenix::size(_2) <= 50u);
+    for(bool partial : {false, true})
+    {
+        std::string const name = partial ? "rare condition, partial redraw" : "rare condition";
+        rep.run("qcheck: " + name, [&] {
+            auto config = make_config(_1 = uniform<int>(0, 1000), _2 = vector(one),
+                                      _test_count = cases, _max_test_count = cases * 100,
+                                      _partial_redraw = partial);
+            rep.expect(qchk::qcheck(rare, config).success(), name);
+        });
+    }
+
+    return rep.finish();
+}
@@ -0,0 +1,86 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file qcheck_results.cpp
+/// \brief Benchmarks of the classification and grouping bookkeeping of qcheck_results<>
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+#include <boost/quick_check/quick_check.hpp>
+#include "./bench.hpp"
+
+namespace qchk = boost::quick_check;
+
+// Record cases successes of prop, whose classes and groups are worked out
+// beforehand, so that only qcheck_results<>::add_success() is timed. Then
+// time the classification, grouping and recording together.
+template<typename Property>
+void bench_add_success(bench::reporter &rep, std::string const &name, Property const &prop)
+{
+    using namespace qchk;
+    uniform<int> di(-1000, 1000);
+    normal<double> nd(0., 1.);
+    auto config = make_config(_1 = di, _2 = nd);
+
+    typedef typename decltype(config)::result_type args_type;
+    typedef typename detail::get_group_by_type<Property, decltype(config)>::type group_type;
+    typedef typename detail::make_qcheck_results_type<args_type, group_type>::type results_type;
+
+    auto const &classify = detail::get_classifier(prop);
+    auto const &groupby = detail::get_grouper(prop);
+
+    std::vector<args_type> args;
+    std::vector<detail::class_mask> classes;
+    std::vector<group_type> groups;
+    for(std::size_t i = 0; i < rep.cases(); ++i)
+    {
+        args.push_back(config());
+        classes.push_back(classify.mask(args.back()));
+        groups.push_back(groupby(args.back()));
+    }
+
+    rep.run("add_success: " + name, [&] {
+        results_type results;
+        detail::qcheck_access::set_class_names(results, classify);
+        for(std::size_t i = 0; i < rep.cases(); ++i)
+            detail::qcheck_access::add_success(results, classes[i], groups[i]);
+        bench::keep(results);
+    });
+
+    rep.run("classify, group and add_success: " + name, [&] {
+        results_type results;
+        detail::qcheck_access::set_class_names(results, classify);
+        for(std::size_t i = 0; i < rep.cases(); ++i)
+            detail::qcheck_access::add_success(results, classify.mask(args[i]), groupby(args[i]));
+        bench::keep(results);
+    });
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace qchk;
+    bench::reporter rep("qcheck_results", argc, argv);
+
+    bench_add_success(rep, "unclassified", _1 == _1);
+    bench_add_success(rep, "2 classes",
+                      classify(_1 < 0, "negative") | classify(_2 < 0., "_2 negative") | (_1 == _1));
+    bench_add_success(rep, "8 classes",
+                      classify(_1 < -750, "a") | classify(_1 < -500, "b")
+                    | classify(_1 < -250, "c") | classify(_1 < 0, "d")
+                    | classify(_1 < 250, "e") | classify(_1 < 500, "f")
+                    | classify(_1 < 750, "g") | classify(_2 < 0., "h") | (_1 == _1));
+    bench_add_success(rep, "group_by(_1 % 3)", group_by(_1 % 3) | (_1 == _1));
+    bench_add_success(rep, "group_by(_1 % 100), 2 classes",
+                      group_by(_1 % 100)
+                    | classify(_1 < 0, "negative") | classify(_2 < 0., "_2 negative")
+                    | (_1 == _1));
+
+    return rep.finish();
+}
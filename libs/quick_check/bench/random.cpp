@@ -0,0 +1,93 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file random.cpp
+/// \brief Compares the speed of random number engines, alone and inside qcheck
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+#include <boost/cstdint.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/quick_check/quick_check.hpp>
+#include "./bench.hpp"
+
+namespace qchk = boost::quick_check;
+
+// Draw 64 bits at a time from rng, with fill if it has one. The sum keeps
+// the draws from being optimized away.
+template<typename Rng>
+boost::uint64_t draw(Rng &rng, std::vector<boost::uint64_t> &words, boost::mpl::true_)
+{
+    rng.fill(words.data(), words.size());
+    boost::uint64_t sum = 0;
+    for(boost::uint64_t w : words)
+        sum += w;
+    return sum;
+}
+
+template<typename Rng>
+boost::uint64_t draw(Rng &rng, std::vector<boost::uint64_t> &words, boost::mpl::false_)
+{
+    boost::uint64_t sum = 0;
+    for(std::size_t i = 0; i < words.size(); ++i)
+    {
+        boost::uint64_t w = rng();
+        if(sizeof(typename Rng::result_type) == 4)
+            w |= boost::uint64_t(rng()) << 32;
+        sum += w;
+    }
+    return sum;
+}
+
+// Time each way of using the engine.
+template<typename Rng>
+void bench_rng(bench::reporter &rep, std::string const &name, Rng const &rng)
+{
+    using namespace qchk;
+    std::size_t const test_count = rep.cases();
+    uniform<int> di(-1000000, 1000000);
+    uniform<double> dd(-1000., 1000.);
+
+    std::vector<boost::uint64_t> words(test_count);
+    Rng raw = rng;
+    rep.run(name + ": 64-bit words", [&] {
+        bench::keep(draw(raw, words, detail::has_fill<Rng>()));
+    });
+    rep.run(name + ": qcheck int", [&] {
+        auto config = make_config(_1 = di, _2 = di, _rng = rng, _test_count = test_count);
+        rep.expect(qcheck((_1 + _2) == (_2 + _1), config).success(), name);
+    });
+    rep.run(name + ": qcheck double", [&] {
+        auto config = make_config(_1 = dd, _2 = dd, _rng = rng, _test_count = test_count);
+        rep.expect(qcheck(_1 * _1 + _2 * _2 >= 0., config).success(), name);
+    });
+    rep.run(name + ": qcheck seeded", [&] {
+        auto config = make_config(_1 = di, _2 = di, _rng = rng, _test_count = test_count,
+                                  _seed = 42u);
+        rep.expect(qcheck((_1 + _2) == (_2 + _1), config).success(), name);
+    });
+    rep.run(name + ": qcheck_batched int", [&] {
+        auto config = make_config(_1 = di, _2 = di, _rng = rng, _test_count = test_count);
+        rep.expect(qcheck_batched((_1 + _2) == (_2 + _1), config).success(), name);
+    });
+}
+
+int main(int argc, char *argv[])
+{
+    bench::reporter rep("random", argc, argv);
+
+    bench_rng(rep, "mt11213b", boost::random::mt11213b());
+    bench_rng(rep, "mt19937_64", boost::random::mt19937_64());
+    bench_rng(rep, "xoshiro256ss", qchk::xoshiro256ss());
+    bench_rng(rep, "pcg64", qchk::pcg64());
+    bench_rng(rep, "philox4x32", qchk::philox4x32());
+
+    return rep.finish();
+}
@@ -15,7 +15,6 @@
 #include <sstream>
 #include <boost/quick_check/quick_check.hpp>
 #include <boost/test/unit_test.hpp>
-#include "./file_dist.hpp"
 
 namespace qchk = boost::quick_check;
 
@@ -23,8 +22,8 @@ void test_qchk_auto()
 {
     using namespace qchk;
     std::stringstream sout;
-    file_dist<int> di("uniform_int_distribution.txt");
-    file_dist<double> dd("normal_double_distribution.txt");
+    qchk::file_generator<int> di("uniform_int_distribution.txt", qchk::text_file);
+    qchk::file_generator<double> dd("normal_double_distribution.txt", qchk::text_file);
 
     // a quickCheck configuration. Placeholders _1
     // and _2 receive values generated from die and one:
@@ -64,8 +63,8 @@ void test_qchk_prop()
 {
     using namespace qchk;
     std::stringstream sout;
-    file_dist<int> di("uniform_int_distribution.txt");
-    file_dist<double> dd("normal_double_distribution.txt");
+    qchk::file_generator<int> di("uniform_int_distribution.txt", qchk::text_file);
+    qchk::file_generator<double> dd("normal_double_distribution.txt", qchk::text_file);
 
     // a quickCheck configuration. Placeholders _1
     // and _2 receive values generated from die and one:
@@ -12,9 +12,11 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <sstream>
+#include <stdexcept>
+#include <boost/preprocessor/repetition/repeat.hpp>
+#include <boost/preprocessor/stringize.hpp>
 #include <boost/quick_check/quick_check.hpp>
 #include <boost/test/unit_test.hpp>
-#include "./file_dist.hpp"
 
 static const std::size_t CLOOPS = 128;
 
@@ -23,8 +25,8 @@ namespace qchk = boost::quick_check;
 void test_classify_auto_1()
 {
     using namespace qchk;
-    file_dist<int> di("uniform_int_distribution.txt");
-    file_dist<double> dd("normal_double_distribution.txt");
+    qchk::file_generator<int> di("uniform_int_distribution.txt", qchk::text_file);
+    qchk::file_generator<double> dd("normal_double_distribution.txt", qchk::text_file);
 
     // a quickCheck configuration. Placeholders _1
     // and _2 receive values generated from die and one:
@@ -56,8 +58,8 @@ void test_classify_auto_1()
 void test_classify_auto_2()
 {
     using namespace qchk;
-    file_dist<int> di("uniform_int_distribution.txt");
-    file_dist<double> dd("normal_double_distribution.txt");
+    qchk::file_generator<int> di("uniform_int_distribution.txt", qchk::text_file);
+    qchk::file_generator<double> dd("normal_double_distribution.txt", qchk::text_file);
 
     // a quickCheck configuration. Placeholders _1
     // and _2 receive values generated from die and one:
@@ -91,8 +93,8 @@ void test_classify_auto_2()
 void test_classify_auto_3()
 {
     using namespace qchk;
-    file_dist<int> di("uniform_int_distribution.txt");
-    file_dist<double> dd("normal_double_distribution.txt");
+    qchk::file_generator<int> di("uniform_int_distribution.txt", qchk::text_file);
+    qchk::file_generator<double> dd("normal_double_distribution.txt", qchk::text_file);
 
     // a quickCheck configuration. Placeholders _1
     // and _2 receive values generated from die and one:
@@ -129,8 +131,8 @@ void test_classify_auto_3()
 void test_classify_prop_1()
 {
     using namespace qchk;
-    file_dist<int> di("uniform_int_distribution.txt");
-    file_dist<double> dd("normal_double_distribution.txt");
+    qchk::file_generator<int> di("uniform_int_distribution.txt", qchk::text_file);
+    qchk::file_generator<double> dd("normal_double_distribution.txt", qchk::text_file);
 
     // a quickCheck configuration. Placeholders _1
     // and _2 receive values generated from die and one:
@@ -162,8 +164,8 @@ void test_classify_prop_1()
 void test_classify_prop_2()
 {
     using namespace qchk;
-    file_dist<int> di("uniform_int_distribution.txt");
-    file_dist<double> dd("normal_double_distribution.txt");
+    qchk::file_generator<int> di("uniform_int_distribution.txt", qchk::text_file);
+    qchk::file_generator<double> dd("normal_double_distribution.txt", qchk::text_file);
 
     // a quickCheck configuration. Placeholders _1
     // and _2 receive values generated from die and one:
@@ -197,8 +199,8 @@ void test_classify_prop_2()
 void test_classify_prop_3()
 {
     using namespace qchk;
-    file_dist<int> di("uniform_int_distribution.txt");
-    file_dist<double> dd("normal_double_distribution.txt");
+    qchk::file_generator<int> di("uniform_int_distribution.txt", qchk::text_file);
+    qchk::file_generator<double> dd("normal_double_distribution.txt", qchk::text_file);
 
     // a quickCheck configuration. Placeholders _1
     // and _2 receive values generated from die and one:
@@ -232,6 +234,116 @@ void test_classify_prop_3()
     );
 }
 
+void test_classify_mask()
+{
+    using namespace qchk;
+
+    // Each classify() clause has its own bit, in the order of the clauses.
+    auto prop =
+        classify(_1 > 0, "positive")
+      | classify(_1 % 2 == 0, "even")
+      | (_1 == _1);
+    auto const &classify = detail::get_classifier(prop);
+    boost::fusion::vector1<int> four(4), three(3), minus_two(-2), minus_one(-1);
+    BOOST_CHECK_EQUAL(classify.mask(four), 3u);
+    BOOST_CHECK_EQUAL(classify.mask(three), 1u);
+    BOOST_CHECK_EQUAL(classify.mask(minus_two), 2u);
+    BOOST_CHECK_EQUAL(classify.mask(minus_one), 0u);
+
+    std::vector<std::string> names;
+    classify.names(names);
+    BOOST_CHECK(names == std::vector<std::string>({"positive", "even"}));
+    BOOST_CHECK(classify(four) == std::vector<std::string>({"even", "positive"}));
+
+    // The same goes for a type-erased property
+    property<int> erased = prop;
+    BOOST_CHECK_EQUAL(erased.classifier().mask(minus_two), 2u);
+    BOOST_CHECK(erased.classifier()(four) == std::vector<std::string>({"even", "positive"}));
+}
+
+void test_classify_merge()
+{
+    using namespace qchk;
+    qchk::file_generator<int> di("uniform_int_distribution.txt", qchk::text_file);
+    qchk::file_generator<double> dd("normal_double_distribution.txt", qchk::text_file);
+
+    // Merged results name their categories the same way, even if the
+    // properties' clauses are in a different order.
+    property<int, double> const foo_bar =
+        classify(_2 > 0., "foo")
+      | classify(_2 <= 0., "bar")
+      | classify(_1 > 0, "baz")
+      | ((_1 + _2) == (_2 + _1));
+    property<int, double> const bar_foo =
+        classify(_1 > 0, "baz")
+      | classify(_2 <= 0., "bar")
+      | classify(_2 > 0., "foo")
+      | ((_1 + _2) == (_2 + _1));
+
+    auto config = make_config(_1 = di, _2 = dd, _test_count = 50u);
+    auto res = qcheck(foo_bar, config);
+    res += qcheck(bar_foo, config);
+
+    std::stringstream sout;
+    res.print_summary(sout);
+    BOOST_CHECK_EQUAL(
+        "OK, passed 100 tests.\n"
+        "28% bar.\n"
+        "23% bar, baz.\n"
+        "26% baz, foo.\n"
+        "23% foo.\n"
+      , sout.str()
+    );
+}
+
+void test_classify_shared_name()
+{
+    using namespace qchk;
+    uniform<int> di(0, 9);
+
+    // Clauses with the same name make one class.
+    auto prop =
+        classify(_1 < 3, "small")
+      | classify(_1 > 7, "small")
+      | (_1 >= 0);
+
+    auto config = make_config(_1 = di, _seed = 7u);
+    std::stringstream sout;
+    qcheck(prop, config).print_summary(sout);
+    BOOST_CHECK_EQUAL(
+        "OK, passed 100 tests.\n"
+        "46% small.\n"
+      , sout.str()
+    );
+}
+
+#define CLASSIFY_CLAUSE(z, n, prefix) classify(_1 == n, prefix BOOST_PP_STRINGIZE(n)) |
+
+void test_classify_merge_too_many()
+{
+    using namespace qchk;
+    uniform<int> di(0, 32);
+
+    // Merging results with more than 64 class names between them throws,
+    // and leaves the results as they were.
+    property<int> const a = BOOST_PP_REPEAT(33, CLASSIFY_CLAUSE, "a") (_1 == _1);
+    property<int> const b = BOOST_PP_REPEAT(33, CLASSIFY_CLAUSE, "b") (_1 == _1);
+
+    auto config = make_config(_1 = di, _test_count = 50u);
+    auto res = qcheck(a, config);
+    std::stringstream before, after;
+    res.print_summary(before);
+    BOOST_CHECK_THROW(res += qcheck(b, config), std::length_error);
+    res.print_summary(after);
+    BOOST_CHECK_EQUAL(before.str(), after.str());
+
+    // Names they share take no extra room.
+    res += qcheck(a, config);
+    BOOST_CHECK(res.success());
+}
+
+#undef CLASSIFY_CLAUSE
+
 using namespace boost::unit_test;
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // init_unit_test_suite
@@ -246,6 +358,10 @@ test_suite* init_unit_test_suite( int argc, char* argv[] )
     test->add(BOOST_TEST_CASE(&test_classify_prop_1));
     test->add(BOOST_TEST_CASE(&test_classify_prop_2));
     test->add(BOOST_TEST_CASE(&test_classify_prop_3));
+    test->add(BOOST_TEST_CASE(&test_classify_mask));
+    test->add(BOOST_TEST_CASE(&test_classify_merge));
+    test->add(BOOST_TEST_CASE(&test_classify_shared_name));
+    test->add(BOOST_TEST_CASE(&test_classify_merge_too_many));
 
     return test;
 }
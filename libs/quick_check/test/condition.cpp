@@ -11,10 +11,12 @@
 // NOTE: This library is not yet an official Boost library.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <vector>
+#include <sstream>
+#include <iostream>
 #include <stdexcept>
 #include <boost/quick_check/quick_check.hpp>
 #include <boost/test/unit_test.hpp>
-#include "./file_dist.hpp"
 
 namespace qchk = boost::quick_check;
 namespace phx = boost::phoenix;
@@ -29,8 +31,8 @@ bool throw_on_non_positive(int i, double d)
 void test_condition_throw_auto()
 {
     using namespace qchk;
-    file_dist<int> di("uniform_int_distribution.txt");
-    file_dist<double> dd("normal_double_distribution.txt");
+    qchk::file_generator<int> di("uniform_int_distribution.txt", qchk::text_file);
+    qchk::file_generator<double> dd("normal_double_distribution.txt", qchk::text_file);
 
     auto config = make_config(_1 = di, _2 = dd);
 
@@ -45,8 +47,8 @@ void test_condition_throw_auto()
 void test_condition_safe_auto()
 {
     using namespace qchk;
-    file_dist<int> di("uniform_int_distribution.txt");
-    file_dist<double> dd("normal_double_distribution.txt");
+    qchk::file_generator<int> di("uniform_int_distribution.txt", qchk::text_file);
+    qchk::file_generator<double> dd("normal_double_distribution.txt", qchk::text_file);
 
     auto config = make_config(_1 = di, _2 = dd);
 
@@ -62,8 +64,8 @@ void test_condition_safe_auto()
 void test_condition_throw_prop()
 {
     using namespace qchk;
-    file_dist<int> di("uniform_int_distribution.txt");
-    file_dist<double> dd("normal_double_distribution.txt");
+    qchk::file_generator<int> di("uniform_int_distribution.txt", qchk::text_file);
+    qchk::file_generator<double> dd("normal_double_distribution.txt", qchk::text_file);
 
     auto config = make_config(_1 = di, _2 = dd);
 
@@ -78,8 +80,8 @@ void test_condition_throw_prop()
 void test_condition_safe_prop()
 {
     using namespace qchk;
-    file_dist<int> di("uniform_int_distribution.txt");
-    file_dist<double> dd("normal_double_distribution.txt");
+    qchk::file_generator<int> di("uniform_int_distribution.txt", qchk::text_file);
+    qchk::file_generator<double> dd("normal_double_distribution.txt", qchk::text_file);
 
     auto config = make_config(_1 = di, _2 = dd);
 
@@ -92,6 +94,115 @@ void test_condition_safe_prop()
     BOOST_CHECK_NO_THROW(qcheck(throw_if, config));
 }
 
+// The placeholders a condition uses are known at compile time.
+template<typename Expr>
+std::size_t condition_mask_of(Expr const &expr)
+{
+    typedef
+        typename std::decay<decltype(qchk::detail::get_condition(expr))>::type
+    condition_type;
+    return qchk::detail::condition_mask<condition_type>::value;
+}
+
+void test_condition_mask()
+{
+    using namespace qchk;
+    BOOST_CHECK_EQUAL(condition_mask_of(_1 % 10 == 9 >>= (_1 + _2 == _2 + _1)), 1u);
+    BOOST_CHECK_EQUAL(condition_mask_of(_2 > 0 && _3 < 1 >>= (_1 == _1)), 6u);
+    BOOST_CHECK_EQUAL(condition_mask_of(phx::val(true) >>= (_1 == _1)), 0u);
+    BOOST_CHECK_EQUAL(condition_mask_of(_1 + _2 == _2 + _1), 0u);
+    BOOST_CHECK_EQUAL(
+        condition_mask_of(phx::bind(&throw_on_non_positive, _2, 1.0) >>= (_1 == _1)), 2u);
+    property<int, double> prop = _1 > 0 >>= (_1 == _1);
+    BOOST_CHECK_EQUAL(condition_mask_of(prop), ~std::size_t(0));
+}
+
+std::vector<double> seen;
+
+bool see(double d)
+{
+    seen.push_back(d);
+    return true;
+}
+
+// With _partial_redraw, the arguments the condition doesn't use are kept
+// when it rejects a test case.
+void test_condition_partial_redraw()
+{
+    using namespace qchk;
+    qchk::file_generator<int> di("uniform_int_distribution.txt", qchk::text_file);
+    qchk::file_generator<double> dd("normal_double_distribution.txt", qchk::text_file);
+    auto config = make_config(_1 = di, _2 = dd, _partial_redraw = true,
+                              _max_test_count = 10000u, _stats = collect_stats());
+    BOOST_CHECK(config.partial_redraw());
+
+    seen.clear();
+    auto res = qcheck(_1 > 0 && _1 % 10 == 9 >>= phx::bind(&see, _2), config);
+    BOOST_CHECK(res);
+    BOOST_CHECK_EQUAL(res.test_count(), 100u);
+    BOOST_REQUIRE_EQUAL(res.stats().draws().size(), 2u);
+    BOOST_CHECK_EQUAL(res.stats().draws()[0], res.stats().generated());
+    BOOST_CHECK_EQUAL(res.stats().draws()[1], 100u);
+    BOOST_CHECK(res.stats().generated() > 100u);
+
+    // The second arguments of the tests are the first 100 values of dd
+    qchk::file_generator<double> dd2("normal_double_distribution.txt", qchk::text_file);
+    int dummy = 0;
+    BOOST_REQUIRE_EQUAL(seen.size(), 100u);
+    for(double d : seen)
+        BOOST_CHECK_EQUAL(d, dd2(dummy));
+
+    // A seeded config redraws everything.
+    auto seeded = make_config(_1 = uniform<int>(0, 9), _2 = normal<double>(),
+                              _partial_redraw = true, _seed = 1u, _stats = collect_stats());
+    auto res2 = qcheck(_1 == 9 >>= (_2 == _2), seeded);
+    BOOST_CHECK_EQUAL(res2.stats().draws()[1], res2.stats().generated());
+    BOOST_CHECK_EQUAL(
+        fusion::at_c<0>(seeded(res2.stats().generated() - 1)), 9);
+}
+
+// The rejection monitor warns, or stops, when test_count is out of reach.
+void test_condition_rejection_monitor()
+{
+    using namespace qchk;
+    auto prop = _1 % 100 == 0 >>= (_1 / 100 * 100 == _1);
+
+    auto config1 = make_config(_1 = uniform<int>(0, 999999), _seed = 3u,
+                               _rejection_monitor = stop_on_rejections,
+                               _stats = collect_stats());
+    BOOST_CHECK_EQUAL(config1.rejection_monitor(), stop_on_rejections);
+    auto res1 = qcheck(prop, config1);
+    BOOST_CHECK(res1);
+    BOOST_CHECK(res1.exhausted());
+    BOOST_CHECK_EQUAL(res1.stats().generated(), 128u);
+
+    auto config2 = make_config(_1 = uniform<int>(0, 999999), _seed = 3u,
+                               _rejection_monitor = warn_on_rejections);
+    std::stringstream serr;
+    std::streambuf *old = std::cerr.rdbuf(serr.rdbuf());
+    auto res2 = qcheck(prop, config2);
+    std::cerr.rdbuf(old);
+    BOOST_CHECK(res2.exhausted());
+    BOOST_CHECK_EQUAL(config2.next_case(), 1000u);
+    std::string const warning = serr.str();
+    BOOST_CHECK_EQUAL(warning.find("Warning: the condition accepted"), 0u);
+    BOOST_CHECK_EQUAL(std::count(warning.begin(), warning.end(), '\n'), 1);
+
+    // Nothing is said when the condition accepts enough test cases.
+    auto config3 = make_config(_1 = uniform<int>(0, 9), _seed = 3u, _test_count = 50u,
+                               _rejection_monitor = stop_on_rejections);
+    auto res3 = qcheck(prop, config3);
+    BOOST_CHECK(!res3.exhausted());
+    BOOST_CHECK_EQUAL(res3.test_count(), 50u);
+    BOOST_CHECK(config3.next_case() > 256u);
+
+    auto config4 = make_config(_1 = uniform<int>(0, 999999), _seed = 3u,
+                               _rejection_monitor = stop_on_rejections);
+    auto res4 = qcheck_batched(prop, config4, 200);
+    BOOST_CHECK(res4.exhausted());
+    BOOST_CHECK_EQUAL(config4.next_case(), 200u);
+}
+
 using namespace boost::unit_test;
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // init_unit_test_suite
@@ -104,6 +215,9 @@ test_suite* init_unit_test_suite( int argc, char* argv[] )
     test->add(BOOST_TEST_CASE(&test_condition_safe_auto));
     test->add(BOOST_TEST_CASE(&test_condition_throw_prop));
     test->add(BOOST_TEST_CASE(&test_condition_safe_prop));
+    test->add(BOOST_TEST_CASE(&test_condition_mask));
+    test->add(BOOST_TEST_CASE(&test_condition_partial_redraw));
+    test->add(BOOST_TEST_CASE(&test_condition_rejection_monitor));
 
     return test;
 }
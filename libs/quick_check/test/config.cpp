@@ -14,15 +14,14 @@
 #include <boost/quick_check/quick_check.hpp>
 #include <boost/test/unit_test.hpp>
 #include <boost/test/floating_point_comparison.hpp>
-#include "./file_dist.hpp"
 
 namespace qchk = boost::quick_check;
 
 void test_config_0()
 {
     using namespace qchk;
-    file_dist<int> di("uniform_int_distribution.txt");
-    file_dist<double> dd("normal_double_distribution.txt");
+    qchk::file_generator<int> di("uniform_int_distribution.txt", qchk::text_file);
+    qchk::file_generator<double> dd("normal_double_distribution.txt", qchk::text_file);
 
     auto config = make_config();
     BOOST_CHECK_EQUAL(config.test_count(), 100u);
@@ -36,7 +35,7 @@ void test_config_0()
 void test_config_1()
 {
     using namespace qchk;
-    file_dist<int> di("uniform_int_distribution.txt");
+    qchk::file_generator<int> di("uniform_int_distribution.txt", qchk::text_file);
 
     auto config = make_config(_1 = di);
     BOOST_CHECK_EQUAL(config.test_count(), 100u);
@@ -50,8 +49,8 @@ void test_config_1()
 void test_config_2()
 {
     using namespace qchk;
-    file_dist<int> di("uniform_int_distribution.txt");
-    file_dist<double> dd("normal_double_distribution.txt");
+    qchk::file_generator<int> di("uniform_int_distribution.txt", qchk::text_file);
+    qchk::file_generator<double> dd("normal_double_distribution.txt", qchk::text_file);
 
     auto config = make_config(_1 = di, _2 = dd);
     BOOST_CHECK_EQUAL(config.test_count(), 100u);
@@ -66,7 +65,7 @@ void test_config_2()
 void test_config_3()
 {
     using namespace qchk;
-    file_dist<double> dd("normal_double_distribution.txt");
+    qchk::file_generator<double> dd("normal_double_distribution.txt", qchk::text_file);
 
     auto config = make_config(_1 = _2 = dd);
     BOOST_CHECK_EQUAL(config.test_count(), 100u);
@@ -93,8 +92,8 @@ void test_config_3()
 void test_config_4()
 {
     using namespace qchk;
-    file_dist<double> dd("normal_double_distribution.txt");
-    file_dist<int> di("uniform_int_distribution.txt");
+    qchk::file_generator<double> dd("normal_double_distribution.txt", qchk::text_file);
+    qchk::file_generator<int> di("uniform_int_distribution.txt", qchk::text_file);
 
     auto config = make_config(_1 = _2 = dd, _3 = di);
     BOOST_CHECK_EQUAL(config.test_count(), 100u);
@@ -124,8 +123,8 @@ void test_config_4()
 void test_config_5()
 {
     using namespace qchk;
-    file_dist<double> dd("normal_double_distribution.txt");
-    file_dist<int> di("uniform_int_distribution.txt");
+    qchk::file_generator<double> dd("normal_double_distribution.txt", qchk::text_file);
+    qchk::file_generator<int> di("uniform_int_distribution.txt", qchk::text_file);
 
     auto config0 = make_config(_1 = dd, _2 = di, _test_count = 1001);
     BOOST_CHECK_EQUAL(config0.test_count(), 1001u);
@@ -177,6 +176,109 @@ void test_config_6()
     BOOST_CHECK_EQUAL(boost::fusion::at_c<0>(args), 42);
 }
 
+void test_config_7()
+{
+    using namespace qchk;
+    uniform<int> di(0, 1000000);
+    normal<double> dd(0., 1.);
+
+    auto config = make_config(_1 = di, _2 = dd, _seed = 42u);
+    BOOST_CHECK(config.seeded());
+    BOOST_CHECK_EQUAL(config.seed(), 42u);
+    BOOST_CHECK_EQUAL(config.next_case(), 0u);
+
+    std::vector<boost::fusion::vector2<int, double> > cases;
+    for(int i = 0; i < 10; ++i)
+        cases.push_back(config());
+    BOOST_CHECK_EQUAL(config.next_case(), 10u);
+
+    // Any case can be regenerated by itself, in any order
+    for(int i = 9; i >= 0; --i)
+        BOOST_CHECK(config(i) == cases[i]);
+
+    // The same seed gives the same cases, irrespective of the engine's state
+    auto config2 = make_config(_1 = di, _2 = dd, _seed = 42u, _rng = boost::random::mt11213b(7));
+    auto config3 = make_config(_1 = di, _2 = dd, _seed = 42u, _rng = boost::random::mt11213b(99));
+    for(int i = 0; i < 10; ++i)
+        BOOST_CHECK(config2() == config3());
+
+    // A different seed gives different cases
+    auto config4 = make_config(_1 = di, _2 = dd, _seed = 43u);
+    BOOST_CHECK(config4() != cases[0]);
+
+    // Unseeded configs are unaffected
+    auto config5 = make_config(_1 = di);
+    BOOST_CHECK(!config5.seeded());
+}
+
+// A generator that counts the values it generates in place
+int in_place_count = 0;
+
+struct counted_t
+{
+    typedef int result_type;
+
+    template<typename Rng>
+    int operator()(Rng &)
+    {
+        return 7;
+    }
+};
+
+template<typename Rng>
+void generate_into(counted_t &, Rng &, int &value)
+{
+    ++in_place_count;
+    value = 7;
+}
+
+void test_config_8()
+{
+    using namespace qchk;
+    auto config = make_config(_1 = vector(uniform<int>(0, 9)), _2 = uniform<int>(0, 99)
+                            , _seed = 42u, _size_schedule = linear_sizes(1, 20));
+
+    // Seeded test cases generated in place can be regenerated.
+    auto args = config();
+    for(std::size_t i = 1; i < 20; ++i)
+    {
+        config(args);
+        BOOST_CHECK_EQUAL(fusion::at_c<1>(args), fusion::at_c<1>(config(i)));
+        BOOST_CHECK(fusion::at_c<0>(args) == fusion::at_c<0>(config(i)));
+    }
+    BOOST_CHECK_EQUAL(config.next_case(), 20u);
+
+    // Others are drawn from the same generators, in place.
+    auto config3 = make_config(_1 = vector(uniform<int>(0, 9)), _sized = 20u);
+    auto args3 = config3();
+    for(std::size_t i = 1; i < 20; ++i)
+    {
+        config3(args3);
+        BOOST_CHECK(fusion::at_c<0>(args3).size() < 20u);
+        for(int j : fusion::at_c<0>(args3))
+            BOOST_CHECK(j >= 0 && j <= 9);
+    }
+    BOOST_CHECK_EQUAL(config3.next_case(), 20u);
+
+    // Failures are moved out of the arguments intact.
+    auto res = qcheck(_2 < 90, config);
+    BOOST_REQUIRE(!res);
+    for(auto const &failure : res.failures())
+    {
+        auto const expected = config(failure.case_index());
+        BOOST_CHECK(fusion::at_c<0>(failure) == fusion::at_c<0>(expected));
+        BOOST_CHECK_EQUAL(fusion::at_c<1>(failure), fusion::at_c<1>(expected));
+    }
+
+    // Generators can say how to generate in place.
+    auto config2 = make_config(_1 = counted_t());
+    auto args2 = config2();
+    config2(args2);
+    config2(args2);
+    BOOST_CHECK_EQUAL(fusion::at_c<0>(args2), 7);
+    BOOST_CHECK_EQUAL(in_place_count, 2);
+}
+
 using namespace boost::unit_test;
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // init_unit_test_suite
@@ -192,6 +294,8 @@ test_suite* init_unit_test_suite( int argc, char* argv[] )
     test->add(BOOST_TEST_CASE(&test_config_4));
     test->add(BOOST_TEST_CASE(&test_config_5));
     test->add(BOOST_TEST_CASE(&test_config_6));
+    test->add(BOOST_TEST_CASE(&test_config_7));
+    test->add(BOOST_TEST_CASE(&test_config_8));
 
     return test;
 }
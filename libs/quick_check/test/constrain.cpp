@@ -0,0 +1,159 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file constrain.cpp
+/// \brief A test of constrain(), which narrows generators to the ranges accepted by a condition
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <limits>
+#include <boost/quick_check/quick_check.hpp>
+#include <boost/phoenix/stl/container.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace qchk = boost::quick_check;
+namespace phx = boost::phoenix;
+
+// The generators narrow themselves, or refuse to.
+void test_narrow()
+{
+    using namespace qchk;
+    boost::random::mt11213b rng;
+
+    uniform<int> ints(0, 100);
+    BOOST_CHECK(narrow(ints, 10, 1000));
+    BOOST_CHECK(!narrow(ints, 200, 300));
+    for(int i = 0; i < 100; ++i)
+    {
+        int const value = ints(rng);
+        BOOST_CHECK(value >= 10 && value <= 100);
+    }
+
+    uniform<double> reals(0., 1.);
+    BOOST_CHECK(narrow(reals, .5, 2.));
+    BOOST_CHECK(!narrow(reals, 1., 1.));
+    for(int i = 0; i < 100; ++i)
+    {
+        double const value = reals(rng);
+        BOOST_CHECK(value >= .5 && value < 1.);
+    }
+
+    auto vec = vector(uniform<int>(0, 9));
+    BOOST_CHECK(narrow_size(vec, 3, 5));
+    for(int i = 0; i < 100; ++i)
+    {
+        std::size_t const size = vec(rng).size();
+        BOOST_CHECK(size >= 3 && size <= 5);
+    }
+
+    // Generators without an overload can't be narrowed.
+    auto chars = alnum();
+    BOOST_CHECK(!narrow(chars, 'a', 'z'));
+    BOOST_CHECK(!narrow_size(ints, 0, 1));
+}
+
+// A narrowed config generates only arguments that satisfy the condition.
+void test_constrain_uniform()
+{
+    using namespace qchk;
+    auto prop = _1 > 0 && 1000 >= _1 && _2 <= -5 >>= (_1 - _2 > 0);
+    auto config = constrain(prop,
+        make_config(_1 = uniform<int>(), _2 = uniform<int>(-10, 10), _stats = collect_stats(),
+                    _test_count = 500u));
+    auto res = qcheck(prop, config);
+    BOOST_CHECK(res);
+    BOOST_CHECK_EQUAL(res.test_count(), 500u);
+    BOOST_CHECK_EQUAL(res.stats().rejected(), 0u);
+    BOOST_CHECK_EQUAL(res.stats().generated(), 500u);
+
+    // Unsigned arguments compared with signed constants
+    auto uprop = _1 < 10 >>= (_1 * 2u < 20u);
+    auto uconfig = constrain(uprop, make_config(_1 = uniform<unsigned>(), _stats = collect_stats()));
+    auto ures = qcheck(uprop, uconfig);
+    BOOST_CHECK(ures);
+    BOOST_CHECK_EQUAL(ures.stats().rejected(), 0u);
+
+    // Floating-point arguments
+    auto fprop = _1 >= .25 && _1 < .5 >>= (_1 * 2 < 1.);
+    auto fconfig = constrain(fprop, make_config(_1 = uniform<double>(0, 1), _stats = collect_stats()));
+    auto fres = qcheck(fprop, fconfig);
+    BOOST_CHECK(fres);
+    BOOST_CHECK_EQUAL(fres.stats().rejected(), 0u);
+}
+
+// Conditions on the sizes of sequences narrow the range of their sizes.
+void test_constrain_size()
+{
+    using namespace qchk;
+    auto prop = 2 < phx::size(_1) && phx::size(_1) <= 4 >>= (phx::size(_1) > 2u);
+    auto config = constrain(prop, make_config(_1 = vector(uniform<int>(0, 9)), _stats = collect_stats()));
+    auto res = qcheck(prop, config);
+    BOOST_CHECK(res);
+    BOOST_CHECK_EQUAL(res.stats().rejected(), 0u);
+    for(std::size_t i = 0; i < config.next_case(); ++i)
+    {
+        std::size_t const size = fusion::at_c<0>(config(i)).size();
+        BOOST_CHECK(size == 3 || size == 4);
+    }
+}
+
+// What can't be proved is left to the condition.
+void test_constrain_fallback()
+{
+    using namespace qchk;
+
+    // Disjunctions, negations and comparisons of two arguments
+    auto prop1 = (_1 < 10 || _1 > 90) && !(_1 == 50) && _1 < _2 >>= (_1 != 50);
+    auto config1 = make_config(_1 = uniform<int>(0, 100), _2 = uniform<int>(0, 100), _seed = 1u);
+    auto constrained1 = constrain(prop1, config1);
+    for(std::size_t i = 0; i < 20; ++i)
+        BOOST_CHECK(config1(i) == constrained1(i));
+    BOOST_CHECK(qcheck(prop1, constrained1));
+
+    // Arguments that share a generator with another
+    auto prop2 = _1 < 10 >>= (_1 < 10);
+    auto config2 = make_config(_1 = _2 = uniform<int>(0, 100), _seed = 1u);
+    auto constrained2 = constrain(prop2, config2);
+    for(std::size_t i = 0; i < 20; ++i)
+        BOOST_CHECK(config2(i) == constrained2(i));
+
+    // A signed argument compared with an unsigned constant is compared as
+    // unsigned, so the range can't be solved.
+    auto prop3 = _1 < 10u >>= (_1 >= 0);
+    auto config3 = make_config(_1 = uniform<int>(-100, 100), _seed = 1u);
+    auto constrained3 = constrain(prop3, config3);
+    for(std::size_t i = 0; i < 20; ++i)
+        BOOST_CHECK(config3(i) == constrained3(i));
+    BOOST_CHECK(qcheck(prop3, constrained3));
+
+    // Contradictions leave the generator alone.
+    auto prop4 = _1 > 200 >>= (_1 > 200);
+    auto constrained4 = constrain(prop4, make_config(_1 = uniform<int>(0, 100), _seed = 1u));
+    BOOST_CHECK(qcheck(prop4, constrained4).exhausted());
+
+    // Unconditional properties are left alone too.
+    auto config5 = make_config(_1 = uniform<int>(0, 100), _seed = 1u);
+    auto constrained5 = constrain(_1 < 200, config5);
+    BOOST_CHECK(config5(0) == constrained5(0));
+}
+
+using namespace boost::unit_test;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("tests for constrain()");
+
+    test->add(BOOST_TEST_CASE(&test_narrow));
+    test->add(BOOST_TEST_CASE(&test_constrain_uniform));
+    test->add(BOOST_TEST_CASE(&test_constrain_size));
+    test->add(BOOST_TEST_CASE(&test_constrain_fallback));
+
+    return test;
+}
@@ -0,0 +1,216 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file corpus.cpp
+/// \brief A test of corpus files of failing test cases, and of qcheck_replay()
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <list>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <boost/quick_check/quick_check.hpp>
+#include <boost/phoenix/stl/container.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace qchk = boost::quick_check;
+namespace phx = boost::phoenix;
+
+struct point
+{
+    point(int x = 0, int y = 0)
+      : x(x), y(y)
+    {}
+
+    int x, y;
+};
+
+void encode(qchk::encoder &out, point const &p)
+{
+    encode(out, p.x);
+    encode(out, p.y);
+}
+
+void decode(qchk::decoder &in, point &p)
+{
+    decode(in, p.x);
+    decode(in, p.y);
+}
+
+template<typename T>
+T round_trip(T const &t)
+{
+    qchk::encoder out;
+    encode(out, t);
+    qchk::decoder in(out.bytes().data(), out.bytes().data() + out.bytes().size());
+    T u = T();
+    decode(in, u);
+    BOOST_CHECK_EQUAL(in.remaining(), 0u);
+    return u;
+}
+
+// The default encodings, and one for a user-defined type, read back what
+// they wrote, exactly.
+void test_encode()
+{
+    double const ds[] = {0.1, -1e-310, 1.0 / 3.0, std::numeric_limits<double>::max()};
+    for(double d : ds)
+        BOOST_CHECK(round_trip(d) == d);
+    BOOST_CHECK(std::isnan(round_trip(std::numeric_limits<double>::quiet_NaN())));
+    BOOST_CHECK_EQUAL(round_trip(std::string("hello\0world", 11)), std::string("hello\0world", 11));
+
+    std::vector<int> vi = {1, -2, 3};
+    BOOST_CHECK(round_trip(vi) == vi);
+    std::vector<bool> vb = {true, false, true};
+    BOOST_CHECK(round_trip(vb) == vb);
+    std::list<std::string> ls = {"a", "", "bc"};
+    BOOST_CHECK(round_trip(ls) == ls);
+    boost::array<double, 3> ad = {{0.1, 0.2, 0.3}};
+    BOOST_CHECK(round_trip(ad) == ad);
+    std::pair<char, std::vector<double> > p('x', std::vector<double>(2, 0.1));
+    BOOST_CHECK(round_trip(p) == p);
+    std::vector<point> vp = {point(1, 2), point(3, 4)};
+    std::vector<point> vp2 = round_trip(vp);
+    BOOST_REQUIRE_EQUAL(vp2.size(), 2u);
+    BOOST_CHECK_EQUAL(vp2[1].x, 3);
+    BOOST_CHECK_EQUAL(vp2[1].y, 4);
+
+    // Decoding past the end of the bytes fails.
+    qchk::encoder out;
+    encode(out, 42);
+    qchk::decoder in(out.bytes().data(), out.bytes().data() + out.bytes().size());
+    double d = 0;
+    BOOST_CHECK_THROW(decode(in, d), qchk::corpus_error);
+}
+
+// The failures of a run are saved, read back exactly, and fail again when
+// they are replayed.
+void test_replay()
+{
+    using namespace qchk;
+    char const *const path = "corpus_test_replay.qcc";
+    std::remove(path);
+
+    auto prop = _1 * 3.0 / 3.0 == _1;
+    auto config = make_config(_1 = normal<double>(0.0, 1e6), _seed = 42u, _max_shrinks = 0u);
+    auto res = qcheck(prop, config);
+    BOOST_REQUIRE(!res);
+    save_failures(res, path);
+
+    corpus<double> failures(path);
+    BOOST_REQUIRE_EQUAL(failures.size(), res.failures().size());
+    for(std::size_t i = 0; i < failures.size(); ++i)
+    {
+        BOOST_CHECK_EQUAL(failures.case_index(i), res.failures()[i].case_index());
+        BOOST_CHECK(fusion::at_c<0>(failures[i]) == fusion::at_c<0>(res.failures()[i]));
+    }
+
+    auto replayed = qcheck_replay(prop, failures);
+    BOOST_CHECK_EQUAL(replayed.test_count(), failures.size());
+    BOOST_CHECK_EQUAL(replayed.failure_count(), failures.size());
+    BOOST_CHECK_EQUAL(replayed.failures()[0].case_index(), res.failures()[0].case_index());
+
+    // A fixed property passes them all.
+    auto fixed = (_1 * 3.0 / 3.0 - _1) * (_1 * 3.0 / 3.0 - _1) <= 1e-18 * _1 * _1;
+    BOOST_CHECK(qcheck_replay(fixed, failures));
+
+    // Appending adds to the corpus.
+    save_failures(res, path);
+    BOOST_CHECK_EQUAL(corpus<double>(path).size(), 2 * res.failures().size());
+    std::remove(path);
+}
+
+// Arrays, sequences, user-defined types, the shrunk failure, groups and
+// classes all survive the trip.
+void test_replay_types()
+{
+    using namespace qchk;
+    char const *const path = "corpus_test_types.qcc";
+    std::remove(path);
+
+    auto config = make_config(_1 = uniform<int[3]>(0, 9)
+                            , _2 = vector(uniform<int>(0, 9))
+                            , _3 = class_<point>(uniform<int>(0, 9), uniform<int>(0, 9))
+                            , _seed = 7u);
+    auto prop = group_by(_1[1] % 3)
+              | classify(_1[0] < 5, "small")
+              | (_1[0] + _1[0] < 16 || phx::size(_2) < 4);
+    auto res = qcheck(prop, config, 8);
+    BOOST_REQUIRE(!res);
+    BOOST_REQUIRE(res.shrink_count() != 0);
+    save_failures(res, path);
+
+    corpus<boost::array<int, 3>, std::vector<int>, point> failures(path);
+    BOOST_REQUIRE_EQUAL(failures.size(), res.failures().size() + 1);
+    auto shrunk = failures[0];
+    BOOST_CHECK(fusion::at_c<0>(shrunk) == fusion::at_c<0>(res.smallest_failure()));
+    BOOST_CHECK(fusion::at_c<1>(shrunk) == fusion::at_c<1>(res.smallest_failure()));
+    BOOST_CHECK_EQUAL(fusion::at_c<2>(shrunk).x, fusion::at_c<2>(res.smallest_failure()).x);
+
+    auto replayed = qcheck_replay(prop, failures);
+    BOOST_CHECK_EQUAL(replayed.failure_count(), failures.size());
+    BOOST_CHECK(!replayed.failures()[0].has_case_index());
+    BOOST_CHECK_EQUAL(replayed.failures()[1].case_index(), res.failures()[0].case_index());
+    BOOST_CHECK(fusion::at_c<1>(replayed.failures()[1]) == fusion::at_c<1>(res.failures()[0]));
+    std::remove(path);
+}
+
+// Files that aren't corpora of the right arguments are refused.
+void test_corpus_errors()
+{
+    using namespace qchk;
+    char const *const path = "corpus_test_errors.qcc";
+    std::remove(path);
+
+    // A missing file is an empty corpus.
+    BOOST_CHECK(corpus<int>(path).empty());
+    BOOST_CHECK(qcheck_replay(_1 == _1, corpus<int>(path)));
+
+    {
+        std::ofstream out(path);
+        out << "not a corpus";
+    }
+    BOOST_CHECK_THROW(corpus<int>(path).size(), corpus_error);
+    std::remove(path);
+
+    {
+        corpus_writer out(path);
+        out.write(3u, fusion::make_vector(1, 2.0));
+        BOOST_CHECK_THROW(out.write(4u, fusion::make_vector(1)), corpus_error);
+    }
+    BOOST_CHECK_THROW(corpus<int>(path).size(), corpus_error);
+    BOOST_CHECK_THROW(corpus_writer(path).write(4u, fusion::make_vector(1)), corpus_error);
+    corpus<int, double> ok(path);
+    BOOST_REQUIRE_EQUAL(ok.size(), 1u);
+    BOOST_CHECK_EQUAL(ok.case_index(0), 3u);
+
+    // A record that holds more than its arguments is refused when it is read.
+    corpus<int, float> bad(path);
+    BOOST_CHECK_THROW(bad[0], corpus_error);
+    std::remove(path);
+}
+
+using namespace boost::unit_test;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("tests for corpus files and qcheck_replay()");
+
+    test->add(BOOST_TEST_CASE(&test_encode));
+    test->add(BOOST_TEST_CASE(&test_replay));
+    test->add(BOOST_TEST_CASE(&test_replay_types));
+    test->add(BOOST_TEST_CASE(&test_corpus_errors));
+
+    return test;
+}
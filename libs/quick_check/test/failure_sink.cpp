@@ -0,0 +1,177 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file failure_sink.cpp
+/// \brief A test of the failure sinks that bound the failures kept by qcheck()
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <set>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <algorithm>
+#include <boost/quick_check/quick_check.hpp>
+#include <boost/phoenix/stl/container.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace qchk = boost::quick_check;
+
+// The indices of the test cases whose failures were kept
+template<typename Results>
+std::vector<std::size_t> kept(Results const &res)
+{
+    std::vector<std::size_t> indices;
+    for(auto const &failure : res.failures())
+        indices.push_back(failure.case_index());
+    return indices;
+}
+
+// Every failure is kept by default; keep_first_failures() keeps a prefix of
+// them, and count_failures() just the first. The counts are exact either way.
+void test_keep_first()
+{
+    using namespace qchk;
+    auto prop = _1 % 3 != 0;
+    auto config = make_config(_1 = uniform<int>(0, 99), _seed = 3u, _test_count = 1000u);
+    auto all = qcheck(prop, config);
+    BOOST_REQUIRE(!all);
+    BOOST_CHECK_EQUAL(all.failure_count(), all.failures().size());
+    BOOST_REQUIRE(all.failures().size() > 100u);
+
+    auto config1 = make_config(_1 = uniform<int>(0, 99), _seed = 3u, _test_count = 1000u,
+                               _failure_sink = keep_first_failures(10));
+    auto first = qcheck(prop, config1);
+    BOOST_CHECK_EQUAL(first.failure_count(), all.failure_count());
+    BOOST_REQUIRE_EQUAL(first.failures().size(), 10u);
+    std::vector<std::size_t> prefix = kept(all);
+    prefix.resize(10);
+    BOOST_CHECK(kept(first) == prefix);
+
+    auto config2 = make_config(_1 = uniform<int>(0, 99), _seed = 3u, _test_count = 1000u,
+                               _failure_sink = count_failures());
+    auto counted = qcheck(prop, config2);
+    BOOST_CHECK_EQUAL(counted.failure_count(), all.failure_count());
+    BOOST_REQUIRE_EQUAL(counted.failures().size(), 1u);
+    BOOST_CHECK_EQUAL(counted.failures()[0].case_index(), all.failures()[0].case_index());
+
+    // The first failure is still shrunk and reported.
+    std::stringstream sout1, sout2;
+    all.print_summary(sout1);
+    counted.print_summary(sout2);
+    BOOST_CHECK_EQUAL(sout1.str(), sout2.str());
+
+    // _max_failures counts all the failures, not just the kept ones.
+    auto config3 = make_config(_1 = uniform<int>(0, 99), _seed = 3u, _test_count = 1000u,
+                               _max_failures = 20u, _failure_sink = count_failures());
+    auto stopped = qcheck(prop, config3);
+    BOOST_CHECK(stopped.stopped_early());
+    BOOST_CHECK_EQUAL(stopped.failure_count(), 20u);
+}
+
+// sample_failures() keeps the first failure and a sample of the others,
+// which is the same however the test cases were sharded.
+void test_sample()
+{
+    using namespace qchk;
+    auto prop = _1 % 3 != 0;
+    auto config = make_config(_1 = uniform<int>(0, 99), _seed = 5u, _test_count = 2000u);
+    auto all = qcheck(prop, config);
+    BOOST_REQUIRE(all.failures().size() > 100u);
+
+    auto config1 = make_config(_1 = uniform<int>(0, 99), _seed = 5u, _test_count = 2000u,
+                               _failure_sink = sample_failures(16));
+    auto sample = qcheck(prop, config1);
+    BOOST_CHECK_EQUAL(sample.failure_count(), all.failure_count());
+    BOOST_REQUIRE_EQUAL(sample.failures().size(), 16u);
+    BOOST_CHECK_EQUAL(sample.failures()[0].case_index(), all.failures()[0].case_index());
+
+    // The sample holds the failures with the lowest priorities.
+    std::vector<std::size_t> expected = kept(all);
+    std::sort(expected.begin() + 1, expected.end(), [](std::size_t a, std::size_t b)
+    {
+        return failure_sink::priority(a) < failure_sink::priority(b);
+    });
+    expected.resize(16);
+    std::vector<std::size_t> actual = kept(sample);
+    BOOST_CHECK(std::set<std::size_t>(actual.begin(), actual.end()) ==
+                std::set<std::size_t>(expected.begin(), expected.end()));
+
+    // Sharding and merging gives the same sample.
+    auto config2 = make_config(_1 = uniform<int>(0, 99), _seed = 5u, _test_count = 2000u,
+                               _failure_sink = sample_failures(16));
+    auto parallel = qcheck_parallel(prop, config2, 4);
+    BOOST_CHECK_EQUAL(parallel.failure_count(), all.failure_count());
+    BOOST_REQUIRE_EQUAL(parallel.failures().size(), 16u);
+    BOOST_CHECK_EQUAL(parallel.failures()[0].case_index(), all.failures()[0].case_index());
+    std::vector<std::size_t> merged = kept(parallel);
+    BOOST_CHECK(std::set<std::size_t>(merged.begin(), merged.end()) ==
+                std::set<std::size_t>(expected.begin(), expected.end()));
+}
+
+// stream_failures() passes every failure on as it is found.
+void test_stream()
+{
+    using namespace qchk;
+    auto prop = _1 % 3 != 0;
+    auto config = make_config(_1 = uniform<int>(0, 99), _seed = 3u, _test_count = 300u);
+    auto all = qcheck(prop, config);
+
+    std::vector<std::size_t> indices;
+    std::vector<std::string> args;
+    auto config1 = make_config(_1 = uniform<int>(0, 99), _seed = 3u, _test_count = 300u,
+        _failure_sink = stream_failures([&](std::size_t case_index, std::string const &str)
+        {
+            indices.push_back(case_index);
+            args.push_back(str);
+        }));
+    auto streamed = qcheck_batched(prop, config1, 64);
+    BOOST_CHECK_EQUAL(streamed.failures().size(), 1u);
+    BOOST_CHECK(indices == kept(all));
+    BOOST_REQUIRE(!args.empty());
+    std::stringstream first;
+    first << all.failures()[0];
+    BOOST_CHECK_EQUAL(args[0], first.str());
+
+    std::stringstream sout;
+    auto config2 = make_config(_1 = uniform<int>(0, 99), _seed = 3u, _test_count = 300u,
+                               _failure_sink = stream_failures(sout, keep_first_failures(5)));
+    auto res = qcheck_parallel(prop, config2, 3);
+    BOOST_CHECK_EQUAL(res.failure_count(), all.failure_count());
+    BOOST_CHECK_EQUAL(res.failures().size(), 5u);
+    std::string const str = sout.str();
+    BOOST_CHECK_EQUAL(std::size_t(std::count(str.begin(), str.end(), '\n')), all.failure_count());
+    BOOST_CHECK(str.find("Failure in test case ") == 0);
+
+    // Arguments that can't be written to a std::ostream are streamed as
+    // empty strings.
+    std::vector<std::string> empty;
+    auto config3 = make_config(_1 = vector(uniform<int>(0, 9)), _seed = 3u,
+        _failure_sink = stream_failures([&](std::size_t, std::string const &str)
+        {
+            empty.push_back(str);
+        }));
+    auto res3 = qcheck(boost::phoenix::size(_1) < 5u, config3);
+    BOOST_CHECK_EQUAL(empty.size(), res3.failure_count());
+    BOOST_CHECK(std::count(empty.begin(), empty.end(), std::string()) == std::ptrdiff_t(empty.size()));
+}
+
+using namespace boost::unit_test;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("tests for the failure sinks");
+
+    test->add(BOOST_TEST_CASE(&test_keep_first));
+    test->add(BOOST_TEST_CASE(&test_sample));
+    test->add(BOOST_TEST_CASE(&test_stream));
+
+    return test;
+}
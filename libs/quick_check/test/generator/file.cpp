@@ -0,0 +1,139 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file file.cpp
+/// \brief A test for the file generator
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <vector>
+#include <fstream>
+#include <stdexcept>
+#include <boost/quick_check/quick_check.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace qchk = boost::quick_check;
+
+// Write the doubles 0, 0.1, ..., (n-1)/10 to a binary file.
+void write_binary(char const *path, std::size_t n)
+{
+    std::ofstream out(path, std::ios::binary);
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        double const d = i / 10.0;
+        out.write(reinterpret_cast<char const *>(&d), sizeof(d));
+    }
+}
+
+// The values come out in order, exactly, and start again after the last.
+void test_file_binary()
+{
+    char const *const path = "file_test_binary.bin";
+    write_binary(path, 10);
+    boost::random::mt11213b rng;
+    qchk::file_generator<double> gen(path);
+    BOOST_CHECK_EQUAL(gen.size(), 10u);
+    for(std::size_t i = 0; i < 25; ++i)
+        BOOST_CHECK(gen(rng) == (i % 10) / 10.0);
+    BOOST_CHECK_EQUAL(gen.position(), 5u);
+
+    // Copies have their own positions.
+    qchk::file_generator<double> copy = gen;
+    BOOST_CHECK(copy(rng) == 0.5);
+    BOOST_CHECK(copy(rng) == 0.6);
+    BOOST_CHECK(gen(rng) == 0.5);
+
+    // In bulk, across the end
+    gen.seek(18);
+    std::vector<double> vals(7);
+    qchk::generate_n(gen, rng, vals.begin(), vals.size());
+    for(std::size_t i = 0; i < vals.size(); ++i)
+        BOOST_CHECK(vals[i] == ((8 + i) % 10) / 10.0);
+
+    // Arrays are made of consecutive values; the last partial one is ignored.
+    qchk::file_generator<double[3]> agen(path);
+    BOOST_CHECK_EQUAL(agen.size(), 3u);
+    agen(rng);
+    auto arr = agen(rng);
+    BOOST_CHECK(arr[0] == 0.3 && arr[1] == 0.4 && arr[2] == 0.5);
+    arr = agen(rng);
+    arr = agen(rng);
+    BOOST_CHECK(arr[0] == 0.0);
+    std::remove(path);
+}
+
+// Text files are parsed once; their values are the ones operator>> reads.
+void test_file_text()
+{
+    boost::random::mt11213b rng;
+    qchk::file_generator<int> gen("uniform_int_distribution.txt", qchk::text_file);
+    BOOST_CHECK_EQUAL(gen.size(), 10000u);
+    BOOST_CHECK_EQUAL(gen(rng), 1866415935);
+    BOOST_CHECK_EQUAL(gen(rng), -267902603);
+
+    qchk::file_generator<int[3]> agen("uniform_int_distribution.txt", qchk::text_file);
+    BOOST_CHECK_EQUAL(agen.size(), 3333u);
+    auto arr = agen(rng);
+    BOOST_CHECK_EQUAL(arr[2], 1526131445);
+}
+
+// Bad files are refused.
+void test_file_errors()
+{
+    char const *const path = "file_test_errors.bin";
+    std::remove(path);
+    BOOST_CHECK_THROW(qchk::file_generator<int>(path).size(), std::runtime_error);
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "abc";
+    }
+    BOOST_CHECK_THROW(qchk::file_generator<int>(path).size(), std::runtime_error);
+    BOOST_CHECK_THROW(qchk::file_generator<int>(path, qchk::text_file).size(), std::runtime_error);
+    BOOST_CHECK_THROW(qchk::file_generator<char[4]>(path).size(), std::runtime_error);
+    std::remove(path);
+}
+
+// The shards of qcheck_parallel() see the values qcheck() sees, each
+// value with the same test case.
+void test_file_parallel()
+{
+    using namespace qchk;
+    char const *const path = "file_test_parallel.bin";
+    write_binary(path, 1000);
+    file_generator<double> gen(path);
+    auto prop = _1 * 10.0 < 900.0 || _1 * 10.0 > 950.0;
+
+    auto config1 = make_config(_1 = gen, _test_count = 1000u);
+    auto res1 = qcheck(prop, config1);
+    BOOST_REQUIRE_EQUAL(res1.failure_count(), 51u);
+
+    auto config2 = make_config(_1 = gen, _test_count = 1000u);
+    auto res2 = qcheck_parallel(prop, config2, 3);
+    BOOST_CHECK_EQUAL(res2.test_count(), 1000u);
+    BOOST_REQUIRE_EQUAL(res2.failure_count(), 51u);
+    for(auto const &failure : res2.failures())
+        BOOST_CHECK(fusion::at_c<0>(failure) == failure.case_index() / 10.0);
+    std::remove(path);
+}
+
+using namespace boost::unit_test;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("basic tests for file generator");
+
+    test->add(BOOST_TEST_CASE(&test_file_binary));
+    test->add(BOOST_TEST_CASE(&test_file_text));
+    test->add(BOOST_TEST_CASE(&test_file_errors));
+    test->add(BOOST_TEST_CASE(&test_file_parallel));
+
+    return test;
+}
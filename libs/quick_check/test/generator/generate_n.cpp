@@ -0,0 +1,184 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file generate_n.cpp
+/// \brief A test for the bulk generation of values with generate_n
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <cctype>
+#include <limits>
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/quick_check/quick_check.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace qchk = boost::quick_check;
+
+// A generator without a generate_n overload
+struct counter_t
+{
+    typedef int result_type;
+
+    counter_t()
+      : i_(0)
+    {}
+
+    template<typename Rng>
+    int operator()(Rng &)
+    {
+        return i_++;
+    }
+
+private:
+    int i_;
+};
+
+template<typename Integral, typename Rng>
+void check_uniform_integral(Rng &rng, Integral min, Integral max)
+{
+    qchk::uniform<Integral> ui(min, max);
+    std::vector<Integral> v(1000);
+    auto end = qchk::generate_n(ui, rng, v.begin(), v.size());
+    BOOST_CHECK(end == v.end());
+    BOOST_CHECK_GE(*std::min_element(v.begin(), v.end()), min);
+    BOOST_CHECK_LE(*std::max_element(v.begin(), v.end()), max);
+}
+
+void test_generate_n_uniform()
+{
+    boost::random::mt11213b rng;
+    boost::random::mt19937_64 rng64;
+    boost::random::minstd_rand rng31;
+
+    check_uniform_integral<int>(rng, 1, 6);
+    check_uniform_integral<int>(rng, -1000, 1000);
+    check_uniform_integral<int>(rng, (std::numeric_limits<int>::min)(),
+                                     (std::numeric_limits<int>::max)());
+    check_uniform_integral<long long>(rng, -(1ll << 40), 1ll << 40);
+    check_uniform_integral<unsigned char>(rng, 'a', 'z');
+    check_uniform_integral<int>(rng64, -5, 5);
+    check_uniform_integral<int>(rng31, -5, 5);
+
+    // Every value of a small range is generated about equally often
+    qchk::uniform<int> die(1, 6);
+    std::vector<int> rolls(60000);
+    qchk::generate_n(die, rng, rolls.begin(), rolls.size());
+    for(int i = 1; i <= 6; ++i)
+    {
+        std::ptrdiff_t const n = std::count(rolls.begin(), rolls.end(), i);
+        BOOST_CHECK_GT(n, 9000);
+        BOOST_CHECK_LT(n, 11000);
+    }
+
+    qchk::uniform<double> ud(-1., 1.);
+    std::vector<double> d(1000);
+    qchk::generate_n(ud, rng, d.begin(), d.size());
+    BOOST_CHECK_GE(*std::min_element(d.begin(), d.end()), -1.);
+    BOOST_CHECK_LT(*std::max_element(d.begin(), d.end()), 1.);
+
+    // Arrays are generated in bulk
+    qchk::uniform<int[3]> aui(1, 6);
+    qchk::detail::array<int[3]> ai = aui(rng);
+    for(int i : ai.elems)
+    {
+        BOOST_CHECK_GE(i, 1);
+        BOOST_CHECK_LE(i, 6);
+    }
+}
+
+void test_generate_n_others()
+{
+    boost::random::mt11213b rng;
+
+    auto c = qchk::constant(42);
+    std::vector<int> v;
+    qchk::generate_n(c, rng, std::back_inserter(v), 10);
+    BOOST_CHECK_EQUAL(v.size(), 10u);
+    BOOST_CHECK_EQUAL(std::count(v.begin(), v.end(), 42), 10);
+
+    auto lower = qchk::lower();
+    std::string s;
+    qchk::generate_n(lower, rng, std::back_inserter(s), 1000);
+    BOOST_CHECK_EQUAL(s.size(), 1000u);
+    for(char ch : s)
+        BOOST_CHECK(std::islower((unsigned char)ch));
+    BOOST_CHECK_EQUAL(*std::min_element(s.begin(), s.end()), 'a');
+    BOOST_CHECK_EQUAL(*std::max_element(s.begin(), s.end()), 'z');
+
+    auto twice = qchk::transform(
+        qchk::uniform<int>(1, 6)
+      , qchk::detail::make_unary([](int i) { return i * 2; })
+    );
+    v.clear();
+    qchk::generate_n(twice, rng, std::back_inserter(v), 100);
+    BOOST_CHECK_EQUAL(v.size(), 100u);
+    for(int i : v)
+    {
+        BOOST_CHECK_EQUAL(i % 2, 0);
+        BOOST_CHECK_GE(i, 2);
+        BOOST_CHECK_LE(i, 12);
+    }
+
+    // Generators without a generate_n overload are called n times
+    counter_t cnt;
+    v.clear();
+    qchk::generate_n(cnt, rng, std::back_inserter(v), 5);
+    BOOST_CHECK(v == std::vector<int>({0, 1, 2, 3, 4}));
+
+    // Sequences are generated in bulk
+    auto rgdie = qchk::vector(qchk::uniform<int>(1, 6));
+    for(int i = 0; i < 10; ++i)
+    {
+        std::vector<int> r = rgdie(rng);
+        for(int j : r)
+        {
+            BOOST_CHECK_GE(j, 1);
+            BOOST_CHECK_LE(j, 6);
+        }
+    }
+}
+
+void test_generate_n_config()
+{
+    using namespace qchk;
+    uniform<int> di(1, 6);
+    counter_t cnt;
+
+    auto config = make_config(_1 = di, _2 = _1, _3 = cnt);
+    decltype(config)::columns_type columns;
+    config.generate(columns, 100);
+    BOOST_CHECK_EQUAL(config.next_case(), 100u);
+    BOOST_REQUIRE_EQUAL(boost::fusion::at_c<0>(columns).size(), 100u);
+    BOOST_REQUIRE_EQUAL(boost::fusion::at_c<1>(columns).size(), 100u);
+    BOOST_REQUIRE_EQUAL(boost::fusion::at_c<2>(columns).size(), 100u);
+    for(std::size_t i = 0; i < 100; ++i)
+    {
+        BOOST_CHECK_GE(boost::fusion::at_c<0>(columns)[i], 1);
+        BOOST_CHECK_LE(boost::fusion::at_c<1>(columns)[i], 6);
+        BOOST_CHECK_EQUAL(boost::fusion::at_c<2>(columns)[i], int(i));
+    }
+}
+
+using namespace boost::unit_test;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("tests for generate_n");
+
+    test->add(BOOST_TEST_CASE(&test_generate_n_uniform));
+    test->add(BOOST_TEST_CASE(&test_generate_n_others));
+    test->add(BOOST_TEST_CASE(&test_generate_n_config));
+
+    return test;
+}
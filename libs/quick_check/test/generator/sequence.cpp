@@ -16,7 +16,6 @@
 #include <vector>
 #include <boost/quick_check/quick_check.hpp>
 #include <boost/test/unit_test.hpp>
-#include "../file_dist.hpp"
 
 static const std::size_t CLOOPS = 128;
 
@@ -26,7 +25,7 @@ void test_sequence()
 {
     boost::random::mt11213b rng;
 
-    file_dist<int> igen("uniform_int_distribution.txt");
+    qchk::file_generator<int> igen("uniform_int_distribution.txt", qchk::text_file);
     auto die = qchk::transform(
         igen
       , qchk::detail::make_unary([](int i){return std::abs(i)%6 + 1;})
@@ -50,8 +49,8 @@ void test_ordered_sequence()
 {
     boost::random::mt11213b rng;
 
-    file_dist<int> igen("uniform_int_distribution.txt");
-    file_dist<double> dgen("normal_double_distribution.txt");
+    qchk::file_generator<int> igen("uniform_int_distribution.txt", qchk::text_file);
+    qchk::file_generator<double> dgen("normal_double_distribution.txt", qchk::text_file);
     auto dpos = qchk::transform(
         dgen
       , qchk::detail::make_unary([](double d){return std::abs(d);})
@@ -77,6 +76,54 @@ void test_ordered_sequence()
     }
 }
 
+void test_generate_into()
+{
+    using namespace qchk;
+    boost::random::mt11213b rng1, rng2;
+
+    // Generating in place gives the sequences operator() would have.
+    auto rgint = vector(uniform<int>(0, 9));
+    auto rgint2 = rgint;
+    detail::set_size_adl(rgint, 50);
+    detail::set_size_adl(rgint2, 50);
+    std::vector<int> v;
+    v.reserve(50);
+    int const *const data = v.data();
+    for(std::size_t i = 0; i < CLOOPS; ++i)
+    {
+        generate_into(rgint, rng1, v);
+        BOOST_CHECK(v == rgint2(rng2));
+    }
+    // ... into the same storage.
+    BOOST_CHECK(v.data() == data);
+
+    auto rgsorted = ordered_vector(uniform<int>(0, 9));
+    for(std::size_t i = 0; i < CLOOPS; ++i)
+    {
+        generate_into(rgsorted, rng1, v);
+        BOOST_CHECK(std::is_sorted(v.begin(), v.end()));
+    }
+
+    auto rgstr = string();
+    std::string str(49, 'x');
+    char const *const chars = str.data();
+    for(std::size_t i = 0; i < CLOOPS; ++i)
+    {
+        generate_into(rgstr, rng1, str);
+        BOOST_CHECK_LT(str.size(), 50u);
+    }
+    BOOST_CHECK(str.data() == chars);
+
+    // qcheck() generates each test case into the last one's vector.
+    auto config = make_config(_1 = vector(uniform<double>(0, 1)), _sized = 50u);
+    auto args = config();
+    fusion::at_c<0>(args).reserve(50);
+    double const *const doubles = fusion::at_c<0>(args).data();
+    for(std::size_t i = 0; i < CLOOPS; ++i)
+        config(args);
+    BOOST_CHECK(fusion::at_c<0>(args).data() == doubles);
+}
+
 using namespace boost::unit_test;
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // init_unit_test_suite
@@ -87,6 +134,7 @@ test_suite* init_unit_test_suite( int argc, char* argv[] )
 
     test->add(BOOST_TEST_CASE(&test_sequence));
     test->add(BOOST_TEST_CASE(&test_ordered_sequence));
+    test->add(BOOST_TEST_CASE(&test_generate_into));
 
     return test;
 }
@@ -19,7 +19,6 @@
 #include <boost/quick_check/quick_check.hpp>
 #include <boost/range/algorithm/find_if.hpp>
 #include <boost/test/unit_test.hpp>
-#include "../file_dist.hpp"
 
 static const std::size_t CLOOPS = 128;
 
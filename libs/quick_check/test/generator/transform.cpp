@@ -14,7 +14,6 @@
 #include <cmath>
 #include <boost/quick_check/quick_check.hpp>
 #include <boost/test/unit_test.hpp>
-#include "../file_dist.hpp"
 
 static const std::size_t CLOOPS = 128;
 
@@ -22,7 +21,7 @@ namespace qchk = boost::quick_check;
 
 void test_transform()
 {
-    file_dist<int> igen("uniform_int_distribution.txt");
+    qchk::file_generator<int> igen("uniform_int_distribution.txt", qchk::text_file);
     auto gen = qchk::transform(
         igen
       , qchk::detail::make_unary([](int i){return std::abs(i)%6 + 1;})
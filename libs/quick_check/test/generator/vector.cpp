@@ -14,7 +14,6 @@
 #include <cmath>
 #include <boost/quick_check/quick_check.hpp>
 #include <boost/test/unit_test.hpp>
-#include "../file_dist.hpp"
 
 static const std::size_t CLOOPS = 128;
 
@@ -24,7 +23,7 @@ void test_vector()
 {
     boost::random::mt11213b rng;
 
-    file_dist<int> igen("uniform_int_distribution.txt");
+    qchk::file_generator<int> igen("uniform_int_distribution.txt", qchk::text_file);
     auto die = qchk::transform(
         igen
       , qchk::detail::make_unary([](int i){return std::abs(i)%6 + 1;})
@@ -48,8 +47,8 @@ void test_ordered_vector()
 {
     boost::random::mt11213b rng;
 
-    file_dist<int> igen("uniform_int_distribution.txt");
-    file_dist<double> dgen("normal_double_distribution.txt");
+    qchk::file_generator<int> igen("uniform_int_distribution.txt", qchk::text_file);
+    qchk::file_generator<double> dgen("normal_double_distribution.txt", qchk::text_file);
     auto dpos = qchk::transform(
         dgen
       , qchk::detail::make_unary([](double d){return std::abs(d);})
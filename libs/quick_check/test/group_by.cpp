@@ -14,7 +14,6 @@
 #include <sstream>
 #include <boost/quick_check/quick_check.hpp>
 #include <boost/test/unit_test.hpp>
-#include "./file_dist.hpp"
 
 static const std::size_t CLOOPS = 128;
 
@@ -23,8 +22,8 @@ namespace qchk = boost::quick_check;
 void test_group_by_auto_1()
 {
     using namespace qchk;
-    file_dist<int> di("uniform_int_distribution.txt");
-    file_dist<double> dd("normal_double_distribution.txt");
+    qchk::file_generator<int> di("uniform_int_distribution.txt", qchk::text_file);
+    qchk::file_generator<double> dd("normal_double_distribution.txt", qchk::text_file);
 
     // a quickCheck configuration. Placeholders _1
     // and _2 receive values generated from die and one:
@@ -62,8 +61,8 @@ void test_group_by_auto_1()
 void test_group_by_prop_1()
 {
     using namespace qchk;
-    file_dist<int> di("uniform_int_distribution.txt");
-    file_dist<double> dd("normal_double_distribution.txt");
+    qchk::file_generator<int> di("uniform_int_distribution.txt", qchk::text_file);
+    qchk::file_generator<double> dd("normal_double_distribution.txt", qchk::text_file);
 
     // a quickCheck configuration. Placeholders _1
     // and _2 receive values generated from die and one:
@@ -14,7 +14,6 @@
 #include <sstream>
 #include <boost/quick_check/quick_check.hpp>
 #include <boost/test/unit_test.hpp>
-#include "./file_dist.hpp"
 
 namespace qchk = boost::quick_check;
 namespace phx = boost::phoenix;
@@ -45,7 +44,7 @@ void test_property_1()
 void test_property_2()
 {
     using namespace qchk;
-    file_dist<int> di("uniform_int_distribution.txt");
+    qchk::file_generator<int> di("uniform_int_distribution.txt", qchk::text_file);
 
     property<int> prop2 = _1 == 1866415935;
     auto config = make_config(_1 = di);
@@ -83,8 +82,8 @@ void test_property_4()
 void test_property_5()
 {
     using namespace qchk;
-    file_dist<int> di("uniform_int_distribution.txt");
-    file_dist<double> dd("normal_double_distribution.txt");
+    qchk::file_generator<int> di("uniform_int_distribution.txt", qchk::text_file);
+    qchk::file_generator<double> dd("normal_double_distribution.txt", qchk::text_file);
 
     property<int, double, grouped_by<int> > prop2 =
         _1 == _2 >>=
@@ -117,6 +116,44 @@ void test_property_5()
     BOOST_CHECK_EQUAL(prop2.grouper()(args2), -1);
 }
 
+// A property<> evaluates each test case with one call, and gets the same
+// results as the expression it was made from.
+void test_property_6()
+{
+    using namespace qchk;
+    qchk::file_generator<int> di("uniform_int_distribution.txt", qchk::text_file);
+    qchk::file_generator<double> dd("normal_double_distribution.txt", qchk::text_file);
+
+    auto expr =
+        _1 % 5 != 0 >>=
+            group_by(_1 % 3)
+              | classify(_1 % 3 == 0, "multiple of 3")
+              | classify(_2 < 0.0, "_2 negative")
+              | (_1 < 1000000000);
+    property<int, double, grouped_by<int> > prop = expr;
+
+    detail::case_outcome<int> outcome;
+    fusion::vector2<int, double> args(-4, -1.0);
+    BOOST_REQUIRE(prop.evaluator()(args, outcome));
+    BOOST_CHECK(outcome.passed);
+    BOOST_CHECK_EQUAL(outcome.classes, 2u);
+    BOOST_CHECK_EQUAL(outcome.group.get(), -1);
+    fusion::vector2<int, double> args2(10, 1.0);
+    BOOST_CHECK(!prop.evaluator()(args2, outcome));
+
+    // The distributions share their file position, so each config gets
+    // its own.
+    qchk::file_generator<int> di2("uniform_int_distribution.txt", qchk::text_file);
+    qchk::file_generator<double> dd2("normal_double_distribution.txt", qchk::text_file);
+    auto config1 = make_config(_1 = di, _2 = dd);
+    auto config2 = make_config(_1 = di2, _2 = dd2);
+    std::stringstream sout1, sout2;
+    qcheck(expr, config1).print_summary(sout1);
+    qcheck(prop, config2).print_summary(sout2);
+    BOOST_CHECK_EQUAL(sout1.str(), sout2.str());
+    BOOST_CHECK_NE(sout1.str().find("multiple of 3"), std::string::npos);
+}
+
 using namespace boost::unit_test;
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // init_unit_test_suite
@@ -131,6 +168,7 @@ test_suite* init_unit_test_suite( int argc, char* argv[] )
     test->add(BOOST_TEST_CASE(&test_property_3));
     test->add(BOOST_TEST_CASE(&test_property_4));
     test->add(BOOST_TEST_CASE(&test_property_5));
+    test->add(BOOST_TEST_CASE(&test_property_6));
 
     return test;
 }
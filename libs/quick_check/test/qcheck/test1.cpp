@@ -14,7 +14,6 @@
 #include <sstream>
 #include <boost/quick_check/quick_check.hpp>
 #include <boost/test/unit_test.hpp>
-#include "../file_dist.hpp"
 #include "../utility.hpp"
 
 namespace qchk = boost::quick_check;
@@ -24,7 +23,8 @@ namespace phx = boost::phoenix;
 void test_qcheck_false_auto_1()
 {
     using namespace qchk;
-    file_dist<int> di(qcheck_test::abs_test_root("uniform_int_distribution.txt"));
+    qchk::file_generator<int> di(qcheck_test::abs_test_root("uniform_int_distribution.txt"),
+                                 qchk::text_file);
 
     auto const prop2 = _1 == 1866415935;
     auto config = make_config(_1 = di);
@@ -41,7 +41,8 @@ void test_qcheck_false_auto_1()
 void test_qcheck_false_prop_1()
 {
     using namespace qchk;
-    file_dist<int> di(qcheck_test::abs_test_root("uniform_int_distribution.txt"));
+    qchk::file_generator<int> di(qcheck_test::abs_test_root("uniform_int_distribution.txt"),
+                                 qchk::text_file);
 
     property<int> const prop2 = _1 == 1866415935;
     auto config = make_config(_1 = di);
@@ -0,0 +1,183 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file qcheck/test10.cpp
+/// \brief A test of the qcheck algorithms on enumerated domains, and of the domain_size and
+///        enumerate customization points
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <set>
+#include <utility>
+#include <boost/quick_check/quick_check.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace qchk = boost::quick_check;
+
+// The built-in generators of small domains list each of their values once.
+void test_domains()
+{
+    using namespace qchk;
+    uniform<int> die(1, 6);
+    BOOST_CHECK_EQUAL(domain_size(die), 6u);
+    int i = 0;
+    enumerate(die, 0, i);
+    BOOST_CHECK_EQUAL(i, 1);
+    enumerate(die, 5, i);
+    BOOST_CHECK_EQUAL(i, 6);
+
+    BOOST_CHECK_EQUAL(domain_size(uniform<signed char>(-128, 127)), 256u);
+    BOOST_CHECK_EQUAL(domain_size(uniform<double>(0, 1)), 0u);
+    BOOST_CHECK_EQUAL(domain_size(uniform<boost::uint64_t>()), 0u);
+
+    auto d = digit();
+    BOOST_CHECK_EQUAL(domain_size(d), 10u);
+    char c = 0;
+    enumerate(d, 3, c);
+    BOOST_CHECK_EQUAL(c, '3');
+
+    auto z = zip(uniform<int>(0, 1), alpha());
+    BOOST_CHECK_EQUAL(domain_size(z), 104u);
+    std::set<std::pair<int, char> > pairs;
+    for(std::size_t j = 0; j < domain_size(z); ++j)
+    {
+        std::pair<int, char> p;
+        enumerate(z, j, p);
+        pairs.insert(p);
+    }
+    BOOST_CHECK_EQUAL(pairs.size(), 104u);
+
+    uniform<int[3]> dice(1, 6);
+    BOOST_CHECK_EQUAL(domain_size(dice), 216u);
+    BOOST_CHECK_EQUAL(domain_size(constant(42)), 1u);
+    BOOST_CHECK_EQUAL(domain_size(vector(uniform<int>(0, 1))), 0u);
+}
+
+// A domain that fits in _test_count is tested once, in full.
+void test_exhaustive()
+{
+    using namespace qchk;
+    auto config = make_config(_1 = uniform<int>(1, 6), _2 = digit(), _exhaustive = true);
+    BOOST_CHECK_EQUAL(config.domain_size(), 60u);
+    BOOST_CHECK_EQUAL(config.enumerated(), 60u);
+
+    std::set<std::pair<int, char> > seen;
+    auto res = qcheck(_1 + _2 != 6 + '9', config);
+    BOOST_CHECK(!res);
+    BOOST_CHECK(!res.exhausted());
+    BOOST_CHECK_EQUAL(res.test_count(), 60u);
+    BOOST_CHECK_EQUAL(res.failure_count(), 1u);
+    BOOST_REQUIRE_EQUAL(res.failures().size(), 1u);
+    BOOST_CHECK_EQUAL(fusion::at_c<0>(res.failures()[0]), 6);
+    BOOST_CHECK_EQUAL(fusion::at_c<1>(res.failures()[0]), '9');
+    BOOST_CHECK_EQUAL(res.failures()[0].case_index(), 59u);
+
+    // Every test case can be regenerated from its index.
+    for(std::size_t i = 0; i < 60; ++i)
+    {
+        auto args = config(i);
+        seen.insert(std::make_pair(fusion::at_c<0>(args), fusion::at_c<1>(args)));
+    }
+    BOOST_CHECK_EQUAL(seen.size(), 60u);
+
+    // A condition rejects test cases, but doesn't exhaust the input.
+    auto config2 = make_config(_1 = uniform<int>(1, 6), _2 = uniform<int>(1, 6)
+                             , _exhaustive = true);
+    auto res2 = qcheck(_1 < _2 >>= _1 < _2, config2);
+    BOOST_CHECK(res2);
+    BOOST_CHECK(!res2.exhausted());
+    BOOST_CHECK_EQUAL(res2.test_count(), 15u);
+
+    // Enumerated test cases draw nothing from the random number generator,
+    // so the sampled ones after them are those of a sampling config.
+    auto config3 = make_config(_1 = uniform<int>(1, 1000), _2 = uniform<int>(1, 1000)
+                             , _exhaustive = true, _test_count = 1000000u);
+    auto sampling = make_config(_1 = uniform<int>(1, 1000), _2 = uniform<int>(1, 1000));
+    BOOST_REQUIRE_EQUAL(config3.enumerated(), 1000000u);
+    for(std::size_t i = 0; i < 1000000u; ++i)
+        config3();
+    for(int i = 0; i < 3; ++i)
+        BOOST_CHECK(config3() == sampling());
+}
+
+// Domains that are too large, or can't be counted, are sampled.
+void test_sampled()
+{
+    using namespace qchk;
+    auto config = make_config(_1 = uniform<int>(1, 1000), _exhaustive = true);
+    BOOST_CHECK_EQUAL(config.domain_size(), 1000u);
+    BOOST_CHECK_EQUAL(config.enumerated(), 0u);
+    auto res = qcheck(_1 >= 1, config);
+    BOOST_CHECK_EQUAL(res.test_count(), 100u);
+
+    auto config2 = make_config(_1 = uniform<int>(1, 6), _2 = normal<double>()
+                             , _exhaustive = true);
+    BOOST_CHECK_EQUAL(config2.domain_size(), 0u);
+    auto res2 = qcheck(_1 >= 1, config2);
+    BOOST_CHECK_EQUAL(res2.test_count(), 100u);
+
+    // Without _exhaustive, small domains are sampled too.
+    auto config3 = make_config(_1 = uniform<int>(1, 6));
+    BOOST_CHECK_EQUAL(config3.enumerated(), 0u);
+    auto res3 = qcheck(_1 >= 1, config3);
+    BOOST_CHECK_EQUAL(res3.test_count(), 100u);
+
+    // Once its domain has been enumerated, a config samples.
+    auto config4 = make_config(_1 = uniform<int>(1, 6), _exhaustive = true);
+    BOOST_CHECK_EQUAL(qcheck(_1 >= 1, config4).test_count(), 6u);
+    BOOST_CHECK_EQUAL(qcheck(_1 >= 1, config4).test_count(), 100u);
+}
+
+// The other algorithms enumerate the same test cases.
+void test_other_algorithms()
+{
+    using namespace qchk;
+    auto config = make_config(_1 = uniform<int>(0, 9), _2 = uniform<int>(0, 9)
+                            , _exhaustive = true);
+    auto res = qcheck_batched(_1 + _2 != 18, config, 16);
+    BOOST_CHECK_EQUAL(res.test_count(), 100u);
+    BOOST_CHECK_EQUAL(res.failure_count(), 1u);
+    BOOST_REQUIRE_EQUAL(res.failures().size(), 1u);
+    BOOST_CHECK_EQUAL(res.failures()[0].case_index(), 99u);
+
+    auto config2 = make_config(_1 = uniform<int>(0, 9), _2 = uniform<int>(0, 9)
+                             , _exhaustive = true, _seed = 3u);
+    auto res2 = qcheck_batched(_1 + _2 != 18, config2, 16);
+    BOOST_CHECK_EQUAL(res2.test_count(), 100u);
+    BOOST_CHECK_EQUAL(res2.failure_count(), 1u);
+
+    auto config3 = make_config(_1 = uniform<int>(0, 9), _2 = uniform<int>(0, 9)
+                             , _exhaustive = true);
+    auto res3 = qcheck_parallel(_1 + _2 != 18, config3, 3);
+    BOOST_CHECK_EQUAL(res3.test_count(), 100u);
+    BOOST_CHECK_EQUAL(res3.failure_count(), 1u);
+    BOOST_CHECK(!res3.exhausted());
+
+    // More threads than test cases
+    auto config4 = make_config(_1 = uniform<int>(1, 3), _test_count = 8u
+                             , _exhaustive = true);
+    auto res4 = qcheck_parallel(_1 != 2, config4, 8);
+    BOOST_CHECK_EQUAL(res4.test_count(), 3u);
+    BOOST_CHECK_EQUAL(res4.failure_count(), 1u);
+}
+
+using namespace boost::unit_test;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("tests for the qcheck algorithms on enumerated domains");
+
+    test->add(BOOST_TEST_CASE(&test_domains));
+    test->add(BOOST_TEST_CASE(&test_exhaustive));
+    test->add(BOOST_TEST_CASE(&test_sampled));
+    test->add(BOOST_TEST_CASE(&test_other_algorithms));
+
+    return test;
+}
@@ -0,0 +1,167 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file qcheck/test11.cpp
+/// \brief A test of the qcheck algorithms skipping duplicate test cases
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <set>
+#include <chrono>
+#include <vector>
+#include <sstream>
+#include <utility>
+#include <boost/quick_check/quick_check.hpp>
+#include <boost/phoenix/bind/bind_function.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace qchk = boost::quick_check;
+namespace phx = boost::phoenix;
+
+std::vector<std::pair<int, char> > tested;
+
+bool record(int i, char c)
+{
+    tested.push_back(std::make_pair(i, c));
+    return true;
+}
+
+std::size_t distinct_tested()
+{
+    return std::set<std::pair<int, char> >(tested.begin(), tested.end()).size();
+}
+
+// Coverage that never reaches anything
+struct no_coverage
+{
+    void clear() {}
+    std::size_t size() const { return 0; }
+    unsigned char const *counters() const { return 0; }
+};
+
+// Each set of arguments is tested at most once.
+void test_dedupe()
+{
+    using namespace qchk;
+    tested.clear();
+    auto config = make_config(_1 = uniform<int>(1, 6), _2 = digit(), _dedupe = true);
+    BOOST_CHECK(config.dedupe());
+    auto res = qcheck(phx::bind(&record, _1, _2), config);
+    BOOST_CHECK(res);
+    BOOST_CHECK_EQUAL(res.test_count(), tested.size());
+    BOOST_CHECK_EQUAL(distinct_tested(), tested.size());
+    BOOST_CHECK(res.test_count() > 50u);
+    BOOST_CHECK(res.test_count() <= 60u);
+
+    // Duplicates count towards _max_test_count, so the domain runs out.
+    BOOST_CHECK(res.exhausted());
+    BOOST_CHECK_EQUAL(res.test_count() + res.duplicate_count(), config.max_test_count());
+    BOOST_CHECK_EQUAL(config.next_case(), config.max_test_count());
+
+    std::ostringstream sout;
+    res.print_summary(sout);
+    BOOST_CHECK(sout.str().find("duplicate test cases") != std::string::npos);
+
+    // Without _dedupe, nothing is skipped.
+    auto config2 = make_config(_1 = uniform<int>(1, 6), _2 = digit());
+    BOOST_CHECK(!config2.dedupe());
+    auto res2 = qcheck(_1 >= 1, config2);
+    BOOST_CHECK_EQUAL(res2.test_count(), 100u);
+    BOOST_CHECK_EQUAL(res2.duplicate_count(), 0u);
+}
+
+// Large domains have few duplicates, and few new arguments are mistaken for
+// them.
+void test_large_domain()
+{
+    using namespace qchk;
+    auto config = make_config(_1 = uniform<int>(), _2 = vector(digit())
+                            , _test_count = 1000u, _dedupe = true);
+    auto res = qcheck(_1 == _1, config);
+    BOOST_CHECK(res);
+    BOOST_CHECK(!res.exhausted());
+    BOOST_CHECK_EQUAL(res.test_count(), 1000u);
+    BOOST_CHECK(res.duplicate_count() < 50u);
+
+    // Failures are still found and shrunk.
+    auto config2 = make_config(_1 = uniform<int>(0, 100), _dedupe = true);
+    auto res2 = qcheck(_1 < 50, config2);
+    BOOST_CHECK(!res2);
+    BOOST_CHECK(res2.failure_count() <= 51u);
+    BOOST_CHECK_EQUAL(fusion::at_c<0>(res2.smallest_failure()), 50);
+}
+
+// Only the arguments that were tested are remembered, so a selective
+// condition doesn't fill the filter with rejected ones, and the filter
+// grows when a time budget runs more tests than _test_count.
+void test_filter_capacity()
+{
+    using namespace qchk;
+    auto config = make_config(_1 = uniform<int>(0, 99999999), _dedupe = true
+                            , _max_test_count = 100000u);
+    auto res = qcheck(_1 % 50 == 0 >>= _1 >= 0, config);
+    BOOST_CHECK(res);
+    BOOST_CHECK(!res.exhausted());
+    BOOST_CHECK_EQUAL(res.test_count(), 100u);
+    BOOST_CHECK(res.duplicate_count() * 50 < config.next_case());
+
+    auto config2 = make_config(_1 = uniform<int>(), _2 = uniform<int>(), _dedupe = true
+                             , _time_budget = std::chrono::milliseconds(100));
+    auto res2 = qcheck(_1 == _1, config2);
+    BOOST_CHECK(res2);
+    BOOST_CHECK(res2.test_count() > 1000u);
+    BOOST_CHECK(res2.duplicate_count() * 50 < res2.test_count());
+}
+
+// The other algorithms skip duplicates too, or ignore _dedupe.
+void test_other_algorithms()
+{
+    using namespace qchk;
+    tested.clear();
+    no_coverage coverage;
+    auto config = make_config(_1 = uniform<int>(1, 6), _2 = digit(), _dedupe = true);
+    auto res = qcheck_guided(phx::bind(&record, _1, _2), config, coverage);
+    BOOST_CHECK_EQUAL(res.test_count(), tested.size());
+    BOOST_CHECK_EQUAL(distinct_tested(), tested.size());
+    BOOST_CHECK(res.duplicate_count() > 900u);
+
+    auto config2 = make_config(_1 = uniform<int>(1, 6), _2 = digit(), _dedupe = true);
+    auto res2 = qcheck_parallel(_1 >= 1, config2, 2);
+    BOOST_CHECK_EQUAL(res2.test_count(), 100u);
+    BOOST_CHECK(res2.duplicate_count() > 0u);
+    BOOST_CHECK(!res2.exhausted());
+
+    auto config3 = make_config(_1 = uniform<int>(1, 6), _2 = digit(), _dedupe = true);
+    auto res3 = qcheck_batched(_1 >= 1, config3, 16);
+    BOOST_CHECK_EQUAL(res3.test_count(), 100u);
+    BOOST_CHECK_EQUAL(res3.duplicate_count(), 0u);
+
+    // Enumerated domains have nothing to skip.
+    auto config4 = make_config(_1 = uniform<int>(1, 6), _2 = digit()
+                             , _exhaustive = true, _dedupe = true);
+    auto res4 = qcheck(_1 >= 1, config4);
+    BOOST_CHECK_EQUAL(res4.test_count(), 60u);
+    BOOST_CHECK_EQUAL(res4.duplicate_count(), 0u);
+    BOOST_CHECK(!res4.exhausted());
+}
+
+using namespace boost::unit_test;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("tests for the qcheck algorithms skipping duplicates");
+
+    test->add(BOOST_TEST_CASE(&test_dedupe));
+    test->add(BOOST_TEST_CASE(&test_large_domain));
+    test->add(BOOST_TEST_CASE(&test_filter_capacity));
+    test->add(BOOST_TEST_CASE(&test_other_algorithms));
+
+    return test;
+}
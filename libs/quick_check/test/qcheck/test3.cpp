@@ -14,7 +14,6 @@
 #include <sstream>
 #include <boost/quick_check/quick_check.hpp>
 #include <boost/test/unit_test.hpp>
-#include "../file_dist.hpp"
 #include "../utility.hpp"
 
 namespace qchk = boost::quick_check;
@@ -25,8 +24,10 @@ void test_qcheck_test_count_auto_0()
 {
     using namespace qchk;
 
-    file_dist<int> igen(qcheck_test::abs_test_root("uniform_int_distribution.txt"));
-    file_dist<double> dgen(qcheck_test::abs_test_root("normal_double_distribution.txt"));
+    qchk::file_generator<int> igen(qcheck_test::abs_test_root("uniform_int_distribution.txt"),
+                                   qchk::text_file);
+    qchk::file_generator<double> dgen(qcheck_test::abs_test_root("normal_double_distribution.txt"),
+                                      qchk::text_file);
 
     auto const prop2 = ((_1+_2) == (_2+_1));
     auto config = make_config(_1 = igen, _2 = dgen, _test_count = 1000u);
@@ -43,8 +44,10 @@ void test_qcheck_test_count_prop_0()
 {
     using namespace qchk;
 
-    file_dist<int> igen(qcheck_test::abs_test_root("uniform_int_distribution.txt"));
-    file_dist<double> dgen(qcheck_test::abs_test_root("normal_double_distribution.txt"));
+    qchk::file_generator<int> igen(qcheck_test::abs_test_root("uniform_int_distribution.txt"),
+                                   qchk::text_file);
+    qchk::file_generator<double> dgen(qcheck_test::abs_test_root("normal_double_distribution.txt"),
+                                      qchk::text_file);
 
     property<int, double> const prop2 = ((_1+_2) == (_2+_1));
     auto config = make_config(_1 = igen, _2 = dgen, _test_count = 1000u);
@@ -0,0 +1,211 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file qcheck/test5.cpp
+/// \brief A test of the qcheck_parallel algorithm
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include <sstream>
+#include <algorithm>
+#include <stdexcept>
+#include <boost/quick_check/quick_check.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace qchk = boost::quick_check;
+namespace proto = boost::proto;
+namespace phx = boost::phoenix;
+
+// Generates 0, 1, 2, ... regardless of the random number generator, so
+// every shard sees the same sequence.
+struct counter_t
+{
+    typedef int result_type;
+
+    counter_t()
+      : i_(0)
+    {}
+
+    template<typename Rng>
+    int operator()(Rng &)
+    {
+        return i_++;
+    }
+
+private:
+    int i_;
+};
+
+struct throwing_t
+{
+    typedef int result_type;
+
+    template<typename Rng>
+    int operator()(Rng &)
+    {
+        throw std::runtime_error("oops");
+    }
+};
+
+void test_qcheck_parallel_pass()
+{
+    using namespace qchk;
+    uniform<int> di(1,6);
+
+    auto const prop =
+        classify(_1 > 0, "positive") |
+            (_1 >= 1 && _1 <= 6);
+
+    auto config = make_config(_1 = di, _test_count = 1001u);
+    auto res = qcheck_parallel(prop, config, 4);
+    BOOST_CHECK(res.success());
+    BOOST_CHECK(!res.exhausted());
+    std::stringstream sout;
+    res.print_summary(sout);
+    BOOST_CHECK_EQUAL(
+        "OK, passed 1001 tests.\n"
+        "100% positive.\n"
+      , sout.str()
+    );
+
+    // More threads than tests
+    auto config2 = make_config(_1 = di, _test_count = 3u);
+    res = qcheck_parallel(prop, config2, 8);
+    sout.str(std::string());
+    res.print_summary(sout);
+    BOOST_CHECK_EQUAL(
+        "OK, passed 3 tests.\n"
+        "100% positive.\n"
+      , sout.str()
+    );
+}
+
+void test_qcheck_parallel_fail()
+{
+    using namespace qchk;
+    counter_t cnt;
+
+    auto config = make_config(_1 = cnt, _test_count = 40u);
+    auto res = qcheck_parallel(_1 != 5, config, 4);
+    BOOST_CHECK(!res.success());
+    BOOST_REQUIRE_EQUAL(res.failures().size(), 4u);
+    for(auto const &args : res.failures())
+        BOOST_CHECK_EQUAL(boost::fusion::at_c<0>(args), 5);
+
+    std::stringstream sout;
+    res.print_summary(sout);
+    BOOST_CHECK_EQUAL(
+        "Falsifiable, after 6 tests:\n"
+        "[5]\n"
+      , sout.str()
+    );
+}
+
+void test_qcheck_parallel_max_failures()
+{
+    using namespace qchk;
+    uniform<int> di(1,6);
+
+    // Every test fails, but only 5 failures are kept by all the shards together.
+    auto config = make_config(_1 = di, _test_count = 10000u, _max_failures = 5u
+                            , _max_shrinks = 0u);
+    auto res = qcheck_parallel(_1 > 6, config, 4);
+    BOOST_CHECK(!res.success());
+    BOOST_CHECK(res.stopped_early());
+    BOOST_CHECK_EQUAL(res.failure_count(), 5u);
+    BOOST_CHECK_EQUAL(res.failures().size(), 5u);
+    BOOST_CHECK_EQUAL(res.test_count(), 5u);
+}
+
+void test_qcheck_parallel_exhausted()
+{
+    using namespace qchk;
+    uniform<int> di(1,6);
+
+    property<int> const prop = _1 == 6 >>= (_1 == 6);
+    auto config = make_config(_1 = di, _test_count = 1000u, _max_test_count = 1000u);
+    auto res = qcheck_parallel(prop, config, 4);
+    BOOST_CHECK(res.success());
+    BOOST_CHECK(res.exhausted());
+}
+
+void test_qcheck_parallel_throw()
+{
+    using namespace qchk;
+    throwing_t thr;
+
+    auto config = make_config(_1 = thr);
+    BOOST_CHECK_THROW(qcheck_parallel(_1 == 0, config, 4), std::runtime_error);
+}
+
+void test_qcheck_parallel_seeded()
+{
+    using namespace qchk;
+    uniform<int> di(1, 100);
+
+    auto const prop =
+        classify(_1 <= 10, "small") |
+        classify(_1 > 90, "large") |
+            (_1 % 7 != 0);
+
+    auto serial_config = make_config(_1 = di, _test_count = 1000u, _seed = 1234u);
+    auto serial = qcheck(prop, serial_config);
+
+    auto parallel_config = make_config(_1 = di, _test_count = 1000u, _seed = 1234u);
+    auto parallel = qcheck_parallel(prop, parallel_config, 3);
+
+    BOOST_CHECK_EQUAL(parallel_config.next_case(), serial_config.next_case());
+    BOOST_REQUIRE_EQUAL(parallel.failures().size(), serial.failures().size());
+    BOOST_REQUIRE(!serial.failures().empty());
+
+    std::vector<std::size_t> serial_cases, parallel_cases;
+    for(auto const &args : serial.failures())
+        serial_cases.push_back(args.case_index());
+    for(auto const &args : parallel.failures())
+    {
+        parallel_cases.push_back(args.case_index());
+        // Each failure can be regenerated from its index
+        BOOST_CHECK_EQUAL(
+            boost::fusion::at_c<0>(parallel_config(args.case_index()))
+          , boost::fusion::at_c<0>(args)
+        );
+    }
+    std::sort(parallel_cases.begin(), parallel_cases.end());
+    BOOST_CHECK(serial_cases == parallel_cases);
+
+    // The category statistics are the same
+    auto const prop2 =
+        classify(_1 <= 10, "small") |
+        classify(_1 > 90, "large") |
+            (_1 > 0);
+    serial_config = make_config(_1 = di, _test_count = 1000u, _seed = 99u);
+    parallel_config = make_config(_1 = di, _test_count = 1000u, _seed = 99u);
+    std::stringstream serial_out, parallel_out;
+    qcheck(prop2, serial_config).print_summary(serial_out);
+    qcheck_parallel(prop2, parallel_config, 3).print_summary(parallel_out);
+    BOOST_CHECK_EQUAL(serial_out.str(), parallel_out.str());
+}
+
+using namespace boost::unit_test;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("tests for the qcheck_parallel algorithm");
+
+    test->add(BOOST_TEST_CASE(&test_qcheck_parallel_pass));
+    test->add(BOOST_TEST_CASE(&test_qcheck_parallel_fail));
+    test->add(BOOST_TEST_CASE(&test_qcheck_parallel_max_failures));
+    test->add(BOOST_TEST_CASE(&test_qcheck_parallel_exhausted));
+    test->add(BOOST_TEST_CASE(&test_qcheck_parallel_throw));
+    test->add(BOOST_TEST_CASE(&test_qcheck_parallel_seeded));
+
+    return test;
+}
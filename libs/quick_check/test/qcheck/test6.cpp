@@ -0,0 +1,123 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file qcheck/test6.cpp
+/// \brief A test of the qcheck algorithm with _max_failures
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <sstream>
+#include <boost/quick_check/quick_check.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace qchk = boost::quick_check;
+namespace proto = boost::proto;
+namespace phx = boost::phoenix;
+
+// Generates 0, 1, 2, ...
+struct counter_t
+{
+    typedef int result_type;
+
+    counter_t()
+      : i_(0)
+    {}
+
+    template<typename Rng>
+    int operator()(Rng &)
+    {
+        return i_++;
+    }
+
+private:
+    int i_;
+};
+
+void test_qcheck_max_failures_0()
+{
+    using namespace qchk;
+    counter_t cnt;
+
+    // By default, all the tests run
+    auto config = make_config(_1 = cnt);
+    BOOST_CHECK_EQUAL(config.max_failures(), std::numeric_limits<std::size_t>::max());
+    auto res = qcheck(_1 % 10 != 3, config);
+    BOOST_CHECK(!res.success());
+    BOOST_CHECK(!res.stopped_early());
+    BOOST_CHECK_EQUAL(res.test_count(), 100u);
+    BOOST_CHECK_EQUAL(res.failures().size(), 10u);
+
+    // Stop at the first failure
+    int evaluated = 0;
+    auto config2 = make_config(_1 = cnt, _max_failures = 1u);
+    auto res2 = qcheck((phx::ref(evaluated)++, _1 % 10 != 3), config2);
+    BOOST_CHECK(!res2.success());
+    BOOST_CHECK(res2.stopped_early());
+    BOOST_CHECK(!res2.exhausted());
+    BOOST_CHECK_EQUAL(res2.test_count(), 4u);
+    BOOST_CHECK_EQUAL(evaluated, 4);
+    BOOST_REQUIRE_EQUAL(res2.failures().size(), 1u);
+    BOOST_CHECK_EQUAL(boost::fusion::at_c<0>(res2.failures()[0]), 3);
+
+    std::stringstream sout;
+    res2.print_summary(sout);
+    BOOST_CHECK_EQUAL(
+        "Falsifiable, after 4 tests:\n"
+        "[3]\n"
+        "Stopped after 4 tests and 1 failures.\n"
+      , sout.str()
+    );
+
+    // Stop at the third failure
+    auto config3 = make_config(_1 = cnt, _max_failures = 3u);
+    auto res3 = qcheck(_1 % 10 != 3, config3);
+    BOOST_CHECK(res3.stopped_early());
+    BOOST_CHECK_EQUAL(res3.test_count(), 24u);
+    BOOST_REQUIRE_EQUAL(res3.failures().size(), 3u);
+    BOOST_CHECK_EQUAL(boost::fusion::at_c<0>(res3.failures()[2]), 23);
+
+    // Not stopped early if there are fewer failures than the limit
+    auto config4 = make_config(_1 = cnt, _max_failures = 11u);
+    auto res4 = qcheck(_1 % 10 != 3, config4);
+    BOOST_CHECK(!res4.stopped_early());
+    BOOST_CHECK_EQUAL(res4.test_count(), 100u);
+    BOOST_CHECK_EQUAL(res4.failures().size(), 10u);
+}
+
+void test_qcheck_max_failures_1()
+{
+    using namespace qchk;
+    counter_t cnt;
+
+    // The limit is honoured when the property has a condition
+    property<int> const prop = _1 % 2 == 1 >>= (_1 % 10 != 3);
+    auto config = make_config(_1 = cnt, _max_failures = 2u);
+    auto res = qcheck(prop, config);
+    BOOST_CHECK(res.stopped_early());
+    BOOST_CHECK_EQUAL(res.test_count(), 7u);
+    BOOST_CHECK_EQUAL(res.failures().size(), 2u);
+
+    // Merging keeps the stopped early flag
+    qcheck_results<int> merged;
+    merged += boost::move(res);
+    BOOST_CHECK(merged.stopped_early());
+}
+
+using namespace boost::unit_test;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("tests for the qcheck algorithm with _max_failures");
+
+    test->add(BOOST_TEST_CASE(&test_qcheck_max_failures_0));
+    test->add(BOOST_TEST_CASE(&test_qcheck_max_failures_1));
+
+    return test;
+}
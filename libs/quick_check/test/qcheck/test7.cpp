@@ -0,0 +1,207 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file qcheck/test7.cpp
+/// \brief A test of the qcheck_batched algorithm
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include <sstream>
+#include <boost/quick_check/quick_check.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace qchk = boost::quick_check;
+namespace proto = boost::proto;
+namespace phx = boost::phoenix;
+
+// Generates 0, 1, 2, ...
+struct counter_t
+{
+    typedef int result_type;
+
+    counter_t()
+      : i_(0)
+    {}
+
+    template<typename Rng>
+    int operator()(Rng &)
+    {
+        return i_++;
+    }
+
+private:
+    int i_;
+};
+
+template<typename Results>
+std::string summary(Results const &res)
+{
+    std::stringstream sout;
+    res.print_summary(sout);
+    return sout.str();
+}
+
+template<typename Results>
+std::vector<std::size_t> failed_cases(Results const &res)
+{
+    std::vector<std::size_t> cases;
+    for(auto const &args : res.failures())
+        cases.push_back(args.case_index());
+    return cases;
+}
+
+void test_qcheck_batched_pass()
+{
+    using namespace qchk;
+    uniform<int> di(-1000, 1000);
+    normal<double> dd(0., 1.);
+
+    auto config = make_config(_1 = di, _2 = di, _test_count = 1000u);
+    auto res = qcheck_batched((_1 + _2) == (_2 + _1), config, 64);
+    BOOST_CHECK(res.success());
+    BOOST_CHECK(!res.exhausted());
+    BOOST_CHECK_EQUAL(config.next_case(), 1000u);
+    BOOST_CHECK_EQUAL(summary(res), "OK, passed 1000 tests.\n");
+
+    auto config2 = make_config(_1 = dd, _2 = di);
+    auto res2 = qcheck_batched(
+        classify(_1 > 0., "positive") |
+        classify(_1 <= 0., "non-positive") |
+            (_1 * _2 == _2 * _1)
+      , config2
+    );
+    BOOST_CHECK(res2.success());
+    BOOST_CHECK_EQUAL(res2.test_count(), 100u);
+    BOOST_CHECK_NE(summary(res2).find("% positive.\n"), std::string::npos);
+    BOOST_CHECK_NE(summary(res2).find("% non-positive.\n"), std::string::npos);
+}
+
+void test_qcheck_batched_fail()
+{
+    using namespace qchk;
+    counter_t cnt;
+
+    auto config = make_config(_1 = cnt, _test_count = 100u);
+    auto res = qcheck_batched(_1 % 10 != 3, config, 16);
+    BOOST_CHECK(!res.success());
+    BOOST_CHECK_EQUAL(res.test_count(), 100u);
+    BOOST_REQUIRE_EQUAL(res.failures().size(), 10u);
+    for(std::size_t i = 0; i < 10u; ++i)
+    {
+        BOOST_CHECK_EQUAL(boost::fusion::at_c<0>(res.failures()[i]), int(i * 10 + 3));
+        BOOST_CHECK_EQUAL(res.failures()[i].case_index(), i * 10 + 3);
+    }
+
+    // Stop at the second failure, in the middle of a block
+    auto config2 = make_config(_1 = cnt, _max_failures = 2u);
+    auto res2 = qcheck_batched(_1 % 10 != 3, config2, 64);
+    BOOST_CHECK(res2.stopped_early());
+    BOOST_CHECK(!res2.exhausted());
+    BOOST_CHECK_EQUAL(res2.test_count(), 14u);
+    BOOST_CHECK_EQUAL(res2.failures().size(), 2u);
+    BOOST_CHECK_EQUAL(config2.next_case(), 14u);
+}
+
+void test_qcheck_batched_condition()
+{
+    using namespace qchk;
+    uniform<int> di(1, 6);
+    counter_t cnt;
+
+    // Only the valid test cases that are needed are counted
+    auto config = make_config(_1 = cnt, _test_count = 10u);
+    auto res = qcheck_batched(_1 % 2 == 0 >>= (_1 < 100), config, 64);
+    BOOST_CHECK(res.success());
+    BOOST_CHECK(!res.exhausted());
+    BOOST_CHECK_EQUAL(res.test_count(), 10u);
+    BOOST_CHECK_EQUAL(config.next_case(), 19u);
+
+    property<int> const prop = _1 == 6 >>= (_1 == 6);
+    auto config2 = make_config(_1 = di, _test_count = 1000u, _max_test_count = 1000u);
+    auto res2 = qcheck_batched(prop, config2, 100);
+    BOOST_CHECK(res2.success());
+    BOOST_CHECK(res2.exhausted());
+    BOOST_CHECK_EQUAL(config2.next_case(), 1000u);
+}
+
+void test_qcheck_batched_seeded()
+{
+    using namespace qchk;
+    uniform<int> di(1, 100);
+
+    auto const prop =
+        _1 + _2 != 100 >>= (
+            classify(_1 <= 10, "small") |
+            classify(_2 > 90, "large") |
+                (_1 % 7 != 0)
+        );
+
+    auto serial_config = make_config(_1 = di, _2 = di, _test_count = 500u, _seed = 42u,
+                                     _max_shrinks = 0u);
+    auto serial = qcheck(prop, serial_config);
+    BOOST_REQUIRE(!serial.success());
+
+    std::size_t const block_sizes[] = {1, 7, 1024};
+    for(std::size_t block_size : block_sizes)
+    {
+        auto batched_config = make_config(_1 = di, _2 = di, _test_count = 500u, _seed = 42u,
+                                          _max_shrinks = 0u);
+        auto batched = qcheck_batched(prop, batched_config, block_size);
+        BOOST_CHECK_EQUAL(batched_config.next_case(), serial_config.next_case());
+        BOOST_CHECK_EQUAL(batched.test_count(), serial.test_count());
+        BOOST_CHECK(failed_cases(batched) == failed_cases(serial));
+        BOOST_CHECK_EQUAL(summary(batched), summary(serial));
+    }
+
+    // The category statistics are the same
+    auto const prop2 =
+        _1 + _2 != 100 >>= (
+            classify(_1 <= 10, "small") |
+            classify(_2 > 90, "large") |
+                (_1 > 0)
+        );
+    serial_config = make_config(_1 = di, _2 = di, _test_count = 500u, _seed = 42u,
+                                _max_shrinks = 0u);
+    auto batched_config = make_config(_1 = di, _2 = di, _test_count = 500u, _seed = 42u,
+                                      _max_shrinks = 0u);
+    BOOST_CHECK_EQUAL(
+        summary(qcheck_batched(prop2, batched_config, 64))
+      , summary(qcheck(prop2, serial_config))
+    );
+}
+
+void test_qcheck_batched_shrink()
+{
+    using namespace qchk;
+    uniform<int> di(-1000000, 1000000);
+
+    auto config = make_config(_1 = di);
+    auto res = qcheck_batched(_1 < 100, config, 32);
+    BOOST_REQUIRE(!res.success());
+    BOOST_CHECK_GT(res.shrink_count(), 0u);
+    BOOST_CHECK_EQUAL(boost::fusion::at_c<0>(res.smallest_failure()), 100);
+    BOOST_CHECK(!res.smallest_failure().has_case_index());
+}
+
+using namespace boost::unit_test;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("tests for the qcheck_batched algorithm");
+
+    test->add(BOOST_TEST_CASE(&test_qcheck_batched_pass));
+    test->add(BOOST_TEST_CASE(&test_qcheck_batched_fail));
+    test->add(BOOST_TEST_CASE(&test_qcheck_batched_condition));
+    test->add(BOOST_TEST_CASE(&test_qcheck_batched_seeded));
+    test->add(BOOST_TEST_CASE(&test_qcheck_batched_shrink));
+
+    return test;
+}
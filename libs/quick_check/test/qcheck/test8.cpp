@@ -0,0 +1,203 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file qcheck/test8.cpp
+/// \brief A test of the qcheck_guided algorithm, and of the mutate customization point
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#define QCHK_DEFINE_SANITIZER_COVERAGE
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <boost/quick_check/quick_check.hpp>
+#include <boost/phoenix/bind/bind_function.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace qchk = boost::quick_check;
+namespace phx = boost::phoenix;
+
+// Coverage of the branches of accrue(), counted by hand.
+struct branch_coverage
+{
+    void clear()
+    {
+        std::fill(this->hits, this->hits + 4, 0);
+    }
+
+    std::size_t size() const
+    {
+        return 4;
+    }
+
+    unsigned char const *counters() const
+    {
+        return this->hits;
+    }
+
+    unsigned char hits[4];
+};
+
+branch_coverage branches;
+
+// A function with a bug that only a rare combination of arguments reaches.
+int accrue(int a, int b, int c)
+{
+    ++branches.hits[0];
+    if(a == 7)
+    {
+        ++branches.hits[1];
+        if(b > 990)
+        {
+            ++branches.hits[2];
+            if(c < 10)
+            {
+                ++branches.hits[3];
+                return -1;
+            }
+        }
+    }
+    return 1;
+}
+
+// Following the coverage finds the bug that random testing misses.
+void test_guided()
+{
+    using namespace qchk;
+    auto prop = phx::bind(&accrue, _1, _2, _3) > 0;
+    auto make = []
+    {
+        return make_config(_1 = uniform<int>(0, 999)
+                         , _2 = uniform<int>(0, 999)
+                         , _3 = uniform<int>(0, 999)
+                         , _test_count = 100000u
+                         , _max_failures = 1u
+                         , _seed = 3u);
+    };
+
+    auto config1 = make();
+    BOOST_CHECK(qcheck(prop, config1));
+
+    auto config2 = make();
+    auto res = qcheck_guided(prop, config2, branches);
+    BOOST_REQUIRE(!res);
+    BOOST_CHECK(res.test_count() < 100000u);
+    auto const &failure = res.failures()[0];
+    BOOST_CHECK_EQUAL(fusion::at_c<0>(failure), 7);
+    BOOST_CHECK(fusion::at_c<1>(failure) > 990);
+    BOOST_CHECK(fusion::at_c<2>(failure) < 10);
+    BOOST_CHECK(res.smallest_failure() == fusion::make_vector(7, 991, 0));
+
+    // With a seed, the run is reproducible.
+    auto config3 = make();
+    auto res3 = qcheck_guided(prop, config3, branches);
+    BOOST_CHECK_EQUAL(res3.failures()[0].case_index(), failure.case_index());
+    BOOST_CHECK_EQUAL(res3.test_count(), res.test_count());
+}
+
+// The built-in mutations stay within what the generators could generate.
+void test_mutate()
+{
+    using namespace qchk;
+    boost::random::mt11213b rng;
+
+    uniform<int> ints(-5, 5);
+    int i = 0, lo = 0, hi = 0;
+    for(int k = 0; k < 1000; ++k)
+    {
+        mutate(ints, rng, i);
+        BOOST_REQUIRE(-5 <= i && i <= 5);
+        lo += i == -5;
+        hi += i == 5;
+    }
+    BOOST_CHECK(lo != 0 && hi != 0);
+
+    uniform<double> reals(1.0, 2.0);
+    normal<double> normals(10.0, 1.0);
+    double d = 1.5, e = 10.0;
+    for(int k = 0; k < 1000; ++k)
+    {
+        mutate(reals, rng, d);
+        BOOST_REQUIRE(1.0 <= d && d < 2.0);
+        mutate(normals, rng, e);
+        BOOST_REQUIRE(4.0 <= e && e <= 16.0);
+    }
+
+    uniform<int[3]> arrays(0, 9);
+    auto a = arrays(rng);
+    auto const b = a;
+    mutate(arrays, rng, a);
+    BOOST_CHECK_EQUAL((a[0] != b[0]) + (a[1] != b[1]) + (a[2] != b[2]) <= 1, true);
+
+    auto vectors = vector(uniform<int>(0, 9));
+    set_size(vectors, 10);
+    std::vector<int> v;
+    std::size_t longest = 0;
+    for(int k = 0; k < 1000; ++k)
+    {
+        mutate(vectors, rng, v);
+        BOOST_REQUIRE(v.size() <= 9);
+        BOOST_REQUIRE(std::all_of(v.begin(), v.end(), [](int x) { return 0 <= x && x <= 9; }));
+        longest = (std::max)(longest, v.size());
+    }
+    BOOST_CHECK_EQUAL(longest, 9u);
+
+    auto sorted = ordered_vector(uniform<int>(0, 9));
+    for(int k = 0; k < 100; ++k)
+    {
+        mutate(sorted, rng, v);
+        BOOST_REQUIRE(std::is_sorted(v.begin(), v.end()));
+    }
+}
+
+// The SanitizerCoverage callbacks number the guards and count the hits.
+void test_sanitizer_coverage()
+{
+    using namespace qchk;
+    boost::uint32_t guards[3] = {0, 0, 0};
+    __sanitizer_cov_trace_pc_guard_init(guards, guards + 3);
+    BOOST_CHECK(guards[0] != 0 && guards[1] == guards[0] + 1 && guards[2] == guards[1] + 1);
+    __sanitizer_cov_trace_pc_guard_init(guards, guards + 3);
+    BOOST_CHECK_EQUAL(guards[2], guards[1] + 1);
+
+    sanitizer_coverage coverage;
+    coverage.clear();
+    __sanitizer_cov_trace_pc_guard(&guards[1]);
+    __sanitizer_cov_trace_pc_guard(&guards[1]);
+    BOOST_CHECK_EQUAL(coverage.counters()[guards[1]], 2);
+    BOOST_CHECK_EQUAL(coverage.counters()[guards[0]], 0);
+    for(int k = 0; k < 300; ++k)
+        __sanitizer_cov_trace_pc_guard(&guards[2]);
+    BOOST_CHECK_EQUAL(coverage.counters()[guards[2]], 255);
+    coverage.clear();
+    BOOST_CHECK_EQUAL(coverage.counters()[guards[2]], 0);
+
+    // Without instrumented code, nothing is reached, and the test cases are
+    // all generated afresh.
+    auto config = make_config(_1 = uniform<int>(0, 9), _stats = collect_stats());
+    auto res = qcheck_guided(_1 >= 0, config);
+    BOOST_CHECK(res);
+    BOOST_CHECK_EQUAL(res.test_count(), config.test_count());
+    BOOST_CHECK_EQUAL(res.stats().draws()[0], config.test_count());
+}
+
+using namespace boost::unit_test;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("tests for the qcheck_guided algorithm");
+
+    test->add(BOOST_TEST_CASE(&test_guided));
+    test->add(BOOST_TEST_CASE(&test_mutate));
+    test->add(BOOST_TEST_CASE(&test_sanitizer_coverage));
+
+    return test;
+}
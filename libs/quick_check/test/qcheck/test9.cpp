@@ -0,0 +1,130 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file qcheck/test9.cpp
+/// \brief A test of the qcheck algorithms with a time budget
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <thread>
+#include <boost/quick_check/quick_check.hpp>
+#include <boost/phoenix/bind/bind_function.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace qchk = boost::quick_check;
+namespace phx = boost::phoenix;
+
+typedef std::chrono::steady_clock clock_type;
+
+bool slow_positive(int i)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    return i >= 0;
+}
+
+// Without a budget, exactly _test_count tests are run.
+void test_no_budget()
+{
+    using namespace qchk;
+    auto config = make_config(_1 = uniform<int>(0, 100));
+    BOOST_CHECK(config.time_budget() == clock_type::duration::zero());
+    auto res = qcheck(_1 >= 0, config);
+    BOOST_CHECK(res);
+    BOOST_CHECK_EQUAL(res.test_count(), 100u);
+}
+
+// With one, testing goes on until it has been spent.
+void test_budget()
+{
+    using namespace qchk;
+    auto config = make_config(_1 = uniform<int>(0, 100)
+                            , _time_budget = std::chrono::milliseconds(100));
+    BOOST_CHECK(config.time_budget() == std::chrono::milliseconds(100));
+
+    clock_type::time_point const start = clock_type::now();
+    auto res = qcheck(_1 >= 0, config);
+    clock_type::duration const elapsed = clock_type::now() - start;
+    BOOST_CHECK(res);
+    BOOST_CHECK(!res.exhausted());
+    BOOST_CHECK(res.test_count() > 1000u);
+    BOOST_CHECK(elapsed >= std::chrono::milliseconds(100));
+    BOOST_CHECK(elapsed < std::chrono::seconds(2));
+    BOOST_CHECK_EQUAL(config.next_case(), res.test_count());
+
+    // Failures still stop testing early.
+    auto config2 = make_config(_1 = uniform<int>(0, 100)
+                             , _max_failures = 3u
+                             , _time_budget = std::chrono::seconds(100));
+    auto res2 = qcheck(_1 < 50, config2);
+    BOOST_CHECK(res2.stopped_early());
+    BOOST_CHECK_EQUAL(res2.failure_count(), 3u);
+}
+
+// _test_count is a minimum, even if it takes longer than the budget.
+void test_minimum()
+{
+    using namespace qchk;
+    auto config = make_config(_1 = uniform<int>(0, 100)
+                            , _test_count = 20u
+                            , _time_budget = std::chrono::milliseconds(1));
+    auto res = qcheck(phx::bind(&slow_positive, _1), config);
+    BOOST_CHECK(res);
+    BOOST_CHECK_EQUAL(res.test_count(), 20u);
+
+    // Until then, _max_test_count bounds the test cases generated.
+    auto config2 = make_config(_1 = uniform<int>(0, 100)
+                             , _max_test_count = 1000u
+                             , _time_budget = std::chrono::seconds(100));
+    auto res2 = qcheck(_1 < 0 >>= _1 < 0, config2);
+    BOOST_CHECK(res2.exhausted());
+    BOOST_CHECK_EQUAL(res2.test_count(), 0u);
+    BOOST_CHECK_EQUAL(config2.next_case(), 1000u);
+}
+
+// The other algorithms keep to the budget too.
+void test_other_algorithms()
+{
+    using namespace qchk;
+    auto config = make_config(_1 = uniform<int>(0, 100)
+                            , _seed = 7u
+                            , _time_budget = std::chrono::milliseconds(50));
+    auto res = qcheck_batched(_1 >= 0, config, 64);
+    BOOST_CHECK(res);
+    BOOST_CHECK(res.test_count() > 1000u);
+
+    auto config2 = make_config(_1 = uniform<int>(0, 100)
+                             , _seed = 7u
+                             , _time_budget = std::chrono::milliseconds(50));
+    auto res2 = qcheck_batched(_1 % 2 == 0 >>= _1 >= 0, config2, 64);
+    BOOST_CHECK(res2);
+    BOOST_CHECK(res2.test_count() > 500u);
+
+    auto config3 = make_config(_1 = uniform<int>(0, 100)
+                             , _seed = 7u
+                             , _time_budget = std::chrono::milliseconds(50));
+    auto res3 = qcheck_parallel(_1 >= 0, config3, 2);
+    BOOST_CHECK(res3);
+    BOOST_CHECK(res3.test_count() > 1000u);
+}
+
+using namespace boost::unit_test;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("tests for the qcheck algorithms with a time budget");
+
+    test->add(BOOST_TEST_CASE(&test_no_budget));
+    test->add(BOOST_TEST_CASE(&test_budget));
+    test->add(BOOST_TEST_CASE(&test_minimum));
+    test->add(BOOST_TEST_CASE(&test_other_algorithms));
+
+    return test;
+}
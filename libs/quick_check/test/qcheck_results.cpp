@@ -15,7 +15,6 @@
 #include <boost/config.hpp>
 #include <boost/quick_check/quick_check.hpp>
 #include <boost/test/unit_test.hpp>
-#include "./file_dist.hpp"
 #include "./utility.hpp"
 
 namespace qchk = boost::quick_check;
@@ -26,7 +25,7 @@ namespace phx = boost::phoenix;
     !defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
 #include <type_traits>
 static_assert(
-    std::has_move_constructor<qchk::qcheck_results<int, double, qchk::grouped_by<int> > >::value,
+    std::is_move_constructible<qchk::qcheck_results<int, double, qchk::grouped_by<int> > >::value,
     "should have move constructor");
 #endif
 
@@ -37,8 +36,10 @@ void test_qcheck_results_0()
 {
     using namespace qchk;
 
-    file_dist<int> igen(qcheck_test::abs_test_root("uniform_int_distribution.txt"));
-    file_dist<double> dgen(qcheck_test::abs_test_root("normal_double_distribution.txt"));
+    file_generator<int> igen(qcheck_test::abs_test_root("uniform_int_distribution.txt"),
+                             text_file);
+    file_generator<double> dgen(qcheck_test::abs_test_root("normal_double_distribution.txt"),
+                                text_file);
 
     // default construction
     qcheck_results<int, double, grouped_by<int> > qr0;
@@ -104,6 +105,78 @@ void test_qcheck_results_0()
     );
 }
 
+template<typename Results>
+std::string summary(Results const &res)
+{
+    std::stringstream sout;
+    res.print_summary(sout);
+    return sout.str();
+}
+
+void test_qcheck_results_1()
+{
+    using namespace qchk;
+    uniform<int> di(1, 100);
+
+    property<int, grouped_by<int> > const prop =
+        group_by(_1 % 3) |
+        classify(_1 <= 10, "small") |
+            (_1 % 7 != 0);
+    property<int, grouped_by<int> > const prop2 =
+        group_by(_1 % 3) |
+        classify(_1 <= 10, "small") |
+            (_1 > 0);
+
+    // Running 300 tests in one go gives the same results as running 100
+    // then 200 tests and merging them.
+    auto config = make_config(_1 = di, _test_count = 300u, _seed = 7u);
+    auto expected = qcheck(prop2, config);
+
+    config = make_config(_1 = di, _test_count = 100u, _seed = 7u);
+    auto res = qcheck(prop2, config);
+    auto config2 = make_config(_1 = di, _test_count = 200u, _seed = 7u);
+    for(int i = 0; i < 100; ++i)
+        config2(); // skip the first 100 cases
+    res += qcheck(prop2, config2);
+    BOOST_CHECK(res.success());
+    BOOST_CHECK(!res.exhausted());
+    BOOST_CHECK_EQUAL(summary(expected), summary(res));
+
+    // Failures are moved across in order, and the index of the first
+    // failing test accounts for the tests already run.
+    config = make_config(_1 = di, _test_count = 300u, _seed = 7u);
+    expected = qcheck(prop, config);
+    BOOST_REQUIRE(!expected.success());
+
+    config = make_config(_1 = di, _test_count = 0u, _seed = 7u);
+    res = qcheck(prop, config);
+    config = make_config(_1 = di, _test_count = 300u, _seed = 7u);
+    res.merge(qcheck(prop, config));
+    BOOST_CHECK_EQUAL(summary(expected), summary(res));
+    BOOST_CHECK_EQUAL(res.failures().size(), expected.failures().size());
+
+    config = make_config(_1 = di, _test_count = 150u, _seed = 7u);
+    res = qcheck(prop, config);
+    config2 = make_config(_1 = di, _test_count = 150u, _seed = 7u);
+    for(int i = 0; i < 150; ++i)
+        config2();
+    res.merge(qcheck(prop, config2));
+    BOOST_CHECK_EQUAL(summary(expected), summary(res));
+    BOOST_REQUIRE_EQUAL(res.failures().size(), expected.failures().size());
+    for(std::size_t i = 0; i < res.failures().size(); ++i)
+        BOOST_CHECK_EQUAL(res.failures()[i].case_index(), expected.failures()[i].case_index());
+
+    // Exhaustion of either run is sticky
+    property<int> const prop3 = _1 < 0 >>= (_1 < 0);
+    auto config3 = make_config(_1 = di, _test_count = 10u, _max_test_count = 10u);
+    auto res3 = qcheck(prop3, config3);
+    BOOST_CHECK(res3.exhausted());
+    qcheck_results<int> res4;
+    res4 += boost::move(res3);
+    BOOST_CHECK(res4.exhausted());
+    BOOST_CHECK(res4.success());
+}
+
 using namespace boost::unit_test;
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // init_unit_test_suite
@@ -113,6 +186,7 @@ test_suite* init_unit_test_suite( int argc, char* argv[] )
     test_suite *test = BOOST_TEST_SUITE("tests for the qcheck algorithm");
 
     test->add(BOOST_TEST_CASE(&test_qcheck_results_0));
+    test->add(BOOST_TEST_CASE(&test_qcheck_results_1));
 
     return test;
 }
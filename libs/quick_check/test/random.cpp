@@ -0,0 +1,241 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file random.cpp
+/// \brief A test for the random number engines
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include <algorithm>
+#include <boost/cstdint.hpp>
+#include <boost/quick_check/quick_check.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace qchk = boost::quick_check;
+
+// A SeedSeq that generates a fixed sequence of words
+struct fixed_seed_seq
+{
+    typedef boost::uint32_t result_type;
+
+    explicit fixed_seed_seq(std::vector<boost::uint32_t> const &words)
+      : words_(words)
+    {}
+
+    template<typename Iter>
+    void generate(Iter first, Iter last)
+    {
+        for(std::size_t i = 0; first != last; ++first, ++i)
+            *first = i < words_.size() ? words_[i] : 0u;
+    }
+
+private:
+    std::vector<boost::uint32_t> words_;
+};
+
+// fill produces the same words as operator(), no matter where it starts
+template<typename Engine>
+void check_fill(Engine rng)
+{
+    static_assert(qchk::detail::has_fill<Engine>::value, "engine has no fill member");
+    for(std::size_t offset = 0; offset < 5; ++offset)
+    {
+        Engine filled = rng;
+        std::vector<boost::uint64_t> words(37);
+        filled.fill(words.data(), words.size());
+
+        Engine called = rng;
+        for(boost::uint64_t w : words)
+        {
+            boost::uint64_t expected = called();
+            if(sizeof(typename Engine::result_type) == 4)
+                expected |= boost::uint64_t(called()) << 32;
+            BOOST_CHECK_EQUAL(w, expected);
+        }
+        BOOST_CHECK(filled == called);
+        rng();
+    }
+}
+
+// discard(z) is the same as z calls to operator()
+template<typename Engine>
+void check_discard(Engine rng)
+{
+    boost::uintmax_t const steps[] = {0, 1, 3, 4, 5, 1000};
+    for(boost::uintmax_t z : steps)
+    {
+        Engine skipped = rng;
+        skipped.discard(z);
+        Engine stepped = rng;
+        for(boost::uintmax_t i = 0; i < z; ++i)
+            stepped();
+        BOOST_CHECK(skipped == stepped);
+        BOOST_CHECK_EQUAL(skipped(), stepped());
+        rng();
+    }
+}
+
+template<typename Engine>
+void check_seed()
+{
+    Engine a, b(Engine::default_seed), c(1u);
+    BOOST_CHECK(a == b);
+    BOOST_CHECK(a != c);
+    c.seed();
+    BOOST_CHECK(a == c);
+
+    fixed_seed_seq seq(std::vector<boost::uint32_t>({5, 6, 7, 8, 9, 10, 11, 12}));
+    Engine d(seq), e;
+    e.seed(seq);
+    BOOST_CHECK(d == e);
+    BOOST_CHECK(d != a);
+
+    BOOST_CHECK_EQUAL((Engine::min)(), 0u);
+    BOOST_CHECK_EQUAL((Engine::max)(), static_cast<typename Engine::result_type>(~0ull));
+}
+
+void test_known_answers()
+{
+    // The state {1, 2, 3, 4}
+    fixed_seed_seq seq(std::vector<boost::uint32_t>({1, 0, 2, 0, 3, 0, 4, 0}));
+    qchk::xoshiro256ss xoshiro(seq);
+    BOOST_CHECK_EQUAL(xoshiro(), 11520u);
+    BOOST_CHECK_EQUAL(xoshiro(), 0u);
+    BOOST_CHECK_EQUAL(xoshiro(), 1509978240u);
+    BOOST_CHECK_EQUAL(xoshiro(), 1215971899390074240u);
+
+    // From the PCG reference implementation
+    qchk::pcg64 pcg(42u, 54u);
+    BOOST_CHECK_EQUAL(pcg(), 0x86b1da1d72062b68u);
+    BOOST_CHECK_EQUAL(pcg(), 0x1304aa46c9853d39u);
+    BOOST_CHECK_EQUAL(pcg(), 0xa3670e9e0dd50358u);
+
+    // From the Random123 known-answer tests
+    boost::uint32_t out[4];
+    boost::uint32_t const ctr[4] = {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344};
+    boost::uint32_t const key[2] = {0xa4093822, 0x299f31d0};
+    qchk::philox4x32::encrypt(ctr, key, out);
+    BOOST_CHECK_EQUAL(out[0], 0xd16cfe09u);
+    BOOST_CHECK_EQUAL(out[1], 0x94fdccebu);
+    BOOST_CHECK_EQUAL(out[2], 0x5001e420u);
+    BOOST_CHECK_EQUAL(out[3], 0x24126ea1u);
+
+    qchk::philox4x32 philox;
+    BOOST_CHECK_EQUAL(philox(), 0x6627e8d5u);
+    BOOST_CHECK_EQUAL(philox(), 0xe169c58du);
+    BOOST_CHECK_EQUAL(philox(), 0xbc57ac4cu);
+    BOOST_CHECK_EQUAL(philox(), 0x9b00dbd8u);
+}
+
+void test_engines()
+{
+    check_seed<qchk::xoshiro256ss>();
+    check_seed<qchk::pcg64>();
+    check_seed<qchk::philox4x32>();
+
+    check_fill(qchk::xoshiro256ss(7u));
+    check_fill(qchk::pcg64(7u));
+    check_fill(qchk::philox4x32(7u));
+
+    check_discard(qchk::xoshiro256ss(7u));
+    check_discard(qchk::pcg64(7u));
+    check_discard(qchk::philox4x32(7u));
+
+    // Streams of pcg64 differ
+    BOOST_CHECK(qchk::pcg64(7u, 1u) != qchk::pcg64(7u, 2u));
+    BOOST_CHECK_NE(qchk::pcg64(7u, 1u)(), qchk::pcg64(7u, 2u)());
+
+    // The counter carries into its high words
+    qchk::philox4x32 carried;
+    for(int i = 0; i < 4; ++i)
+        carried.discard(0xFFFFFFFFFFFFFFFCull); // 2^62 - 1 blocks
+    carried.discard(16);
+    boost::uint32_t const ctr[4] = {0, 0, 1, 0}, key[2] = {0, 0};
+    boost::uint32_t out[4];
+    qchk::philox4x32::encrypt(ctr, key, out);
+    BOOST_CHECK_EQUAL(carried(), out[0]);
+}
+
+template<typename Engine>
+void check_generate_n(Engine rng)
+{
+    qchk::uniform<int> die(1, 6);
+    std::vector<int> rolls(60001);
+    qchk::generate_n(die, rng, rolls.begin(), rolls.size());
+    BOOST_CHECK_EQUAL(std::count(rolls.begin(), rolls.end(), 0), 0);
+    for(int i = 1; i <= 6; ++i)
+    {
+        std::ptrdiff_t const n = std::count(rolls.begin(), rolls.end(), i);
+        BOOST_CHECK_GT(n, 9000);
+        BOOST_CHECK_LT(n, 11000);
+    }
+
+    qchk::uniform<unsigned> all(0u, ~0u);
+    std::vector<unsigned> u(1001);
+    qchk::generate_n(all, rng, u.begin(), u.size());
+    BOOST_CHECK_GT(*std::max_element(u.begin(), u.end()), 0x80000000u);
+
+    qchk::uniform<double> ud(-1., 1.);
+    std::vector<double> d(10001);
+    qchk::generate_n(ud, rng, d.begin(), d.size());
+    BOOST_CHECK_GE(*std::min_element(d.begin(), d.end()), -1.);
+    BOOST_CHECK_LT(*std::max_element(d.begin(), d.end()), 1.);
+    std::ptrdiff_t const positive =
+        std::count_if(d.begin(), d.end(), [](double x) { return x > 0.; });
+    BOOST_CHECK_GT(positive, 4500);
+    BOOST_CHECK_LT(positive, 5500);
+}
+
+template<typename Engine>
+void check_config(Engine rng)
+{
+    using namespace qchk;
+    uniform<int> di(1, 100);
+
+    // Seeded configs reseed the engine before each test case
+    auto config1 = make_config(_1 = di, _2 = di, _rng = rng, _seed = 42u, _max_shrinks = 0u);
+    auto config2 = make_config(_1 = di, _2 = di, _rng = rng, _seed = 42u, _max_shrinks = 0u);
+    auto res1 = qcheck(_1 + _2 < 150, config1);
+    auto res2 = qcheck_batched(_1 + _2 < 150, config2);
+    BOOST_REQUIRE(!res1.success());
+    BOOST_REQUIRE_EQUAL(res1.failures().size(), res2.failures().size());
+    for(std::size_t i = 0; i < res1.failures().size(); ++i)
+        BOOST_CHECK_EQUAL(res1.failures()[i].case_index(), res2.failures()[i].case_index());
+
+    auto config3 = make_config(_1 = di, _rng = rng, _test_count = 1000u);
+    BOOST_CHECK(qcheck_batched(_1 >= 1 && _1 <= 100, config3).success());
+    auto config4 = make_config(_1 = di, _rng = rng, _test_count = 1000u);
+    BOOST_CHECK(qcheck_parallel(_1 >= 1 && _1 <= 100, config4, 3).success());
+}
+
+void test_config()
+{
+    check_generate_n(qchk::xoshiro256ss());
+    check_generate_n(qchk::pcg64());
+    check_generate_n(qchk::philox4x32());
+
+    check_config(qchk::xoshiro256ss());
+    check_config(qchk::pcg64());
+    check_config(qchk::philox4x32());
+}
+
+using namespace boost::unit_test;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("tests for the random number engines");
+
+    test->add(BOOST_TEST_CASE(&test_known_answers));
+    test->add(BOOST_TEST_CASE(&test_engines));
+    test->add(BOOST_TEST_CASE(&test_config));
+
+    return test;
+}
@@ -0,0 +1,237 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file shrink.cpp
+/// \brief A test of the shrinking of failing inputs
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+#include <sstream>
+#include <algorithm>
+#include <boost/quick_check/quick_check.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace qchk = boost::quick_check;
+namespace proto = boost::proto;
+namespace phx = boost::phoenix;
+
+template<typename Results>
+std::string summary(Results const &res)
+{
+    std::stringstream sout;
+    res.print_summary(sout);
+    return sout.str();
+}
+
+bool all_small(std::vector<int> const &v)
+{
+    return std::find_if(v.begin(), v.end(), [](int i) { return i >= 50; }) == v.end();
+}
+
+bool has_no_q(std::string const &s)
+{
+    return s.find('q') == std::string::npos;
+}
+
+// A generator with a custom shrink() that only ever proposes value - 1.
+struct countdown_t
+{
+    typedef int result_type;
+
+    template<typename Rng>
+    int operator()(Rng &)
+    {
+        return 1000;
+    }
+
+    friend void shrink(countdown_t const &, int const &value, std::vector<int> &out)
+    {
+        if(value > 0)
+            out.push_back(value - 1);
+    }
+};
+
+void test_shrink_integral()
+{
+    using namespace qchk;
+    uniform<int> di(-1000000, 1000000);
+
+    auto config = make_config(_1 = di);
+    auto res = qcheck(_1 < 100, config);
+    BOOST_REQUIRE(!res.success());
+    BOOST_CHECK_GT(res.shrink_count(), 0u);
+    BOOST_CHECK_EQUAL(boost::fusion::at_c<0>(res.smallest_failure()), 100);
+    BOOST_CHECK_GE(boost::fusion::at_c<0>(res.failures()[0]), 100);
+    BOOST_CHECK(!res.smallest_failure().has_case_index());
+    BOOST_CHECK(res.failures()[0].has_case_index());
+
+    // Shrinking respects the range of the generator
+    uniform<int> di2(5, 1000);
+    auto config2 = make_config(_1 = di2);
+    auto res2 = qcheck(_1 < 3, config2);
+    BOOST_REQUIRE(!res2.success());
+    BOOST_CHECK_EQUAL(boost::fusion::at_c<0>(res2.smallest_failure()), 5);
+
+    uniform<int> di3(-1000, -5);
+    auto config3 = make_config(_1 = di3);
+    auto res3 = qcheck(_1 > 0, config3);
+    BOOST_REQUIRE(!res3.success());
+    BOOST_CHECK_EQUAL(boost::fusion::at_c<0>(res3.smallest_failure()), -5);
+
+    // Shrinking respects the property's condition
+    property<int> const prop = _1 % 2 == 1 >>= (_1 < 100);
+    auto config4 = make_config(_1 = di);
+    auto res4 = qcheck(prop, config4);
+    BOOST_REQUIRE(!res4.success());
+    int const i = boost::fusion::at_c<0>(res4.smallest_failure());
+    BOOST_CHECK_EQUAL(i % 2, 1);
+    BOOST_CHECK_GE(i, 100);
+    BOOST_CHECK_LT(i, boost::fusion::at_c<0>(res4.failures()[0]));
+}
+
+void test_shrink_floating()
+{
+    using namespace qchk;
+    normal<double> dd(0., 100.);
+
+    auto config = make_config(_1 = dd);
+    auto res = qcheck(_1 < 1.5, config);
+    BOOST_REQUIRE(!res.success());
+    double const d = boost::fusion::at_c<0>(res.smallest_failure());
+    BOOST_CHECK_GE(d, 1.5);
+    BOOST_CHECK_LT(d, 2.);
+
+    uniform<double> ud(10., 20.);
+    auto config2 = make_config(_1 = ud);
+    auto res2 = qcheck(_1 < 0., config2);
+    BOOST_REQUIRE(!res2.success());
+    BOOST_CHECK_EQUAL(boost::fusion::at_c<0>(res2.smallest_failure()), 10.);
+}
+
+void test_shrink_sequence()
+{
+    using namespace qchk;
+    auto config = make_config(_1 = vector(uniform<int>(0, 100)));
+    auto res = qcheck(phx::bind(&all_small, _1), config);
+    BOOST_REQUIRE(!res.success());
+    std::vector<int> const &v = boost::fusion::at_c<0>(res.smallest_failure());
+    BOOST_REQUIRE_EQUAL(v.size(), 1u);
+    BOOST_CHECK_EQUAL(v[0], 50);
+
+    auto config2 = make_config(_1 = string(lower()), _test_count = 1000u);
+    auto res2 = qcheck(phx::bind(&has_no_q, _1), config2);
+    BOOST_REQUIRE(!res2.success());
+    BOOST_CHECK_EQUAL(boost::fusion::at_c<0>(res2.smallest_failure()), "q");
+
+    // Sorted sequences stay sorted
+    auto config3 = make_config(_1 = ordered_vector(uniform<int>(0, 100)));
+    auto res3 = qcheck(phx::bind(&all_small, _1), config3);
+    BOOST_REQUIRE(!res3.success());
+    std::vector<int> const &v3 = boost::fusion::at_c<0>(res3.smallest_failure());
+    BOOST_CHECK(std::is_sorted(v3.begin(), v3.end()));
+    BOOST_CHECK_EQUAL(v3.size(), 1u);
+}
+
+void test_shrink_zip_and_array()
+{
+    using namespace qchk;
+    auto config = make_config(_1 = zip(uniform<int>(0, 100), uniform<int>(0, 100)));
+    auto res = qcheck(phx::bind(&std::pair<int, int>::first, _1) +
+                      phx::bind(&std::pair<int, int>::second, _1) < 10, config);
+    BOOST_REQUIRE(!res.success());
+    std::pair<int, int> const &p = boost::fusion::at_c<0>(res.smallest_failure());
+    BOOST_CHECK_EQUAL(p.first + p.second, 10);
+
+    auto config2 = make_config(_1 = uniform<int[3]>(0, 100));
+    auto res2 = qcheck(_1[0] + _1[1] + _1[2] < 50, config2);
+    BOOST_REQUIRE(!res2.success());
+    boost::array<int, 3> const &a = boost::fusion::at_c<0>(res2.smallest_failure());
+    BOOST_CHECK_EQUAL(a[0] + a[1] + a[2], 50);
+}
+
+void test_shrink_budget()
+{
+    using namespace qchk;
+    uniform<int> di(-1000000, 1000000);
+
+    // _max_shrinks = 0 disables shrinking
+    auto config = make_config(_1 = di, _max_shrinks = 0u);
+    auto res = qcheck(_1 < 100, config);
+    BOOST_REQUIRE(!res.success());
+    BOOST_CHECK_EQUAL(res.shrink_count(), 0u);
+    BOOST_CHECK_EQUAL(
+        boost::fusion::at_c<0>(res.smallest_failure())
+      , boost::fusion::at_c<0>(res.failures()[0])
+    );
+    std::stringstream sout;
+    sout << "Falsifiable, after " << res.failures()[0].case_index() + 1 << " tests:\n"
+         << res.failures()[0] << "\n";
+    BOOST_CHECK_EQUAL(summary(res), sout.str());
+
+    // The custom shrink() proposes one candidate per step, and each
+    // evaluation is counted against the budget.
+    countdown_t cnt;
+    int evaluated = 0;
+    auto config2 = make_config(_1 = cnt, _test_count = 1u, _max_shrinks = 10u);
+    auto res2 = qcheck((phx::ref(evaluated)++, _1 < 0), config2);
+    BOOST_REQUIRE(!res2.success());
+    BOOST_CHECK_EQUAL(res2.shrink_count(), 10u);
+    BOOST_CHECK_EQUAL(evaluated, 11);
+    BOOST_CHECK_EQUAL(boost::fusion::at_c<0>(res2.smallest_failure()), 990);
+    BOOST_CHECK_EQUAL(summary(res2), "Falsifiable, after 1 tests and 10 shrinks:\n[990]\n");
+
+    // An expired time budget stops shrinking
+    auto config3 = make_config(_1 = cnt, _test_count = 1u,
+                               _max_shrink_time = std::chrono::seconds(0));
+    auto res3 = qcheck(_1 < 0, config3);
+    BOOST_REQUIRE(!res3.success());
+    BOOST_CHECK_EQUAL(res3.shrink_count(), 0u);
+}
+
+void test_shrink_large_sequence()
+{
+    using namespace qchk;
+
+    // The candidates of a long vector are made one at a time, so shrinking
+    // it stops at the empty vector without making the others.
+    auto config = make_config(_1 = vector(uniform<double>(0, 1)), _sized = 4000u,
+                              _test_count = 1u);
+    auto res = qcheck(phx::size(_1) > 1000000u, config);
+    BOOST_REQUIRE(!res.success());
+    BOOST_CHECK(boost::fusion::at_c<0>(res.smallest_failure()).empty());
+    BOOST_CHECK_EQUAL(res.shrink_count(), 1u);
+
+    // Each candidate is charged to the budget as it is made.
+    int evaluated = 0;
+    auto config2 = make_config(_1 = vector(uniform<double>(0, 1)), _sized = 4000u,
+                               _test_count = 1u, _max_shrinks = 5u);
+    auto res2 = qcheck((phx::ref(evaluated)++, phx::size(_1) < 2u), config2);
+    BOOST_REQUIRE(!res2.success());
+    BOOST_CHECK_EQUAL(evaluated, 6);
+    BOOST_CHECK_GE(boost::fusion::at_c<0>(res2.smallest_failure()).size(), 2u);
+}
+
+using namespace boost::unit_test;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("tests for shrinking failing inputs");
+
+    test->add(BOOST_TEST_CASE(&test_shrink_integral));
+    test->add(BOOST_TEST_CASE(&test_shrink_floating));
+    test->add(BOOST_TEST_CASE(&test_shrink_sequence));
+    test->add(BOOST_TEST_CASE(&test_shrink_zip_and_array));
+    test->add(BOOST_TEST_CASE(&test_shrink_budget));
+    test->add(BOOST_TEST_CASE(&test_shrink_large_sequence));
+
+    return test;
+}
@@ -0,0 +1,119 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file size_schedule.cpp
+/// \brief A test of the size schedules that vary the size of each test case
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include <boost/quick_check/quick_check.hpp>
+#include <boost/phoenix/stl/container.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace qchk = boost::quick_check;
+namespace phx = boost::phoenix;
+
+// The built-in schedules ramp from lo to hi, then start again.
+void test_schedules()
+{
+    using namespace qchk;
+    size_schedule const none;
+    BOOST_CHECK(!none.scheduled());
+
+    size_schedule const linear = linear_sizes(1, 100, 100);
+    BOOST_CHECK_EQUAL(linear(0), 1u);
+    BOOST_CHECK_EQUAL(linear(33), 34u);
+    BOOST_CHECK_EQUAL(linear(99), 100u);
+    BOOST_CHECK_EQUAL(linear(100), 1u);
+
+    size_schedule const geometric = geometric_sizes(1, 1000, 4);
+    BOOST_CHECK_EQUAL(geometric(0), 1u);
+    BOOST_CHECK_EQUAL(geometric(1), 10u);
+    BOOST_CHECK_EQUAL(geometric(2), 100u);
+    BOOST_CHECK_EQUAL(geometric(3), 1000u);
+
+    // A length of 0 is filled in by the config; sizes are never 0.
+    size_schedule const alternating(
+        [](std::size_t i, std::size_t) { return i % 2 ? 0u : 10u; });
+    BOOST_CHECK_EQUAL(alternating.length(), 0u);
+    BOOST_CHECK_EQUAL(alternating.over(8).length(), 8u);
+    BOOST_CHECK_EQUAL(alternating.over(8)(0), 10u);
+    BOOST_CHECK_EQUAL(alternating.over(8)(1), 1u);
+    BOOST_CHECK_EQUAL(linear.over(8).length(), 100u);
+}
+
+// Each test case is generated with its own size, and is regenerated with it.
+void test_sized_cases()
+{
+    using namespace qchk;
+    auto config = make_config(_1 = vector(uniform<int>(0, 9))
+                            , _test_count = 200u
+                            , _seed = 5u
+                            , _size_schedule = linear_sizes(1, 100));
+    BOOST_CHECK_EQUAL(config.size_schedule().length(), 200u);
+
+    std::size_t small = 0, large = 0;
+    for(std::size_t i = 0; i < 200; ++i)
+    {
+        std::vector<int> const v = fusion::at_c<0>(config(i));
+        BOOST_REQUIRE(v.size() < config.size_schedule()(i));
+        if(i < 20)
+            small = (std::max)(small, v.size());
+        else if(i >= 180)
+            large = (std::max)(large, v.size());
+    }
+    BOOST_CHECK(small < 11u);
+    BOOST_CHECK(large > 50u);
+
+    // The results say which size each failure was generated with.
+    auto prop = phx::size(_1) < 60u;
+    auto res = qcheck(prop, config);
+    BOOST_REQUIRE(!res);
+    BOOST_REQUIRE(res.size_schedule().scheduled());
+    for(auto const &failure : res.failures())
+    {
+        BOOST_CHECK(res.size_schedule()(failure.case_index()) > 60u);
+        BOOST_CHECK(fusion::at_c<0>(config(failure.case_index())) == fusion::at_c<0>(failure));
+    }
+
+    // The shards of a parallel run use the same sizes.
+    auto config2 = make_config(_1 = vector(uniform<int>(0, 9))
+                             , _test_count = 200u
+                             , _seed = 5u
+                             , _size_schedule = linear_sizes(1, 100));
+    auto res2 = qcheck_parallel(prop, config2, 3);
+    BOOST_CHECK_EQUAL(res2.failure_count(), res.failure_count());
+    BOOST_CHECK_EQUAL(res2.size_schedule().length(), 200u);
+}
+
+// Without a schedule, the size is _sized throughout.
+void test_unscheduled()
+{
+    using namespace qchk;
+    auto config = make_config(_1 = vector(uniform<int>(0, 9)), _sized = 5u);
+    auto res = qcheck(phx::size(_1) < 5u, config);
+    BOOST_CHECK(res);
+    BOOST_CHECK(!res.size_schedule().scheduled());
+    BOOST_CHECK_EQUAL(config.sized(), 5u);
+}
+
+using namespace boost::unit_test;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("tests for size schedules");
+
+    test->add(BOOST_TEST_CASE(&test_schedules));
+    test->add(BOOST_TEST_CASE(&test_sized_cases));
+    test->add(BOOST_TEST_CASE(&test_unscheduled));
+
+    return test;
+}
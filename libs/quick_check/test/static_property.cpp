@@ -0,0 +1,179 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file static_property.cpp
+/// \brief A test of the static_property and property_ref classes
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <sstream>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/quick_check/quick_check.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace qchk = boost::quick_check;
+namespace phx = boost::phoenix;
+
+// Test for basic object semantics
+void test_static_property_0()
+{
+    using namespace qchk;
+    static_property<> prop0;
+    static_property<> prop1 = prop0;
+    prop1 = prop0;
+    BOOST_CHECK(!prop1.is_stored_inline());
+
+    static_property<> prop2 = phx::val(true);
+    BOOST_CHECK(prop2.is_stored_inline());
+    auto config = make_config();
+    std::stringstream sout;
+    qcheck(prop2, config).print_summary(sout);
+    BOOST_CHECK_EQUAL(
+        "OK, passed 100 tests.\n"
+      , sout.str()
+    );
+}
+
+void test_static_property_1()
+{
+    using namespace qchk;
+
+    static_property<int, double, grouped_by<int> > prop =
+        _1 == _2 >>=
+            group_by(_1 % 3)
+              | classify(_1 < 0, "_1 negative")
+              | classify(_2 < 0.0, "_2 negative")
+              | (_1 == _2);
+    BOOST_CHECK(prop(-1, -1.0));
+    BOOST_CHECK(!prop(-1, 1.0));
+
+    // Copies own their own expression.
+    static_property<int, double, grouped_by<int> > copy;
+    {
+        static_property<int, double, grouped_by<int> > tmp = prop;
+        copy = tmp;
+    }
+    property_ref<int, double, grouped_by<int> > const ref = copy;
+
+    fusion::vector2<int, double> args0(1, 1.0);
+    BOOST_CHECK(ref.classifier()(args0).empty());
+    BOOST_CHECK(ref.condition()(args0));
+    BOOST_CHECK_EQUAL(ref.grouper()(args0), 1);
+
+    fusion::vector2<int, double> args1(-1, 1.0);
+    std::vector<std::string> classes1 = ref.classifier()(args1);
+    BOOST_CHECK_EQUAL(classes1.size(), 1u);
+    BOOST_CHECK_EQUAL(classes1[0], "_1 negative");
+    BOOST_CHECK(!ref.condition()(args1));
+    BOOST_CHECK_EQUAL(ref.grouper()(args1), -1);
+
+    fusion::vector2<int, double> args2(-1, -1.0);
+    std::vector<std::string> classes2 = ref.classifier()(args2);
+    BOOST_CHECK_EQUAL(classes2.size(), 2u);
+    BOOST_CHECK_EQUAL(classes2[0], "_1 negative");
+    BOOST_CHECK_EQUAL(classes2[1], "_2 negative");
+    BOOST_CHECK(ref.condition()(args2));
+    BOOST_CHECK_EQUAL(ref.grouper()(args2), -1);
+
+    detail::case_outcome<int> outcome;
+    BOOST_REQUIRE(ref.evaluator()(args2, outcome));
+    BOOST_CHECK(outcome.passed);
+    BOOST_CHECK_EQUAL(outcome.classes, 3u);
+    BOOST_CHECK_EQUAL(outcome.group.get(), -1);
+    BOOST_CHECK(!ref.evaluator()(args1, outcome));
+}
+
+// qcheck() and qcheck_batched() get the same results from a static_property<>
+// as from the expression it was made from.
+template<typename Property, typename Expr, typename Check>
+void check_same_results(Property const &prop, Expr const &expr, Check check)
+{
+    using namespace qchk;
+    file_generator<int> di1("uniform_int_distribution.txt", text_file);
+    file_generator<int> di2("uniform_int_distribution.txt", text_file);
+    file_generator<double> dd1("normal_double_distribution.txt", text_file);
+    file_generator<double> dd2("normal_double_distribution.txt", text_file);
+    auto config1 = make_config(_1 = di1, _2 = dd1);
+    auto config2 = make_config(_1 = di2, _2 = dd2);
+    std::stringstream sout1, sout2;
+    check(expr, config1).print_summary(sout1);
+    check(prop, config2).print_summary(sout2);
+    BOOST_CHECK_EQUAL(sout1.str(), sout2.str());
+}
+
+struct run_qcheck
+{
+    template<typename Property, typename Config>
+    auto operator()(Property const &prop, Config &config) const
+    QCHK_RETURN(qchk::qcheck(prop, config))
+};
+
+struct run_qcheck_batched
+{
+    template<typename Property, typename Config>
+    auto operator()(Property const &prop, Config &config) const
+    QCHK_RETURN(qchk::qcheck_batched(prop, config, 7))
+};
+
+void test_static_property_2()
+{
+    using namespace qchk;
+
+    auto expr =
+        _1 % 5 != 0 >>=
+            group_by(_1 % 3)
+              | classify(_1 % 3 == 0, "multiple of 3")
+              | classify(_2 < 0.0, "_2 negative")
+              | (_1 < 1000000000);
+    static_property<int, double, grouped_by<int> > prop = expr;
+    BOOST_CHECK(prop.is_stored_inline());
+    check_same_results(prop, expr, run_qcheck());
+    check_same_results(prop, expr, run_qcheck_batched());
+    check_same_results(property_ref<int, double, grouped_by<int> >(prop), expr, run_qcheck());
+
+    auto expr2 = classify(_2 < 0.0, "_2 negative") | (_1 + _2 == _2 + _1);
+    static_property<int, double> prop2 = expr2;
+    check_same_results(prop2, expr2, run_qcheck());
+    check_same_results(prop2, expr2, run_qcheck_batched());
+
+    // A block of a config whose result_type is the property's args_type is
+    // evaluated with one virtual call.
+    typedef decltype(make_config(_1 = uniform<int>(), _2 = normal<double>())) config_type;
+    typedef
+        decltype(
+            fusion::as_vector(
+                fusion::transform(
+                    boost::declval<config_type::columns_type &>()
+                  , detail::column_data()
+                )
+            )
+        )
+    data_type;
+    static_assert(
+        boost::is_same<
+            detail::block_columns<static_property<int, double>::args_type>::type
+          , data_type
+        >::value
+      , "static_property<> block fast path is not taken"
+    );
+}
+
+using namespace boost::unit_test;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("tests for the static_property class");
+
+    test->add(BOOST_TEST_CASE(&test_static_property_0));
+    test->add(BOOST_TEST_CASE(&test_static_property_1));
+    test->add(BOOST_TEST_CASE(&test_static_property_2));
+
+    return test;
+}
@@ -0,0 +1,141 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file stats.cpp
+/// \brief A test of the per-phase statistics collected with _stats
+//
+// Copyright 2013 OptionMetrics, Inc.
+// Copyright 2013 Eric Niebler
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// NOTE: This library is not yet an official Boost library.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <sstream>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/quick_check/quick_check.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace qchk = boost::quick_check;
+namespace phx = boost::phoenix;
+
+// Statistics are not collected by default.
+void test_stats_0()
+{
+    using namespace qchk;
+    auto config = make_config(_1 = uniform<int>(0, 9));
+    static_assert(
+        boost::is_same<decltype(config)::stats_policy, no_stats>::value
+      , "statistics are collected by default"
+    );
+    auto res = qcheck(_1 >= 0, config);
+    BOOST_CHECK(!res.stats().enabled());
+    BOOST_CHECK_EQUAL(res.stats().generated(), 0u);
+    BOOST_CHECK(res.stats().draws().empty());
+    std::stringstream sout;
+    res.print_stats(sout);
+    BOOST_CHECK_EQUAL("No statistics collected.\n", sout.str());
+}
+
+// qcheck() counts the generated and rejected test cases, and times the phases.
+void test_stats_1()
+{
+    using namespace qchk;
+    auto config = make_config(_1 = uniform<int>(0, 9), _2 = uniform<int>(0, 9),
+                              _seed = 42u, _stats = collect_stats());
+    auto prop = _1 % 2 == 0 >>= classify(_2 < 5, "small") | (_1 + _2 == _2 + _1);
+    auto res = qcheck(prop, config);
+    BOOST_CHECK(res);
+    qcheck_stats const &stats = res.stats();
+    BOOST_REQUIRE(stats.enabled());
+    BOOST_CHECK_EQUAL(res.test_count(), 100u);
+    BOOST_CHECK_EQUAL(stats.generated(), res.test_count() + stats.rejected());
+    BOOST_CHECK_EQUAL(stats.generated(), config.next_case());
+    BOOST_REQUIRE_EQUAL(stats.draws().size(), 2u);
+    BOOST_CHECK_EQUAL(stats.draws()[0], stats.generated());
+    BOOST_CHECK_EQUAL(stats.draws()[1], stats.generated());
+
+    // The rejected test cases are the ones with odd _1.
+    std::size_t odd = 0;
+    for(std::size_t i = 0; i < stats.generated(); ++i)
+        odd += fusion::at_c<0>(config(i)) % 2;
+    BOOST_CHECK_EQUAL(stats.rejected(), odd);
+    BOOST_CHECK_CLOSE(stats.rejection_rate(), double(odd) / stats.generated(), 1e-9);
+
+    std::chrono::nanoseconds total(0);
+    for(std::size_t i = 0; i < qcheck_stats::phase_count; ++i)
+    {
+        BOOST_CHECK(stats.time(static_cast<qcheck_stats::phase>(i)).count() >= 0);
+        total += stats.time(static_cast<qcheck_stats::phase>(i));
+    }
+    BOOST_CHECK(total == stats.total_time());
+    BOOST_CHECK_EQUAL(stats.time(qcheck_stats::shrinking).count(), 0);
+
+    // Collecting statistics doesn't change the results.
+    auto plain = make_config(_1 = uniform<int>(0, 9), _2 = uniform<int>(0, 9), _seed = 42u);
+    std::stringstream sout1, sout2;
+    res.print_summary(sout1);
+    qcheck(prop, plain).print_summary(sout2);
+    BOOST_CHECK_EQUAL(sout1.str(), sout2.str());
+
+    // One line for the counts, one for the draws, and one per phase
+    std::stringstream sout;
+    res.print_stats(sout);
+    std::string const str = sout.str();
+    BOOST_CHECK_EQUAL(std::count(str.begin(), str.end(), '\n'), 2 + 6);
+    BOOST_CHECK(str.find("Draws: _1=") != std::string::npos);
+    BOOST_CHECK(str.find("classification") != std::string::npos);
+    BOOST_CHECK(str.find("shrinking") != std::string::npos);
+}
+
+// qcheck_batched() and qcheck_parallel() collect the same counts.
+void test_stats_2()
+{
+    using namespace qchk;
+    auto prop = _1 % 3 != 0 >>= (_1 < 1000);
+
+    auto config1 = make_config(_1 = uniform<int>(0, 2000), _seed = 7u,
+                               _test_count = 500u, _max_test_count = 5000u,
+                               _stats = collect_stats());
+    auto res1 = qcheck_batched(prop, config1, 64);
+    BOOST_CHECK(!res1);
+    BOOST_REQUIRE(res1.stats().enabled());
+    BOOST_CHECK(res1.stats().generated() >= res1.test_count() + res1.stats().rejected());
+    BOOST_CHECK_EQUAL(res1.stats().draws()[0], res1.stats().generated());
+    BOOST_CHECK(res1.stats().rejected() != 0);
+
+    auto config2 = make_config(_1 = uniform<int>(0, 2000), _seed = 7u,
+                               _test_count = 500u, _max_test_count = 5000u,
+                               _stats = collect_stats());
+    auto res2 = qcheck_parallel(prop, config2, 3);
+    BOOST_REQUIRE(res2.stats().enabled());
+    BOOST_CHECK_EQUAL(res2.stats().generated(), res2.test_count() + res2.stats().rejected());
+    BOOST_CHECK_EQUAL(res2.stats().draws()[0], res2.stats().generated());
+
+    // The statistics are copied and merged with the results.
+    auto copy = res2;
+    BOOST_CHECK_EQUAL(copy.stats().generated(), res2.stats().generated());
+    std::size_t const generated = res2.stats().generated();
+    copy.merge(boost::move(res2));
+    BOOST_CHECK_EQUAL(copy.stats().generated(), 2 * generated);
+
+    qcheck_stats empty;
+    empty.merge(copy.stats());
+    BOOST_CHECK(empty.enabled());
+    BOOST_CHECK_EQUAL(empty.draws().size(), 1u);
+}
+
+using namespace boost::unit_test;
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// init_unit_test_suite
+//
+test_suite* init_unit_test_suite( int argc, char* argv[] )
+{
+    test_suite *test = BOOST_TEST_SUITE("tests for the qcheck_stats class");
+
+    test->add(BOOST_TEST_CASE(&test_stats_0));
+    test->add(BOOST_TEST_CASE(&test_stats_1));
+    test->add(BOOST_TEST_CASE(&test_stats_2));
+
+    return test;
+}